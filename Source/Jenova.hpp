@@ -113,6 +113,9 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <functional>
+#include <memory>
+#include <atomic>
+#include <mutex>
 #include <filesystem>
 
 // Godot SDK :: Core
@@ -205,6 +208,7 @@
 #include <classes/reg_ex_match.hpp>
 #include <classes/resource_format_loader.hpp>
 #include <classes/resource_loader.hpp>
+#include <classes/class_db_singleton.hpp>
 #include <classes/resource_format_saver.hpp>
 #include <classes/resource_saver.hpp>
 #include <classes/global_constants.hpp>
@@ -233,6 +237,7 @@
 #include <classes/confirmation_dialog.hpp>
 #include <classes/tls_options.hpp>
 #include <classes/http_client.hpp>
+#include <classes/worker_thread_pool.hpp>
 
 // Godot SDK :: Templates
 #include <templates/hash_map.hpp>
@@ -312,6 +317,14 @@ namespace jenova
 	struct JenovaPackage;
 	struct AddonConfig;
 	struct ToolConfig;
+	struct ScriptDispatchEntry;
+	struct ScriptMethodSlot;
+	struct DispatchSnapshot;
+	struct ScriptPropertyLayout;
+	struct ScriptPropertyBlock;
+	struct ModulePart;
+	struct ModuleImage;
+	struct NativeClass;
 
 	// Type Definitions
 	typedef void* GenericHandle;
@@ -348,6 +361,14 @@ namespace jenova
 	typedef std::vector<ToolConfig> InstalledTools;
 	typedef std::string StringBuffer;
 	typedef std::unordered_map<std::string, void*> PointerStorage;
+	typedef std::unordered_map<std::string, int> IndexStorage;
+	typedef std::vector<ScriptDispatchEntry> DispatchTable;
+	typedef HashMap<StringName, const ScriptMethodSlot*> MethodSlotMap;
+	typedef std::shared_ptr<const DispatchSnapshot> DispatchSnapshotPtr;
+	typedef std::unordered_map<std::string, std::shared_ptr<ScriptPropertyLayout>> PropertyLayoutStorage;
+	typedef std::vector<ModulePart> ModulePartList;
+	typedef std::vector<std::shared_ptr<ModuleImage>> ModuleImageList;
+	typedef std::vector<std::unique_ptr<NativeClass>> NativeClassList;
 	typedef std::unordered_map<ModuleHandle, ToolConfig> LoadedTools;
 	typedef Vector<Ref<Resource>> ResourceCollection;
 	typedef uint64_t LongWord;
@@ -360,6 +381,8 @@ namespace jenova
 	typedef void* FunctionPointer;
 	typedef void* PropertyPointer;
 	typedef void* JenovaSDKInterface;
+	typedef bool(*NativeInvoker)(const godot::Object* self, const godot::Variant** args, int argsCount, godot::Variant* returnValue);
+	typedef void(*NativePtrInvoker)(const godot::Object* self, const GDExtensionConstTypePtr* args, GDExtensionTypePtr returnValue);
 
 	// Enumerators
 	enum class TargetPlatform
@@ -524,6 +547,11 @@ namespace jenova
 		Dynamically,
 		Statically
 	};
+	enum class ModuleBuildMode
+	{
+		Monolithic,
+		PerScript
+	};
 	enum class ModuleCacheType : short
 	{
 		Proprietary						= 0x5250,
@@ -541,6 +569,84 @@ namespace jenova
 		InstallFromPackageFile,
 		InstallFromPackageDirectory
 	};
+	enum class MarshalTypeTag : uint8_t
+	{
+		Void,
+		Bool,
+		Int32,
+		UInt32,
+		Int64,
+		UInt64,
+		Float,
+		Double,
+		Object,
+		String,
+		Vector2,
+		Vector2i,
+		Rect2,
+		Rect2i,
+		Vector3,
+		Vector3i,
+		Transform2D,
+		Vector4,
+		Vector4i,
+		Plane,
+		Quaternion,
+		AABB,
+		Basis,
+		Transform3D,
+		Projection,
+		Color,
+		StringName,
+		NodePath,
+		RID,
+		Callable,
+		Signal,
+		Dictionary,
+		Array,
+		PackedByteArray,
+		PackedInt32Array,
+		PackedInt64Array,
+		PackedFloat32Array,
+		PackedFloat64Array,
+		PackedStringArray,
+		PackedVector2Array,
+		PackedVector3Array,
+		PackedColorArray,
+		PackedVector4Array,
+		Reference,
+		ByteSpan,
+		Int32Span,
+		Int64Span,
+		Float32Span,
+		Float64Span,
+		Vector2Span,
+		Vector3Span,
+		ColorSpan,
+		Vector4Span,
+		WritableByteSpan,
+		WritableInt32Span,
+		WritableInt64Span,
+		WritableFloat32Span,
+		WritableFloat64Span,
+		WritableVector2Span,
+		WritableVector3Span,
+		WritableColorSpan,
+		WritableVector4Span,
+		Variant
+	};
+	enum class VariantStorage : uint8_t
+	{
+		Scalar,
+		Copied,
+		Self,
+		View
+	};
+	enum class BatchExecution
+	{
+		Serial,
+		Parallel
+	};
 
 	// Flags
 	enum CompilerFeature : CompilerFeatures
@@ -616,6 +722,214 @@ namespace jenova
 	{
 		String scriptUID;
 		Vector<ScriptProperty> scriptProperties;
+		HashMap<StringName, uint32_t> propertyIndices;
+		std::vector<GDExtensionPropertyInfo> propertyListInfo;
+	};
+	struct MarshalTypeOperations
+	{
+		size_t typeSize = 0;
+		Variant::Type variantType = Variant::NIL;
+		VariantStorage variantStorage = VariantStorage::Copied;
+		const char* callerType = "void*";
+		const char* valueLayout = nullptr;
+		bool writesBack = false;
+		void(*constructFromVariant)(void* valueStorage, const Variant& variantValue) = nullptr;
+		void(*assignToVariant)(Variant& variantValue, const void* valueStorage) = nullptr;
+		void(*destructor)(void* valueStorage) = nullptr;
+	};
+	struct ParameterMarshal
+	{
+		MarshalTypeTag typeTag = MarshalTypeTag::Variant;
+		bool passByReference = false;
+	};
+	struct ScriptMethodSlot
+	{
+		StringName methodName;
+		std::string functionName;
+		std::string ownerScriptUID;
+		FunctionAddress functionOffset = 0;
+		std::string returnTypeName;
+		Variant::Type returnType = Variant::NIL;
+		ParameterTypeList parameterTypeNames;
+		LocalVector<Variant::Type> parameterTypes;
+		std::string thunkSignature;
+		bool passesCaller = false;
+		bool hasParameters = false;
+		bool mustReturn = false;
+		NativeInvoker nativeInvoker = nullptr;
+		NativePtrInvoker nativePtrInvoker = nullptr;
+		MarshalTypeTag returnTag = MarshalTypeTag::Void;
+		LocalVector<ParameterMarshal> parameterMarshals;
+		FunctionPointer callerThunk = nullptr;
+		FunctionPointer callerStub = nullptr;
+		FunctionAddress functionAddress = 0;
+		uint64_t dispatchGeneration = 0;
+	};
+	struct ScriptDispatchEntry
+	{
+		std::string scriptUID;
+		ModuleAddress moduleBaseAddress = 0;
+		std::vector<ScriptMethodSlot> methodSlots;
+		HashMap<StringName, uint32_t> methodIndices;
+	};
+	struct DispatchSnapshot
+	{
+		uint64_t generation = 0;
+		DispatchTable dispatchTable;
+		IndexStorage dispatchIndices;
+		json_t moduleMetaData = "{}";
+		PropertyLayoutStorage propertyLayouts;
+	};
+	struct MethodSlotMapHolder
+	{
+		DispatchSnapshotPtr dispatchSnapshot;
+		MethodSlotMap methodSlots;
+	};
+	struct ClassNameIndexEntry
+	{
+		uint64_t modifiedTime = 0;
+		uint64_t fileSize = 0;
+		bool hasSourceCode = false;
+		std::string className;
+		std::string baseType;
+	};
+	typedef std::unordered_map<std::string, ClassNameIndexEntry> ClassNameIndex;
+	struct ScriptIdentity
+	{
+		String resourcePath;
+		String scriptUID;
+		std::string scriptUIDString;
+		StringName scriptUIDName;
+		uint32_t scriptIndex = UINT32_MAX;
+	};
+	struct CallableSlotBinding
+	{
+		std::shared_ptr<const MethodSlotMap> methodSlotMap;
+		const ScriptMethodSlot* methodSlot = nullptr;
+		uint64_t dispatchGeneration = 0;
+	};
+	struct PropertyTypeOperations
+	{
+		size_t typeSize = 0;
+		Variant::Type variantType = Variant::NIL;
+		void(*constructor)(void* propertyStorage) = nullptr;
+		void(*destructor)(void* propertyStorage) = nullptr;
+		void*(*allocator)() = nullptr;
+		bool(*writeFromVariant)(void* propertyStorage, const Variant& variantValue) = nullptr;
+		void(*readToVariant)(const void* propertyStorage, Variant& variantValue) = nullptr;
+		void(*copyConstructor)(void* propertyStorage, const void* sourceStorage) = nullptr;
+		bool isTriviallyCopyable = false;
+	};
+	struct ScriptPropertySlot
+	{
+		StringName propertyName;
+		std::string propertyTypeName;
+		Variant::Type propertyType = Variant::NIL;
+		PropertyAddress propertyOffset = 0;
+		size_t storageOffset = 0;
+		const PropertyTypeOperations* typeOperations = nullptr;
+		Variant defaultValue;
+	};
+	struct ScriptPropertyBlock
+	{
+		std::shared_ptr<ScriptPropertyLayout> propertyLayout;
+		uint8_t* blockStorage = nullptr;
+		std::vector<bool> dirtyProperties;
+	};
+	struct ScriptPropertyLayout
+	{
+		std::string scriptUID;
+		std::vector<ScriptPropertySlot> propertySlots;
+		ScriptPropertyContainer propertyContainer;
+		ModuleAddress moduleBaseAddress = 0;
+		size_t blockSize = 0;
+		uint64_t layoutGeneration = 0;
+		PointerList arenaChunks;
+		PointerList freeBlocks;
+		std::vector<ScriptPropertyBlock*> freeBlockHeaders;
+		uint8_t* defaultImage = nullptr;
+		ScriptPropertyBlock* boundBlock = nullptr;
+		std::mutex arenaMutex;
+		~ScriptPropertyLayout()
+		{
+			if (defaultImage)
+			{
+				for (const ScriptPropertySlot& propertySlot : propertySlots) propertySlot.typeOperations->destructor(defaultImage + propertySlot.storageOffset);
+				std::free(defaultImage);
+			}
+			for (ScriptPropertyBlock* blockHeader : freeBlockHeaders) delete blockHeader;
+			for (void* arenaChunk : arenaChunks) std::free(arenaChunk);
+		}
+	};
+	struct RegistryHandle
+	{
+		uint32_t slotIndex = UINT32_MAX;
+		uint32_t slotGeneration = 0;
+	};
+	struct InstancePoolStatistics
+	{
+		size_t slabAllocations = 0;
+		size_t instanceAllocations = 0;
+		size_t pooledAllocations = 0;
+		size_t releasedInstances = 0;
+		size_t activeInstances = 0;
+		size_t peakInstances = 0;
+	};
+	struct ScriptInstancePool
+	{
+		PointerList slabChunks;
+		PointerList freeSlots;
+		InstancePoolStatistics poolStatistics;
+		std::mutex poolMutex;
+		~ScriptInstancePool() { for (void* slabChunk : slabChunks) std::free(slabChunk); }
+	};
+	struct ModuleImage
+	{
+		ModuleHandle moduleHandle = nullptr;
+		ModuleAddress moduleBaseAddress = 0;
+		json_t moduleMetaData = "{}";
+		size_t moduleBinarySize = 0;
+		bool hasDebugInformation = false;
+		bool executeInDebugMode = false;
+		bool calleeDestroysArguments = false;
+		std::string moduleDiskPath;
+		InterpreterBackend interpreterBackend = InterpreterBackend::TinyCC;
+		PropertyLayoutStorage propertyLayouts;
+		std::shared_ptr<DispatchSnapshot> dispatchSnapshot;
+		std::string partName;
+		std::string partHash;
+		ModuleImageList partImages;
+		bool isActive = false;
+		bool isRetired = false;
+	};
+	struct NativeClassMethod
+	{
+		StringName methodName;
+		bool mustReturn = false;
+		uint64_t signatureHash = 0;
+		uint64_t registeredSignatureHash = 0;
+		Variant::Type returnType = Variant::NIL;
+		LocalVector<Variant::Type> argumentTypes;
+	};
+	struct NativeClass
+	{
+		StringName className;
+		StringName parentClassName;
+		std::string scriptUID;
+		String scriptPath;
+		Ref<Resource> scriptResource;
+		std::unordered_map<std::string, std::unique_ptr<NativeClassMethod>> classMethods;
+	};
+	struct NativeClassInstance
+	{
+		NativeClass* nativeClass = nullptr;
+		godot::Object* ownerObject = nullptr;
+	};
+	struct RetiredModule
+	{
+		ModuleHandle moduleHandle = nullptr;
+		ModuleAddress moduleBaseAddress = 0;
+		uint64_t retireEpoch = 0;
 	};
 	struct ScriptFileState
 	{
@@ -632,6 +946,14 @@ namespace jenova
 		String compileError = "";
 		String compileVerbose = "";
 		int scriptsCount = 0;
+		int scriptsRestored = 0;
+	};
+	struct ModulePart
+	{
+		std::string partName;
+		std::string partHash;
+		MemoryBuffer partData;
+		SerializedData partMetaData;
 	};
 	struct BuildResult
 	{
@@ -645,6 +967,7 @@ namespace jenova
 		std::string buildPath;
 		CompilerModel compilerModel = CompilerModel::Unspecified;
 		bool hasDebugInformation = false;
+		ModulePartList moduleParts;
 	};
 	struct ModuleDatabaseHeader
 	{
@@ -655,7 +978,16 @@ namespace jenova
 		float compressionRatio					= 100.0f;
 		ModuleCacheType databaseType			= ModuleCacheType::Unknown;
 		unsigned char databaseVersion[4]		= { 0 };
-		unsigned char reserved[14]				= { 0 };
+		uint16_t partsCount						= 0;
+		unsigned char reserved[12]				= { 0 };
+	};
+	struct ModuleDatabasePartHeader
+	{
+		char partName[64]						= { 0 };
+		char partHash[40]						= { 0 };
+		size_t moduleSize						= 0;
+		size_t metaDataSize						= 0;
+		size_t encodedDataSize					= 0;
 	};
 	struct ScriptCaller
 	{
@@ -664,6 +996,12 @@ namespace jenova
 		// Initializer
 		ScriptCaller(const void* _self) : self(_self) {}
 	};
+	struct NativeInvokerEntry
+	{
+		const char* functionName;
+		NativeInvoker invoker;
+		NativePtrInvoker ptrInvoker;
+	};
 	struct ExtensionInitializerData
 	{
 		GDExtensionInterfaceGetProcAddress		godotGetProcAddress;
@@ -756,7 +1094,7 @@ namespace jenova
 		constexpr bool RegisterGlobalCrashHandler				= false;
 		constexpr bool CreateDumpOnExecutionCrash				= false;
 		constexpr bool LoadAndUnloadToolPackages				= true;
-		constexpr bool UpdatePropertiesAfterCall				= true;
+		constexpr bool GenerateScriptNativeInvokers				= true;
 		constexpr bool DisableBuildAndRunWhileDebug				= true;
 
 		constexpr size_t PrintOutputBufferSize					= 8192;
@@ -764,6 +1102,14 @@ namespace jenova
 		constexpr size_t FormatBufferSize						= 4096;
 		constexpr size_t ScriptReloadCooldown					= 200;
 		constexpr size_t ScriptChangeCooldown					= 200;
+		constexpr size_t PropertyArenaBlocksPerChunk			= 64;
+		constexpr size_t InstancePoolSlotsPerChunk				= 64;
+		constexpr size_t CompilerWorkerMemoryBudget				= 1024ull * 1024 * 1024;
+		constexpr size_t ObjectStoreManifestEntries				= 8;
+		constexpr size_t ObjectStoreDefaultCapacity				= 2048;
+		constexpr size_t InterpreterMaxCallArguments			= 16;
+		constexpr size_t InterpreterMarshalStorageSize			= sizeof(godot::Projection);
+		constexpr size_t ScriptBatchParallelChunkSize			= 256;
 
 		constexpr char* JenovaRuntimeModuleName					= "Jenova.Runtime";
 		constexpr char* JenovaScriptExtension					= "cpp";
@@ -772,6 +1118,8 @@ namespace jenova
 		constexpr char* JenovaHeaderType						= "CPPHeader";
 		constexpr char* JenovaCacheDirectory					= "/Jenova_Cache/";
 		constexpr char* ScriptToolIdentifier					= "JENOVA_TOOL_SCRIPT";
+		constexpr char* ScriptNativeUpdateIdentifier			= "JENOVA_NATIVE_UPDATE";
+		constexpr char* ScriptModuleGroupIdentifier				= "JENOVA_MODULE_GROUP";
 		constexpr char* ScriptBlockBeginIdentifier				= "JENOVA_SCRIPT_BEGIN";
 		constexpr char* ScriptBlockEndIdentifier				= "JENOVA_SCRIPT_END";
 		constexpr char* ScriptVMBeginIdentifier					= "JENOVA_VM_BEGIN";
@@ -780,12 +1128,23 @@ namespace jenova
 		constexpr char* ScriptPropertyIdentifier				= "JENOVA_PROPERTY";
 		constexpr char* ScriptClassNameIdentifier				= "JENOVA_CLASS_NAME";
 		constexpr char* ScriptFunctionExportIdentifier			= "JENOVA_EXPORT";
+		constexpr char* ScriptNativeInvokerTablePrefix			= "__jnv_invokers_";
 		constexpr char* DefaultModuleDatabaseFile				= "JenovaRuntime.jdb";
 		constexpr char* DefaultModuleConfigFile					= "JenovaRuntime.cfg";
 		constexpr char* DefaultJenovaBootPath					= "res://J.E.N.O.V.A/";
+		constexpr char* DefaultNativeClassBaseType				= "Node";
+		constexpr char* RuntimeModulePartName					= "Jenova.Runtime";
 		constexpr char* JenovaModuleBootEventName				= "JenovaBoot";
 		constexpr char* JenovaModuleShutdownEventName			= "JenovaShutdown";
 		constexpr char* JenovaBuildCacheDatabaseFile			= "Jenova.Build.json";
+		constexpr char* JenovaClassNameIndexFile				= "Jenova.ClassNames.json";
+		constexpr char* ScriptDependencyFileExtension			= ".d";
+		constexpr char* ScriptSourceDependenciesFileExtension	= ".json";
+		constexpr char* JenovaPrecompiledHeaderFile				= "Jenova.Precompiled.hpp";
+		constexpr char* JenovaPrecompiledSourceFile				= "Jenova.Precompiled.cpp";
+		constexpr char* PrecompiledHeaderKeyFileExtension		= ".key";
+		constexpr char* JenovaObjectStoreDirectory				= "ObjectStore/";
+		constexpr char* JenovaObjectStoreUsageFile				= "Store.usage";
 		constexpr char* JenovaInstalledPackagesFile				= "Jenova.Runtime.Packages.json";
 		constexpr char* JenovaGodotSDKHeaderCacheFile			= "GodotSDK.auto";
 		constexpr char* JenovaConfigurationFile					= "Jenova.config";
@@ -814,6 +1173,7 @@ namespace jenova
 		extern jenova::ChangesTriggerMode						CurrentChangesTriggerMode;
 		extern jenova::EditorVerboseOutput						CurrentEditorVerboseOutput;
 		extern jenova::SDKLinkingMode							SDKLinkingMode;
+		extern jenova::ModuleBuildMode							ModuleBuildMode;
 		extern std::string										CurrentJenovaCacheDirectory;
 		extern std::string										CurrentJenovaGeneratedConfiguration;
 		extern std::string										CurrentJenovaRuntimeModulePath;
@@ -821,6 +1181,7 @@ namespace jenova
 		extern bool												UseHotReloadAtRuntime;
 		extern bool												UseMonospaceFontForTerminal;
 		extern bool												UseManagedSafeExecution;
+		extern bool												UseNativeClassBinding;
 		extern int												TerminalDefaultFontSize;
 	}
 
@@ -912,6 +1273,9 @@ namespace jenova
 	ScriptModule CreateScriptModuleFromInternalSource(const std::string& sourceName, const std::string& sourceCode);
 	bool CreateFileFromInternalSource(const std::string& sourceFile, const std::string& sourceCode);
 	bool CreateBuildCacheDatabase(const std::string& cacheFile, const ModuleList& scriptModules, const jenova::HeaderList& scriptHeaders, bool skipHashes = false);
+	size_t InvalidateBuildCacheByHeaderChanges(jenova::json_t& buildCacheDatabase, const jenova::HeaderList& scriptHeaders);
+	std::vector<std::string> ParseScriptDependencyFile(const std::string& dependencyFile);
+	std::string NormalizeDependencyPath(const std::string& dependencyPath);
 	std::string GetLoadedModulePath(jenova::ModuleHandle moduleHandle);
 	MemoryBuffer CompressBuffer(void* bufferPtr, size_t bufferSize);
 	MemoryBuffer DecompressBuffer(void* bufferPtr, size_t bufferSize);
@@ -956,10 +1320,12 @@ namespace jenova
 	jenova::InstalledTools GetInstalledTools();
 	String GetInstalledCompilerPathFromPackages(const String& compilerIdentity, const jenova::CompilerModel& compilerModel);
 	String GetInstalledGodotKitPathFromPackages(const String& godotKitIdentity);
-	std::string ResolveVariantValueAsString(const Variant* variantValue, jenova::PointerList& ptrList);
-	std::string ResolveVariantTypeAsString(const Variant* variantValue);
+	jenova::MarshalTypeTag GetMarshalTypeTagFromStdString(const std::string& typeName);
+	bool IsSpanTypeName(const std::string& typeName);
+	const jenova::MarshalTypeOperations& GetMarshalTypeOperations(jenova::MarshalTypeTag typeTag);
+	uintptr_t MarshalVariantArgument(const Variant* variantValue, const jenova::ParameterMarshal& parameterMarshal, void* argumentStorage, bool& argumentConstructed);
+	bool UnmarshalReturnValue(Variant& variantValue, jenova::MarshalTypeTag returnTag, void* returnStorage);
 	std::string ResolveReturnTypeForJIT(const std::string& returnType);
-	Variant* MakeVariantFromReturnType(Variant* variantPtr, const char* returnType);
 	uint32_t GetPropertyEnumFlagFromString(const std::string enumFlagStr);
 	jenova::SerializedData ProcessAndExtractPropertiesFromScript(OutParam std::string& scriptSource, const std::string& scriptUID);
 	jenova::SerializedData ProcessAndExtractPropertiesFromScript(OutParam String& scriptSource, const String& scriptUID);
@@ -967,9 +1333,13 @@ namespace jenova
 	jenova::ScriptPropertyContainer CreatePropertyContainerFromMetadata(const jenova::SerializedData& propertyMetadata, const std::string& scriptUID);
 	void CleanVariantTypeName(std::string& typeName);
 	void* AllocateVariantBasedProperty(const std::string& typeName);
+	const std::unordered_map<std::string, const jenova::PropertyTypeOperations*>& GetPropertyTypeDescriptors();
+	const jenova::PropertyTypeOperations* GetVariantBasedPropertyOperations(const std::string& typeName);
 	bool SetPropertyPointerValueFromVariant(jenova::PropertyPointer propertyPointer, const Variant& variantValue);
 	bool GetVariantFromPropertyPointer(const jenova::PropertyPointer propertyPointer, godot::Variant& variantValue, const Variant::Type& variantType);
 	std::string ParseClassNameFromScriptSource(const std::string& sourceCode);
+	std::string ParseClassBaseTypeFromScriptSource(const std::string& sourceCode);
+	std::string GenerateNativeInvokersFromScript(const std::string& scriptSource, const std::string& scriptUID);
 	jenova::ScriptFileState BackupScriptFileState(const std::string& scriptFilePath);
 	bool RestoreScriptFileState(const std::string& scriptFilePath, const jenova::ScriptFileState& scriptFileState);
 	void RandomWait(int minWaitTime, int maxWaitTime);
@@ -55,6 +55,8 @@
 
 // Jenova Configuration Macros
 #define JENOVA_TOOL_SCRIPT
+#define JENOVA_NATIVE_UPDATE
+#define JENOVA_MODULE_GROUP(name)
 
 // Jenova Script Block Macros
 #define JENOVA_SCRIPT_BEGIN
@@ -71,7 +73,7 @@
 
 // Jenova Class Name
 #ifndef JENOVA_CLASS_NAME
-	#define JENOVA_CLASS_NAME(className)
+	#define JENOVA_CLASS_NAME(className, ...)
 #endif
 
 // C++ Runtime Imports
@@ -80,6 +82,8 @@
 	#include <string>
 	#include <thread>
 	#include <functional>
+	#include <type_traits>
+	#include <utility>
 #endif
 
 // GodotSDK Imports
@@ -92,6 +96,8 @@
 	#include <Godot/classes/node.hpp>
 	#include <Godot/classes/scene_tree.hpp>
 	#include <Godot/classes/texture2d.hpp>
+	#include <Godot/classes/script.hpp>
+	#include <Godot/core/binder_common.hpp>
 #endif
 
 // Jenova SDK Implementation
@@ -135,6 +141,11 @@ namespace jenova::sdk
 		PhysicsProcess,
 		ReceivedDebuggerMessage
 	};
+	enum class BatchExecution
+	{
+		Serial,
+		Parallel
+	};
 	enum class ClassAccess 
 	{
 		Core,
@@ -159,6 +170,8 @@ namespace jenova::sdk
 	// Function Definitions
 	typedef void(*RuntimeCallback)(const RuntimeEvent& runtimeEvent, NativePtr dataPtr, size_t dataSize);
 	typedef void(*FileSystemCallback)(const godot::String& targetPath, const FileSystemEvent& fsEvent);
+	typedef bool(*NativeInvoker)(const godot::Object* self, const godot::Variant** args, int argsCount, godot::Variant* returnValue);
+	typedef void(*NativePtrInvoker)(const godot::Object* self, const GDExtensionConstTypePtr* args, GDExtensionTypePtr returnValue);
 
 	// Structures
 	struct Caller
@@ -166,6 +179,13 @@ namespace jenova::sdk
 		// Script Caller
 		const godot::Object* self;
 	};
+	struct NativeInvokerEntry
+	{
+		// Script Function Invoker (Generated At Build)
+		StringPtr functionName;
+		NativeInvoker invoker;
+		NativePtrInvoker ptrInvoker;
+	};
 
 	// JenovaSDK Interface
 	struct JenovaSDK
@@ -237,6 +257,14 @@ namespace jenova::sdk
 		JENOVA_INTERNAL(bool ExecuteScript(const godot::String& ctronScript, bool noEntrypoint = false));
 		JENOVA_INTERNAL(bool ExecuteScriptFromFile(const godot::String& ctronScriptFile, bool noEntrypoint = false));
 
+		// Script Batch Utilities
+		JENOVA_INTERNAL(size_t InvokeScriptMethod(godot::Object* const* objects, size_t objectCount, const godot::StringName& methodName, const godot::Variant** args, int argsCount, BatchExecution executionMode, godot::Variant* results));
+		JENOVA_INTERNAL(size_t InvokeScriptMethod(const godot::Ref<godot::Script>& script, const godot::StringName& methodName, const godot::Variant** args, int argsCount, BatchExecution executionMode, godot::Variant* results));
+
+		// Native Callable Utilities
+		JENOVA_INTERNAL(godot::Callable CreateScriptCallable(godot::Object* target, const godot::StringName& methodName));
+		JENOVA_INTERNAL(godot::Callable CreateNativeCallable(godot::Object* target, NativeInvoker invoker));
+
 		// Interface Validator
 		static bool ValidateInterface(void* bridgePtr)
 		{
@@ -560,6 +588,37 @@ namespace jenova::sdk
 		}
 	}
 
+	// Script Batch Utilities :: Wrappers
+	JENOVA_WRAPPER size_t InvokeScriptMethod(godot::Object* const* objects, size_t objectCount, const godot::StringName& methodName, const godot::Variant** args = nullptr, int argsCount = 0, BatchExecution executionMode = BatchExecution::Serial, godot::Variant* results = nullptr)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return 0;
+		return bridge->InvokeScriptMethod(objects, objectCount, methodName, args, argsCount, executionMode, results);
+	}
+	JENOVA_WRAPPER size_t InvokeScriptMethod(const godot::Ref<godot::Script>& script, const godot::StringName& methodName, const godot::Variant** args = nullptr, int argsCount = 0, BatchExecution executionMode = BatchExecution::Serial, godot::Variant* results = nullptr)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return 0;
+		return bridge->InvokeScriptMethod(script, methodName, args, argsCount, executionMode, results);
+	}
+
+	// Native Callable Utilities :: Wrappers
+	JENOVA_WRAPPER godot::Callable CreateScriptCallable(godot::Object* target, const godot::StringName& methodName)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return godot::Callable();
+		return bridge->CreateScriptCallable(target, methodName);
+	}
+	JENOVA_WRAPPER godot::Callable CreateNativeCallable(godot::Object* target, NativeInvoker invoker)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return godot::Callable();
+		return bridge->CreateNativeCallable(target, invoker);
+	}
+	JENOVA_WRAPPER godot::Error ConnectScriptMethod(godot::Object* object, const godot::StringName& signalName, godot::Object* target, const godot::StringName& methodName, uint32_t connectFlags = 0)
+	{
+		if (!object) return godot::ERR_INVALID_PARAMETER;
+		godot::Callable scriptCallable = CreateScriptCallable(target, methodName);
+		if (!scriptCallable.is_valid()) return godot::ERR_INVALID_PARAMETER;
+		return object->connect(signalName, scriptCallable, connectFlags);
+	}
+
 	// Template Helpers
 	template <typename T> T* GetSelf(Caller* caller)
 	{
@@ -590,4 +649,162 @@ namespace jenova::sdk
 	{
 		return T(GetGlobalVariable(id));
 	}
+
+	// Array Spans [Views Into Packed Array Buffers, Copy Constructor Keeps Them Passed By Reference On All ABIs]
+	template <typename T> struct ConstSpan
+	{
+		const T* data = nullptr;
+		size_t size = 0;
+
+		// Initializers
+		ConstSpan() {}
+		ConstSpan(const T* _data, size_t _size) : data(_data), size(_size) {}
+		ConstSpan(const ConstSpan& other) : data(other.data), size(other.size) {}
+
+		// Accessors
+		const T& operator[](size_t index) const { return data[index]; }
+		const T* begin() const { return data; }
+		const T* end() const { return data + size; }
+		bool empty() const { return size == 0; }
+	};
+	template <typename T> struct Span
+	{
+		T* data = nullptr;
+		size_t size = 0;
+
+		// Initializers
+		Span() {}
+		Span(T* _data, size_t _size) : data(_data), size(_size) {}
+		Span(const Span& other) : data(other.data), size(other.size) {}
+
+		// Accessors
+		T& operator[](size_t index) const { return data[index]; }
+		T* begin() const { return data; }
+		T* end() const { return data + size; }
+		bool empty() const { return size == 0; }
+		operator ConstSpan<T>() const { return ConstSpan<T>(data, size); }
+	};
+
+	// Native Invoker Helpers
+	template <typename T> constexpr bool IsNativeInvokerArgument()
+	{
+		using TDecayed = std::remove_cv_t<std::remove_reference_t<T>>;
+		if constexpr (std::is_lvalue_reference_v<T> && !std::is_const_v<std::remove_reference_t<T>>) return false;
+		else if constexpr (std::is_pointer_v<TDecayed>) return std::is_base_of_v<godot::Object, std::remove_cv_t<std::remove_pointer_t<TDecayed>>>;
+		else return std::is_convertible_v<godot::Variant, TDecayed>;
+	}
+	template <typename R> constexpr bool IsNativeInvokerReturn()
+	{
+		if constexpr (std::is_void_v<R>) return true;
+		else return std::is_constructible_v<godot::Variant, std::remove_cv_t<std::remove_reference_t<R>>>;
+	}
+	template <typename R, typename... A, size_t... I> void InvokeNativeUnpacked(R(*function)(A...), const godot::Variant** args, godot::Variant* returnValue, std::index_sequence<I...>)
+	{
+		if constexpr (std::is_void_v<R>) function(godot::VariantCaster<A>::cast(*args[I])...);
+		else *returnValue = godot::Variant(function(godot::VariantCaster<A>::cast(*args[I])...));
+	}
+	template <typename R, typename... A, size_t... I> void InvokeNativeUnpacked(R(*function)(Caller*, A...), Caller* caller, const godot::Variant** args, godot::Variant* returnValue, std::index_sequence<I...>)
+	{
+		if constexpr (std::is_void_v<R>) function(caller, godot::VariantCaster<A>::cast(*args[I])...);
+		else *returnValue = godot::Variant(function(caller, godot::VariantCaster<A>::cast(*args[I])...));
+	}
+	template <typename R, typename... A> bool InvokeNative(R(*function)(A...), const godot::Object* self, const godot::Variant** args, int argsCount, godot::Variant* returnValue)
+	{
+		if constexpr (!(IsNativeInvokerReturn<R>() && (IsNativeInvokerArgument<A>() && ...))) return false;
+		else
+		{
+			if (argsCount < int(sizeof...(A))) return false;
+			InvokeNativeUnpacked(function, args, returnValue, std::index_sequence_for<A...>());
+			return true;
+		}
+	}
+	template <typename R, typename... A> bool InvokeNative(R(*function)(Caller*, A...), const godot::Object* self, const godot::Variant** args, int argsCount, godot::Variant* returnValue)
+	{
+		if constexpr (!(IsNativeInvokerReturn<R>() && (IsNativeInvokerArgument<A>() && ...))) return false;
+		else
+		{
+			if (argsCount < int(sizeof...(A))) return false;
+			Caller caller{ self };
+			InvokeNativeUnpacked(function, &caller, args, returnValue, std::index_sequence_for<A...>());
+			return true;
+		}
+	}
+
+	// Native Pointer Invoker Helpers
+	template <typename T> struct PackedArrayOf;
+	template <> struct PackedArrayOf<uint8_t> { using Type = godot::PackedByteArray; };
+	template <> struct PackedArrayOf<int32_t> { using Type = godot::PackedInt32Array; };
+	template <> struct PackedArrayOf<int64_t> { using Type = godot::PackedInt64Array; };
+	template <> struct PackedArrayOf<float> { using Type = godot::PackedFloat32Array; };
+	template <> struct PackedArrayOf<double> { using Type = godot::PackedFloat64Array; };
+	template <> struct PackedArrayOf<godot::Vector2> { using Type = godot::PackedVector2Array; };
+	template <> struct PackedArrayOf<godot::Vector3> { using Type = godot::PackedVector3Array; };
+	template <> struct PackedArrayOf<godot::Color> { using Type = godot::PackedColorArray; };
+	template <> struct PackedArrayOf<godot::Vector4> { using Type = godot::PackedVector4Array; };
+	template <typename T, typename = void> struct IsNativePtrArgument : std::false_type {};
+	template <typename T> struct IsNativePtrArgument<T, std::void_t<decltype(godot::PtrToArg<T>::convert(std::declval<const void*>()))>> : std::true_type {};
+	template <typename R, typename = void> struct IsNativePtrReturn : std::is_void<R> {};
+	template <typename R> struct IsNativePtrReturn<R, std::void_t<decltype(godot::PtrToArg<R>::encode(std::declval<R>(), std::declval<void*>()))>> : std::true_type {};
+	template <typename F> struct NativePtrFunction { static constexpr bool isSupported = false; };
+	template <typename R, typename... A> struct NativePtrFunction<R(*)(A...)>
+	{
+		static constexpr bool isSupported = IsNativePtrReturn<R>::value && (IsNativePtrArgument<A>::value && ...);
+		static constexpr size_t argumentsCount = sizeof...(A);
+		template <size_t... I> static void Invoke(R(*function)(A...), const godot::Object* self, const GDExtensionConstTypePtr* args, GDExtensionTypePtr returnValue, std::index_sequence<I...>)
+		{
+			if constexpr (std::is_void_v<R>) function(godot::PtrToArg<A>::convert(args[I])...);
+			else godot::PtrToArg<R>::encode(function(godot::PtrToArg<A>::convert(args[I])...), returnValue);
+		}
+	};
+	template <typename R, typename... A> struct NativePtrFunction<R(*)(Caller*, A...)>
+	{
+		static constexpr bool isSupported = IsNativePtrReturn<R>::value && (IsNativePtrArgument<A>::value && ...);
+		static constexpr size_t argumentsCount = sizeof...(A);
+		template <size_t... I> static void Invoke(R(*function)(Caller*, A...), const godot::Object* self, const GDExtensionConstTypePtr* args, GDExtensionTypePtr returnValue, std::index_sequence<I...>)
+		{
+			Caller caller{ self };
+			if constexpr (std::is_void_v<R>) function(&caller, godot::PtrToArg<A>::convert(args[I])...);
+			else godot::PtrToArg<R>::encode(function(&caller, godot::PtrToArg<A>::convert(args[I])...), returnValue);
+		}
+	};
+	template <auto Function> void InvokeNativePtr(const godot::Object* self, const GDExtensionConstTypePtr* args, GDExtensionTypePtr returnValue)
+	{
+		NativePtrFunction<decltype(Function)>::Invoke(Function, self, args, returnValue, std::make_index_sequence<NativePtrFunction<decltype(Function)>::argumentsCount>());
+	}
+	template <auto Function> constexpr NativePtrInvoker GetNativePtrInvoker()
+	{
+		if constexpr (NativePtrFunction<decltype(Function)>::isSupported) return &InvokeNativePtr<Function>;
+		else return nullptr;
+	}
+
+	// Native Callable Helpers
+	template <auto Function> bool InvokeNativeFunction(const godot::Object* self, const godot::Variant** args, int argsCount, godot::Variant* returnValue)
+	{
+		return InvokeNative(Function, self, args, argsCount, returnValue);
+	}
+	template <auto Function> godot::Callable CreateNativeCallable(godot::Object* target)
+	{
+		return CreateNativeCallable(target, &InvokeNativeFunction<Function>);
+	}
+	template <auto Function> godot::Error ConnectNative(godot::Object* object, const godot::StringName& signalName, godot::Object* target, uint32_t connectFlags = 0)
+	{
+		if (!object) return godot::ERR_INVALID_PARAMETER;
+		godot::Callable nativeCallable = CreateNativeCallable<Function>(target);
+		if (!nativeCallable.is_valid()) return godot::ERR_INVALID_PARAMETER;
+		return object->connect(signalName, nativeCallable, connectFlags);
+	}
+}
+
+// Read-Only Spans Over Engine Owned Packed Arrays [Writable Spans Need A Private Buffer And Keep Variant Path]
+namespace godot
+{
+	template <typename T> struct PtrToArg<jenova::sdk::ConstSpan<T>>
+	{
+		template <typename U = T> _FORCE_INLINE_ static jenova::sdk::ConstSpan<U> convert(const void* p_ptr, const typename jenova::sdk::PackedArrayOf<U>::Type* = nullptr)
+		{
+			const auto* packedArray = reinterpret_cast<const typename jenova::sdk::PackedArrayOf<T>::Type*>(p_ptr);
+			return jenova::sdk::ConstSpan<T>(packedArray->size() ? packedArray->ptr() : nullptr, size_t(packedArray->size()));
+		}
+	};
+	template <typename T> struct PtrToArg<const jenova::sdk::ConstSpan<T>&> : PtrToArg<jenova::sdk::ConstSpan<T>> {};
 }
\ No newline at end of file
@@ -110,6 +110,10 @@ namespace jenova
 			 String RemoveSourcesFromBuildEditorConfigPath				= "jenova/remove_source_codes_from_build";
 			 String CompilerModelConfigPath								= "jenova/compiler_model";
 			 String MultiThreadedCompilationConfigPath					= "jenova/multi_threaded_compilation";
+			 String CompilerWorkerCountConfigPath						= "jenova/compiler_worker_count";
+			 String UsePrecompiledHeaderConfigPath						= "jenova/use_precompiled_header";
+			 String ObjectStoreSizeConfigPath							= "jenova/object_store_size";
+			 String ObjectStoreDirectoryConfigPath						= "jenova/object_store_directory";
 			 String GenerateDebugInformationConfigPath					= "jenova/generate_debug_information";
 			 String InterpreterBackendConfigPath						= "jenova/interpreter_backend";
 			 String BuildAndRunModeConfigPath							= "jenova/build_and_run_mode";
@@ -125,7 +129,9 @@ namespace jenova
 			 String CompilerPackageConfigPath							= "jenova/compiler_package";
 			 String GodotKitPackageConfigPath							= "jenova/godot_kit_package";
 			 String SDKLinkingModeConfigPath							= "jenova/sdk_linking_mode";
+			 String ModuleBuildModeConfigPath							= "jenova/module_build_mode";
 			 String ManagedSafeExecutionConfigPath						= "jenova/managed_safe_execution";
+			 String NativeClassBindingConfigPath						= "jenova/native_class_binding";
 			 String BuildToolButtonEditorConfigPath						= "jenova/build_tool_button_placement";
 
 		private:
@@ -136,6 +142,7 @@ namespace jenova
 			const jenova::EditorVerboseOutput EditorVerboseDefaultOutput = jenova::EditorVerboseOutput::JenovaTerminal;
 			const jenova::InterpreterBackend InterpreterBackendDefaultMode = jenova::InterpreterBackend::TinyCC;
 			const jenova::SDKLinkingMode SDKLinkingDefaultMode = jenova::SDKLinkingMode::Dynamically;
+			const jenova::ModuleBuildMode ModuleBuildDefaultMode = jenova::ModuleBuildMode::Monolithic;
 
 			// Default Compiler
 			#if defined(TARGET_PLATFORM_WINDOWS)
@@ -389,6 +396,9 @@ namespace jenova
 				root_window->connect("focus_entered", callable_mp(this, &JenovaEditorPlugin::OnWindowGainedFocus));
 				root_window->connect("focus_exited", callable_mp(this, &JenovaEditorPlugin::OnWindowLostFocus));
 
+				// Register Frame Events
+				get_tree()->connect("process_frame", callable_mp(this, &JenovaEditorPlugin::OnEditorFrame));
+
 				// All Good
 				return true;
 			}
@@ -400,6 +410,9 @@ namespace jenova
 				root_window->disconnect("focus_entered", callable_mp(this, &JenovaEditorPlugin::OnWindowGainedFocus));
 				root_window->disconnect("focus_exited", callable_mp(this, &JenovaEditorPlugin::OnWindowLostFocus));
 
+				// Unregister Frame Events
+				get_tree()->disconnect("process_frame", callable_mp(this, &JenovaEditorPlugin::OnEditorFrame));
+
 				// All Good
 				return true;
 			}
@@ -456,6 +469,10 @@ namespace jenova
 						if (!editor_settings->has_setting(RemoveSourcesFromBuildEditorConfigPath)) editor_settings->set(RemoveSourcesFromBuildEditorConfigPath, true);
 						if (!editor_settings->has_setting(CompilerModelConfigPath)) editor_settings->set(CompilerModelConfigPath, int32_t(CompilerDefaultModel));
 						if (!editor_settings->has_setting(MultiThreadedCompilationConfigPath)) editor_settings->set(MultiThreadedCompilationConfigPath, true);
+						if (!editor_settings->has_setting(CompilerWorkerCountConfigPath)) editor_settings->set(CompilerWorkerCountConfigPath, 0);
+						if (!editor_settings->has_setting(UsePrecompiledHeaderConfigPath)) editor_settings->set(UsePrecompiledHeaderConfigPath, true);
+						if (!editor_settings->has_setting(ObjectStoreSizeConfigPath)) editor_settings->set(ObjectStoreSizeConfigPath, int64_t(jenova::GlobalSettings::ObjectStoreDefaultCapacity));
+						if (!editor_settings->has_setting(ObjectStoreDirectoryConfigPath)) editor_settings->set(ObjectStoreDirectoryConfigPath, "");
 						if (!editor_settings->has_setting(GenerateDebugInformationConfigPath)) editor_settings->set(GenerateDebugInformationConfigPath, true);
 						if (!editor_settings->has_setting(InterpreterBackendConfigPath)) editor_settings->set(InterpreterBackendConfigPath, int32_t(InterpreterBackendDefaultMode));
 						if (!editor_settings->has_setting(BuildAndRunModeConfigPath)) editor_settings->set(BuildAndRunModeConfigPath, int32_t(BuildAndRunDefaultMode));
@@ -471,7 +488,9 @@ namespace jenova
 						if (!editor_settings->has_setting(CompilerPackageConfigPath)) editor_settings->set(CompilerPackageConfigPath, "Latest");
 						if (!editor_settings->has_setting(GodotKitPackageConfigPath)) editor_settings->set(GodotKitPackageConfigPath, "Latest");
 						if (!editor_settings->has_setting(SDKLinkingModeConfigPath)) editor_settings->set(SDKLinkingModeConfigPath, int32_t(SDKLinkingDefaultMode));
+						if (!editor_settings->has_setting(ModuleBuildModeConfigPath)) editor_settings->set(ModuleBuildModeConfigPath, int32_t(ModuleBuildDefaultMode));
 						if (!editor_settings->has_setting(ManagedSafeExecutionConfigPath)) editor_settings->set(ManagedSafeExecutionConfigPath, true);
+						if (!editor_settings->has_setting(NativeClassBindingConfigPath)) editor_settings->set(NativeClassBindingConfigPath, false);
 						if (!editor_settings->has_setting(BuildToolButtonEditorConfigPath)) editor_settings->set(BuildToolButtonEditorConfigPath, int32_t(BuildToolButtonDefaultPlacement));
 				
 						// Add the Setting Descriptions to The Editor Settings
@@ -496,6 +515,30 @@ namespace jenova
 						editor_settings->add_property_info(MultiThreadedCompilationProperty);
 						editor_settings->set_initial_value(MultiThreadedCompilationConfigPath, true, false);
 
+						// Compiler Worker Count Property
+						PropertyInfo CompilerWorkerCountProperty(Variant::INT, CompilerWorkerCountConfigPath,
+							PropertyHint::PROPERTY_HINT_RANGE, "0,256,1", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(CompilerWorkerCountProperty);
+						editor_settings->set_initial_value(CompilerWorkerCountConfigPath, 0, false);
+
+						// Use Precompiled Header Property
+						PropertyInfo UsePrecompiledHeaderProperty(Variant::BOOL, UsePrecompiledHeaderConfigPath,
+							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(UsePrecompiledHeaderProperty);
+						editor_settings->set_initial_value(UsePrecompiledHeaderConfigPath, true, false);
+
+						// Object Store Size Property [Megabytes, Zero Disables Store]
+						PropertyInfo ObjectStoreSizeProperty(Variant::INT, ObjectStoreSizeConfigPath,
+							PropertyHint::PROPERTY_HINT_RANGE, "0,65536,1,suffix:MB", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ObjectStoreSizeProperty);
+						editor_settings->set_initial_value(ObjectStoreSizeConfigPath, int64_t(jenova::GlobalSettings::ObjectStoreDefaultCapacity), false);
+
+						// Object Store Directory Property [Empty Uses Project Cache]
+						PropertyInfo ObjectStoreDirectoryProperty(Variant::STRING, ObjectStoreDirectoryConfigPath,
+							PropertyHint::PROPERTY_HINT_GLOBAL_DIR, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ObjectStoreDirectoryProperty);
+						editor_settings->set_initial_value(ObjectStoreDirectoryConfigPath, "", false);
+
 						// Generate Debug Information Property
 						PropertyInfo CompilerGenerateDebugInformationProperty(Variant::BOOL, GenerateDebugInformationConfigPath, 
 							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
@@ -591,12 +634,25 @@ namespace jenova
 						editor_settings->add_property_info(SDKLinkingModeProperty);
 						editor_settings->set_initial_value(SDKLinkingModeConfigPath, int32_t(SDKLinkingDefaultMode), false);
 
+						// Module Build Mode Property
+						PropertyInfo ModuleBuildModeProperty(Variant::INT, ModuleBuildModeConfigPath,
+							PropertyHint::PROPERTY_HINT_ENUM, "Single Module (Monolithic),Per-Script Modules (Linux)",
+							PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ModuleBuildModeProperty);
+						editor_settings->set_initial_value(ModuleBuildModeConfigPath, int32_t(ModuleBuildDefaultMode), false);
+
 						// Managed Safe Execution (MSE) Property
 						PropertyInfo ManagedSafeExecutionProperty(Variant::BOOL, ManagedSafeExecutionConfigPath,
 							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
 						editor_settings->add_property_info(ManagedSafeExecutionProperty);
 						editor_settings->set_initial_value(ManagedSafeExecutionConfigPath, true, false);
 
+						// Native Class Binding Property
+						PropertyInfo NativeClassBindingProperty(Variant::BOOL, NativeClassBindingConfigPath,
+							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_RESTART_IF_CHANGED, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(NativeClassBindingProperty);
+						editor_settings->set_initial_value(NativeClassBindingConfigPath, false, false);
+
 						// Build Tool Button Placement Property
 						String buttonPlacements = "Before Main Menu,After Main Menu,Before Stage Selector,After Stage Selector,Before Run Bar,After Run Bar,After Render Method";
 						if (jenova::IsEngineBlazium()) buttonPlacements = "Blazium Default";
@@ -679,11 +735,21 @@ namespace jenova
 				if (!GetEditorSetting(SDKLinkingModeConfigPath, sdkLinkingMode)) return false;
 				jenova::GlobalStorage::SDKLinkingMode = jenova::SDKLinkingMode(int32_t(sdkLinkingMode));
 
+				// Update Module Build Mode
+				Variant moduleBuildMode;
+				if (!GetEditorSetting(ModuleBuildModeConfigPath, moduleBuildMode)) return false;
+				jenova::GlobalStorage::ModuleBuildMode = jenova::ModuleBuildMode(int32_t(moduleBuildMode));
+
 				// Update Managed Safe Execution
 				Variant useManagedSafeExecution;
 				if (!GetEditorSetting(ManagedSafeExecutionConfigPath, useManagedSafeExecution)) return false;
 				jenova::GlobalStorage::UseManagedSafeExecution = bool(useManagedSafeExecution);
 
+				// Update Native Class Binding
+				Variant useNativeClassBinding;
+				if (!GetEditorSetting(NativeClassBindingConfigPath, useNativeClassBinding)) return false;
+				jenova::GlobalStorage::UseNativeClassBinding = bool(useNativeClassBinding);
+
 				// All Good
 				return true;
 			}
@@ -1110,6 +1176,11 @@ namespace jenova
 			void OnWindowGainedFocus()
 			{
 			}
+			void OnEditorFrame()
+			{
+				// Swap Module Staged By Builder And Release Retired Modules
+				JenovaInterpreter::UpdateModuleStaging();
+			}
 			void OnWindowLostFocus()
 			{
 				// Update Build Button Icon
@@ -1378,7 +1449,7 @@ namespace jenova
 				for (size_t i = 0; i < ScriptManager::get_singleton()->get_script_object_count(); i++)
 				{
 					Ref<CPPScript> scriptObject = ScriptManager::get_singleton()->get_script_object(i);
-					usedScripts.insert(std::make_pair(AS_STD_STRING(scriptObject->GetScriptIdentity()), scriptObject));
+					usedScripts.insert(std::make_pair(scriptObject->GetInternedIdentity()->scriptUIDString, scriptObject));
 					jenova::Output("C++ Script Object In Use ([color=#91b553]%s[/color]) Collected.", AS_C_STRING(scriptObject->GetScriptIdentity()));
 				}
 
@@ -1499,6 +1570,9 @@ namespace jenova
 						return false;
 					}
 					preprocessorSettings["PreprocessorDefinitions"] = preprocessorDefinitions;
+
+					// Share Definitions With Compiler [Precompiled Header Must Match Scripts]
+					jenovaCompiler->SetCompilerOption("PreprocessorDefinitions", preprocessorDefinitions);
 				}
 
 				// Collect Scripts & Preprocess Them
@@ -1510,7 +1584,7 @@ namespace jenova
 					{
 						// Get C++ Script Object
 						Ref<CPPScript> scriptResource = Object::cast_to<CPPScript>(cppResource.ptr());
-						bool isUsedScript = usedScripts.contains(AS_STD_STRING(scriptResource->GetScriptIdentity()));
+						bool isUsedScript = usedScripts.contains(scriptResource->GetInternedIdentity()->scriptUIDString);
 
 						// Verbose
 						jenova::Output("Preprocessing C++ Script Resource ([color=#70a9d4]%s[/color]) [[color=#91b553]%s[/color]] [%s]",
@@ -1523,6 +1597,10 @@ namespace jenova
 						// Preprocess Source
 						String preprocessedSource = jenovaCompiler->PreprocessScript(cppResource, preprocessorSettings);
 
+						// Generate Native Invokers [Shared By All Compilers]
+						std::string nativeInvokers = jenova::GenerateNativeInvokersFromScript(AS_STD_STRING(preprocessedSource), AS_STD_STRING(scriptResource->GetScriptIdentity()));
+						if (!nativeInvokers.empty()) preprocessedSource += String::utf8(nativeInvokers.c_str());
+
 						// Create Script Module
 						jenova::ScriptModule scriptModule;
 						scriptModule.scriptFilename = scriptResource->get_path();
@@ -1612,8 +1690,11 @@ namespace jenova
 						return false;
 					}
 
-					// Check If Any Compile Was Done
-					if (compilerResult.scriptsCount == 0)
+					// Report Objects Restored From Object Store
+					if (compilerResult.scriptsRestored != 0) jenova::Output("Restored ([color=#53b5ab]%d[/color]) Script Object%s From Object Store.", compilerResult.scriptsRestored, compilerResult.scriptsRestored == 1 ? "" : "s");
+
+					// Check If Any Compile Was Done [Restored Objects Still Require Linking]
+					if (compilerResult.scriptsCount == 0 && compilerResult.scriptsRestored == 0)
 					{
 						jenova::OutputColored("#2ebc78", "Falling Back to Previous Build, No Change Detected. Fallback Time : [color=#c8e38a]%f ms[/color]", JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaCompileMT"));
 					
@@ -1728,19 +1809,13 @@ namespace jenova
 				}
 				else
 				{
-					// Pause Tree
-					get_tree()->set_pause(true);
-
-					// Reloading
-					if (!JenovaInterpreter::ReloadModule(buildResult))
+					// Reloading [New Module Is Prepared On Task Thread And Swapped In At Next Frame, Editor Keeps Running]
+					if (!JenovaInterpreter::StageModuleFromBuild(buildResult))
 					{
-						jenova::Error("Jenova Interpreter", "Unable to Reload Compiled Jenova Module, Check for Missing Dependencies.");
+						jenova::Error("Jenova Interpreter", "Unable to Stage Compiled Jenova Module, Another Reload Is In Progress.");
 						DisposeCompiler();
 						return false;
 					}
-				
-					// Resume Tree
-					get_tree()->set_pause(false);
 				}
 
 				// Update Script Instances 
@@ -1989,18 +2064,12 @@ namespace jenova
 					}
 					else
 					{
-						// Pause Tree
-						get_tree()->set_pause(true);
-
-						// Reloading
-						if (!JenovaInterpreter::ReloadModule(buildResult))
+						// Reloading [New Module Is Prepared On Task Thread And Swapped In At Next Frame, Editor Keeps Running]
+						if (!JenovaInterpreter::StageModuleFromBuild(buildResult))
 						{
-							jenova::Error("Jenova Interpreter", "Unable to Reload Bootstrapped Jenova Module, Check for Missing Dependencies.");
+							jenova::Error("Jenova Interpreter", "Unable to Stage Bootstrapped Jenova Module, Another Reload Is In Progress.");
 							return false;
 						}
-
-						// Resume Tree
-						get_tree()->set_pause(false);
 					}
 
 					// Release Buffers
@@ -2038,6 +2107,14 @@ namespace jenova
 				// Get Compiler Extra Settings
 				Variant useMultiThreading;
 				if (!GetEditorSetting(MultiThreadedCompilationConfigPath, useMultiThreading)) return false;
+				Variant compilerWorkerCount;
+				if (!GetEditorSetting(CompilerWorkerCountConfigPath, compilerWorkerCount)) compilerWorkerCount = 0;
+				Variant usePrecompiledHeader;
+				if (!GetEditorSetting(UsePrecompiledHeaderConfigPath, usePrecompiledHeader)) usePrecompiledHeader = true;
+				Variant objectStoreSize;
+				if (!GetEditorSetting(ObjectStoreSizeConfigPath, objectStoreSize)) objectStoreSize = int64_t(jenova::GlobalSettings::ObjectStoreDefaultCapacity);
+				Variant objectStoreDirectory;
+				if (!GetEditorSetting(ObjectStoreDirectoryConfigPath, objectStoreDirectory)) objectStoreDirectory = "";
 				Variant generateDebugInformation;
 				if (!GetEditorSetting(GenerateDebugInformationConfigPath, generateDebugInformation)) return false;
 				Variant additionalIncludeDirectories;
@@ -2122,6 +2199,30 @@ namespace jenova
 					DisposeCompiler();
 					return false;
 				};
+				if (!jenovaCompiler->SetCompilerOption("cpp_compiler_workers", int64_t(compilerWorkerCount)))
+				{
+					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Compiler Worker Count'");
+					DisposeCompiler();
+					return false;
+				};
+				if (!jenovaCompiler->SetCompilerOption("cpp_precompiled_header", bool(usePrecompiledHeader)))
+				{
+					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Use Precompiled Header'");
+					DisposeCompiler();
+					return false;
+				};
+				if (!jenovaCompiler->SetCompilerOption("cpp_object_store_size", int64_t(objectStoreSize)))
+				{
+					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Object Store Size'");
+					DisposeCompiler();
+					return false;
+				};
+				if (!jenovaCompiler->SetCompilerOption("cpp_object_store_path", String(objectStoreDirectory)))
+				{
+					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Object Store Directory'");
+					DisposeCompiler();
+					return false;
+				};
 				if (!jenovaCompiler->SetCompilerOption("cpp_generate_debug_info", bool(generateDebugInformation)))
 				{
 					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Generate Debug Information'");
@@ -2381,6 +2482,10 @@ namespace jenova
 				if (setting_key == std::string("remove_source_codes_from_build")) return RemoveSourcesFromBuildEditorConfigPath;
 				if (setting_key == std::string("compiler_model")) return CompilerModelConfigPath;
 				if (setting_key == std::string("multi_threaded_compilation")) return MultiThreadedCompilationConfigPath;
+				if (setting_key == std::string("compiler_worker_count")) return CompilerWorkerCountConfigPath;
+				if (setting_key == std::string("use_precompiled_header")) return UsePrecompiledHeaderConfigPath;
+				if (setting_key == std::string("object_store_size")) return ObjectStoreSizeConfigPath;
+				if (setting_key == std::string("object_store_directory")) return ObjectStoreDirectoryConfigPath;
 				if (setting_key == std::string("generate_debug_information")) return GenerateDebugInformationConfigPath;
 				if (setting_key == std::string("interpreter_backend")) return InterpreterBackendConfigPath;
 				if (setting_key == std::string("build_and_run_mode")) return BuildAndRunModeConfigPath;
@@ -2396,7 +2501,9 @@ namespace jenova
 				if (setting_key == std::string("compiler_package")) return CompilerPackageConfigPath;
 				if (setting_key == std::string("godot_kit_package")) return GodotKitPackageConfigPath;
 				if (setting_key == std::string("sdk_linking_mode")) return SDKLinkingModeConfigPath;
+				if (setting_key == std::string("module_build_mode")) return ModuleBuildModeConfigPath;
 				if (setting_key == std::string("managed_safe_execution")) return ManagedSafeExecutionConfigPath;
+				if (setting_key == std::string("native_class_binding")) return NativeClassBindingConfigPath;
 				if (setting_key == std::string("build_toolbutton_placement")) return BuildToolButtonEditorConfigPath;
 				return String("jenova/unknown");
 			}
@@ -4064,6 +4171,9 @@ namespace jenova
 			{
 				// Rise Events
 				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::PhysicsProcess, &p_delta, sizeof(p_delta));
+
+				// Run Native Script Physics Updates
+				JenovaScriptManager::get_singleton()->run_native_updates(p_delta, true);
 			}
 			void _exit_tree() override
 			{
@@ -4100,6 +4210,9 @@ namespace jenova
 				RenderingServer::get_singleton()->connect("frame_pre_draw", callable_mp(this, &JenovaRuntime::OnFrameEnd));
 				RenderingServer::get_singleton()->connect("frame_post_draw", callable_mp(this, &JenovaRuntime::OnFramePresent));
 
+				// Keep Runtime Processing While Paused [Native Updates Check Each Owner Node's Own Process Mode]
+				this->set_process_mode(PROCESS_MODE_ALWAYS);
+
 				// Add Runtime to Tree
 				jenova::GetSceneTree()->get_root()->add_child(this);
 
@@ -4151,9 +4264,10 @@ namespace jenova
 				// Handle Remote Commands
 				if (msgCommand == "Reload" && QUERY_ENGINE_MODE(Debug))
 				{
-					if (!JenovaInterpreter::DeployFromDatabase(jenova::GlobalSettings::DefaultModuleDatabaseFile))
+					// Stage Module In Background, Swap Happens At Next Frame Boundary
+					if (!JenovaInterpreter::StageModuleFromDatabase(jenova::GlobalSettings::DefaultModuleDatabaseFile))
 					{
-						jenova::Warning("Jenova Runtime", "Module Cache Cannot Be Deployed, Possible Corruption.");
+						jenova::Warning("Jenova Runtime", "Module Cache Cannot Be Staged, Another Reload Is In Progress.");
 						return false;
 					}
 				}
@@ -4165,6 +4279,12 @@ namespace jenova
 			{
 				// Rise Events
 				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::FrameBegin, nullptr, 0);
+
+				// Swap Staged Module And Release Retired Modules
+				JenovaInterpreter::UpdateModuleStaging();
+
+				// Run Native Script Updates
+				JenovaScriptManager::get_singleton()->run_native_updates(this->get_process_delta_time(), false);
 			}
 			void OnFrameIdle()
 			{
@@ -4397,6 +4517,9 @@ namespace jenova
 				CPPHeaderResourceSaver::deinit();
 				JenovaScriptManager::deinit();
 
+				// Unregister Script Native Classes
+				JenovaInterpreter::ReleaseNativeClasses();
+
 				// Uninitialize Clektron Engine
 				Clektron::deinit();
 
@@ -4602,6 +4725,9 @@ namespace jenova
 								jenova::ReplaceAllMatchesWithString(scriptSourceCode, " OnInput", " _input");
 								jenova::ReplaceAllMatchesWithString(scriptSourceCode, " OnUserInterfaceInput", " _gui_input");
 
+								// Generate Native Invokers
+								scriptSourceCode += jenova::GenerateNativeInvokersFromScript(scriptSourceCode, sourceIdentity);
+
 								// Write Preprocessed Source
 								std::string outputPath = cacheDirectory + std::filesystem::path(inputFile).stem().string() + "_" + sourceIdentity + ".cpp";
 								if (!jenova::WriteStdStringToFile(outputPath, scriptSourceCode))
@@ -4763,6 +4889,7 @@ namespace jenova
 		jenova::ChangesTriggerMode CurrentChangesTriggerMode = jenova::ChangesTriggerMode::DoNothing;
 		jenova::EditorVerboseOutput CurrentEditorVerboseOutput = jenova::EditorVerboseOutput::StandardOutput;
 		jenova::SDKLinkingMode SDKLinkingMode = jenova::SDKLinkingMode::Dynamically;
+		jenova::ModuleBuildMode ModuleBuildMode = jenova::ModuleBuildMode::Monolithic;
 
 		// Database
 		std::string CurrentJenovaCacheDirectory = "";
@@ -4774,6 +4901,7 @@ namespace jenova
 		bool UseHotReloadAtRuntime = true;
 		bool UseMonospaceFontForTerminal = true;
 		bool UseManagedSafeExecution = true;
+		bool UseNativeClassBinding = false;
 
 		// Values
 		int TerminalDefaultFontSize = 12;
@@ -6349,13 +6477,34 @@ namespace jenova
 			serializer["ModuleCount"] = scriptModules.size();
 
 			// Cache Script Headers Hashes
+			std::unordered_map<std::string, std::string> projectHeaders;
 			for (const auto& scriptHeader : scriptHeaders)
 			{
 				// Update Hashes
-				serializer["Headers"][AS_STD_STRING(jenova::GenerateStandardUIDFromPath(scriptHeader))] = AS_STD_STRING(jenova::GenerateMD5HashFromFile(scriptHeader));
+				std::string scriptHeaderUID = AS_STD_STRING(jenova::GenerateStandardUIDFromPath(scriptHeader));
+				serializer["Headers"][scriptHeaderUID] = AS_STD_STRING(jenova::GenerateMD5HashFromFile(scriptHeader));
+				projectHeaders[jenova::NormalizeDependencyPath(AS_STD_STRING(scriptHeader))] = scriptHeaderUID;
 			}
 			serializer["HeaderCount"] = scriptHeaders.size();
 
+			// Cache Script Include Graph [Only Project Headers Are Tracked, Missing Records Fall Back to Full Invalidation]
+			if (!skipHashes)
+			{
+				for (const auto& scriptModule : scriptModules)
+				{
+					std::string dependencyFile = AS_STD_STRING(scriptModule.scriptCacheFile) + jenova::GlobalSettings::ScriptDependencyFileExtension;
+					if (!std::filesystem::exists(dependencyFile)) dependencyFile = AS_STD_STRING(scriptModule.scriptCacheFile) + jenova::GlobalSettings::ScriptSourceDependenciesFileExtension;
+					if (!std::filesystem::exists(dependencyFile)) continue;
+					jenova::json_t scriptDependencies = jenova::json_t::array();
+					for (const auto& dependency : ParseScriptDependencyFile(dependencyFile))
+					{
+						auto projectHeader = projectHeaders.find(jenova::NormalizeDependencyPath(dependency));
+						if (projectHeader != projectHeaders.end()) scriptDependencies.push_back(projectHeader->second);
+					}
+					serializer["Dependencies"][AS_STD_STRING(scriptModule.scriptUID)] = scriptDependencies;
+				}
+			}
+
 			// Add Timestamp
 			serializer["BuildTimestamp"] = time(NULL);
 
@@ -6382,6 +6531,119 @@ namespace jenova
 			return false;
 		}
 	}
+	size_t InvalidateBuildCacheByHeaderChanges(jenova::json_t& buildCacheDatabase, const jenova::HeaderList& scriptHeaders)
+	{
+		// Validate Database
+		if (!buildCacheDatabase.contains("Headers") || !buildCacheDatabase.contains("Modules")) return 0;
+
+		// Collect Changed Headers [Modified or Removed]
+		std::unordered_set<std::string> changedHeaders;
+		std::unordered_set<std::string> currentHeaders;
+		for (const auto& scriptHeader : scriptHeaders)
+		{
+			std::string scriptHeaderUID = AS_STD_STRING(jenova::GenerateStandardUIDFromPath(scriptHeader));
+			currentHeaders.insert(scriptHeaderUID);
+			if (!buildCacheDatabase["Headers"].contains(scriptHeaderUID)) continue;
+			if (AS_STD_STRING(jenova::GenerateMD5HashFromFile(scriptHeader)) != buildCacheDatabase["Headers"][scriptHeaderUID].get<std::string>()) changedHeaders.insert(scriptHeaderUID);
+		}
+		for (const auto& cachedHeader : buildCacheDatabase["Headers"].items())
+		{
+			if (!currentHeaders.contains(cachedHeader.key())) changedHeaders.insert(cachedHeader.key());
+		}
+		if (changedHeaders.empty()) return 0;
+
+		// Reset Cache of Scripts Including Changed Headers [Scripts Without Include Graph Are Always Reset]
+		size_t invalidatedModules = 0;
+		for (auto& scriptModule : buildCacheDatabase["Modules"].items())
+		{
+			bool isAffected = true;
+			if (buildCacheDatabase.contains("Dependencies") && buildCacheDatabase["Dependencies"].contains(scriptModule.key()))
+			{
+				isAffected = false;
+				for (const auto& dependency : buildCacheDatabase["Dependencies"][scriptModule.key()])
+				{
+					if (changedHeaders.contains(dependency.get<std::string>())) { isAffected = true; break; }
+				}
+			}
+			if (isAffected)
+			{
+				scriptModule.value() = "No Hash";
+				invalidatedModules++;
+			}
+		}
+
+		// Verbose
+		jenova::VerboseByID(__LINE__, "Header Changes Detected (%zu), Invalidated Script Modules (%zu)", changedHeaders.size(), invalidatedModules);
+		return invalidatedModules;
+	}
+	std::vector<std::string> ParseScriptDependencyFile(const std::string& dependencyFile)
+	{
+		std::vector<std::string> dependencies;
+		std::string dependencyContent = jenova::ReadStdStringFromFile(dependencyFile);
+		if (dependencyContent.empty()) return dependencies;
+
+		// Microsoft Source Dependencies [JSON]
+		if (std::filesystem::path(dependencyFile).extension() == jenova::GlobalSettings::ScriptSourceDependenciesFileExtension)
+		{
+			try
+			{
+				jenova::json_t sourceDependencies = jenova::json_t::parse(dependencyContent);
+				if (sourceDependencies.contains("Data") && sourceDependencies["Data"].contains("Includes"))
+				{
+					for (const auto& includeFile : sourceDependencies["Data"]["Includes"]) dependencies.push_back(includeFile.get<std::string>());
+				}
+			}
+			catch (const std::exception&) {}
+			return dependencies;
+		}
+
+		// Make Dependency Rules [Target Followed By Escaped Prerequisites]
+		size_t ruleSeparator = std::string::npos;
+		for (size_t i = 0; i + 1 < dependencyContent.size(); i++)
+		{
+			if (dependencyContent[i] == ':' && std::isspace((unsigned char)dependencyContent[i + 1])) { ruleSeparator = i; break; }
+		}
+		if (ruleSeparator == std::string::npos) return dependencies;
+		std::string currentPath;
+		for (size_t i = ruleSeparator + 1; i < dependencyContent.size(); i++)
+		{
+			char c = dependencyContent[i];
+			if (c == '\\' && i + 1 < dependencyContent.size())
+			{
+				char n = dependencyContent[i + 1];
+				if (n == ' ' || n == '#') { currentPath += n; i++; continue; }
+				if (n == '\n' || n == '\r') { c = ' '; i++; }
+			}
+			else if (c == '$' && i + 1 < dependencyContent.size() && dependencyContent[i + 1] == '$')
+			{
+				currentPath += c; i++; continue;
+			}
+			if (std::isspace((unsigned char)c))
+			{
+				if (!currentPath.empty()) dependencies.push_back(currentPath);
+				currentPath.clear();
+				continue;
+			}
+			currentPath += c;
+		}
+		if (!currentPath.empty()) dependencies.push_back(currentPath);
+		return dependencies;
+	}
+	std::string NormalizeDependencyPath(const std::string& dependencyPath)
+	{
+		// Compilers Report Includes Relative to Project Directory [Same As Editor Working Directory]
+		std::error_code errorCode;
+		std::filesystem::path normalizedPath = std::filesystem::weakly_canonical(std::filesystem::absolute(dependencyPath, errorCode), errorCode);
+		if (errorCode) normalizedPath = std::filesystem::path(dependencyPath).lexically_normal();
+		std::string normalizedString = normalizedPath.generic_string();
+
+		// Windows Paths Are Case Insensitive
+		#ifdef TARGET_PLATFORM_WINDOWS
+			std::transform(normalizedString.begin(), normalizedString.end(), normalizedString.begin(), [](unsigned char c) { return std::tolower(c); });
+		#endif
+
+		return normalizedString;
+	}
 	std::string GetLoadedModulePath(jenova::ModuleHandle moduleHandle)
 	{
 		// Windows Implementation
@@ -6704,7 +6966,7 @@ namespace jenova
 				scriptCollection.scriptModules.push_back(scriptModule);
 				scriptCollection.scriptFilesFullPath.push_back(cppFilePath.string());
 				scriptCollection.scriptFilesReleative.push_back(relativePath.string());
-				scriptCollection.scriptIdentities.push_back(AS_STD_STRING(cppScript->GetScriptIdentity()));
+				scriptCollection.scriptIdentities.push_back(cppScript->GetInternedIdentity()->scriptUIDString);
 
 				// Collect Directories
 				if (!cppScript->is_built_in())
@@ -7319,467 +7581,338 @@ namespace jenova
 		}
 		return "Missing-GodotKit-1.0.0";
 	}
-	std::string ResolveVariantValueAsString(const Variant* variantValue, jenova::PointerList& ptrList)
-	{
+	// C Layout Of Trivially Copyable Aggregates [Caller Stubs Pass Them By Value, Non-Trivial Types Go By Hidden Reference]
+	#ifdef REAL_T_IS_DOUBLE
+	#define JENOVA_REAL_LAYOUT(n) "double v[" #n "];"
+	#else
+	#define JENOVA_REAL_LAYOUT(n) "float v[" #n "];"
+	#endif
+	template <typename T> jenova::MarshalTypeOperations CreateMarshalOperations(Variant::Type variantType, jenova::VariantStorage variantStorage, const char* valueLayout = nullptr)
+	{
+		jenova::MarshalTypeOperations typeOperations;
+		typeOperations.typeSize = sizeof(T);
+		typeOperations.variantType = variantType;
+		typeOperations.variantStorage = variantStorage;
+		typeOperations.callerType = "void*";
+		typeOperations.valueLayout = std::is_trivially_copyable_v<T> ? valueLayout : nullptr;
+		typeOperations.constructFromVariant = [](void* valueStorage, const Variant& variantValue) { new (valueStorage) T(variantValue); };
+		typeOperations.assignToVariant = [](Variant& variantValue, const void* valueStorage) { variantValue = *static_cast<const T*>(valueStorage); };
+		typeOperations.destructor = [](void* valueStorage) { static_cast<T*>(valueStorage)->~T(); };
+		return typeOperations;
+	}
+	template <typename P, bool Writable> struct SpanArgument
+	{
+		// Layout Matches jenova::sdk::ConstSpan/Span, Holder Keeps Shared Buffer Alive During Call [Writable Holder Detaches Once, Interpreter Assigns It Back]
+		const void* data = nullptr;
+		size_t size = 0;
+		P holder;
+		SpanArgument(const Variant& variantValue) : holder(variantValue)
+		{
+			size = size_t(holder.size());
+			if (size == 0) return;
+			if constexpr (Writable) data = holder.ptrw();
+			else data = holder.ptr();
+		}
+	};
+	template <typename P, bool Writable> jenova::MarshalTypeOperations CreateSpanMarshalOperations(Variant::Type variantType)
+	{
+		jenova::MarshalTypeOperations typeOperations;
+		typeOperations.typeSize = sizeof(SpanArgument<P, Writable>);
+		typeOperations.variantType = variantType;
+		typeOperations.variantStorage = jenova::VariantStorage::View;
+		typeOperations.callerType = "void*";
+		typeOperations.writesBack = Writable;
+		typeOperations.constructFromVariant = [](void* valueStorage, const Variant& variantValue) { new (valueStorage) SpanArgument<P, Writable>(variantValue); };
+		typeOperations.assignToVariant = [](Variant& variantValue, const void* valueStorage) { variantValue = static_cast<const SpanArgument<P, Writable>*>(valueStorage)->holder; };
+		typeOperations.destructor = [](void* valueStorage) { static_cast<SpanArgument<P, Writable>*>(valueStorage)->~SpanArgument(); };
+		return typeOperations;
+	}
+	jenova::MarshalTypeTag GetSpanMarshalTypeTag(const std::string& elementTypeName, bool isWritable)
+	{
+		// Resolve Packed Array Backing Span Element
+		jenova::MarshalTypeTag spanTag = jenova::MarshalTypeTag::Variant;
+		if (elementTypeName == "uint8_t" || elementTypeName == "unsignedchar") spanTag = jenova::MarshalTypeTag::ByteSpan;
+		if (elementTypeName == "int" || elementTypeName == "int32_t") spanTag = jenova::MarshalTypeTag::Int32Span;
+		if (elementTypeName == "int64_t" || elementTypeName == "longlong" || elementTypeName == "__int64") spanTag = jenova::MarshalTypeTag::Int64Span;
+		if (elementTypeName == "long") spanTag = sizeof(long) == sizeof(int64_t) ? jenova::MarshalTypeTag::Int64Span : jenova::MarshalTypeTag::Int32Span;
+		if (elementTypeName == "float") spanTag = jenova::MarshalTypeTag::Float32Span;
+		if (elementTypeName == "double") spanTag = jenova::MarshalTypeTag::Float64Span;
+		if (elementTypeName == "Vector2") spanTag = jenova::MarshalTypeTag::Vector2Span;
+		if (elementTypeName == "Vector3") spanTag = jenova::MarshalTypeTag::Vector3Span;
+		if (elementTypeName == "Color") spanTag = jenova::MarshalTypeTag::ColorSpan;
+		if (elementTypeName == "Vector4") spanTag = jenova::MarshalTypeTag::Vector4Span;
+		if (spanTag == jenova::MarshalTypeTag::Variant || !isWritable) return spanTag;
+
+		// Writable Tags Mirror Read-Only Tags
+		return jenova::MarshalTypeTag(size_t(spanTag) + size_t(jenova::MarshalTypeTag::WritableByteSpan) - size_t(jenova::MarshalTypeTag::ByteSpan));
+	}
+	jenova::MarshalTypeOperations CreateScalarMarshalOperations(Variant::Type variantType, const char* callerType)
+	{
+		jenova::MarshalTypeOperations typeOperations;
+		typeOperations.typeSize = sizeof(uintptr_t);
+		typeOperations.variantType = variantType;
+		typeOperations.variantStorage = jenova::VariantStorage::Scalar;
+		typeOperations.callerType = callerType;
+		return typeOperations;
+	}
+	jenova::MarshalTypeTag GetMarshalTypeTagFromStdString(const std::string& typeName)
+	{
+		// Clean Type Name [Qualifiers, References, Namespace]
+		std::string typeNameCleaned = typeName;
+		jenova::ReplaceAllMatchesWithString(typeNameCleaned, "const ", "");
+		jenova::ReplaceAllMatchesWithString(typeNameCleaned, "const", "");
+		jenova::ReplaceAllMatchesWithString(typeNameCleaned, "class ", "");
+		jenova::ReplaceAllMatchesWithString(typeNameCleaned, "struct ", "");
+		jenova::ReplaceAllMatchesWithString(typeNameCleaned, "&", "");
+		jenova::ReplaceAllMatchesWithString(typeNameCleaned, "godot::", "");
+		jenova::ReplaceAllMatchesWithString(typeNameCleaned, " ", "");
+
 		// Atomic types
-		if (variantValue->get_type() == Variant::BOOL) return (bool(*variantValue)) ? "true" : "false";
-		if (variantValue->get_type() == Variant::FLOAT) return jenova::Format("%lf", double(*variantValue));
-		if (variantValue->get_type() == Variant::INT) return jenova::Format("%lld", int64_t(*variantValue));
-		if (variantValue->get_type() == Variant::STRING)
-		{
-			String* value = new String(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
+		if (typeNameCleaned == "void") return jenova::MarshalTypeTag::Void;
+		if (typeNameCleaned == "bool") return jenova::MarshalTypeTag::Bool;
+		if (typeNameCleaned == "int" || typeNameCleaned == "int32_t") return jenova::MarshalTypeTag::Int32;
+		if (typeNameCleaned == "unsignedint" || typeNameCleaned == "uint32_t") return jenova::MarshalTypeTag::UInt32;
+		if (typeNameCleaned == "int64_t" || typeNameCleaned == "longlong" || typeNameCleaned == "__int64" || typeNameCleaned == "longlongint") return jenova::MarshalTypeTag::Int64;
+		if (typeNameCleaned == "uint64_t" || typeNameCleaned == "unsignedlonglong" || typeNameCleaned == "unsigned__int64" || typeNameCleaned == "unsignedlonglongint") return jenova::MarshalTypeTag::UInt64;
+		if (typeNameCleaned == "float") return jenova::MarshalTypeTag::Float;
+		if (typeNameCleaned == "double") return jenova::MarshalTypeTag::Double;
+		if (typeNameCleaned == "String") return jenova::MarshalTypeTag::String;
+
+		// Object Pointers
+		if (!typeNameCleaned.empty() && typeNameCleaned.back() == '*') return jenova::MarshalTypeTag::Object;
+
+		// Math & Misc types
+		if (typeNameCleaned == "Vector2") return jenova::MarshalTypeTag::Vector2;
+		if (typeNameCleaned == "Vector2i") return jenova::MarshalTypeTag::Vector2i;
+		if (typeNameCleaned == "Rect2") return jenova::MarshalTypeTag::Rect2;
+		if (typeNameCleaned == "Rect2i") return jenova::MarshalTypeTag::Rect2i;
+		if (typeNameCleaned == "Vector3") return jenova::MarshalTypeTag::Vector3;
+		if (typeNameCleaned == "Vector3i") return jenova::MarshalTypeTag::Vector3i;
+		if (typeNameCleaned == "Transform2D") return jenova::MarshalTypeTag::Transform2D;
+		if (typeNameCleaned == "Vector4") return jenova::MarshalTypeTag::Vector4;
+		if (typeNameCleaned == "Vector4i") return jenova::MarshalTypeTag::Vector4i;
+		if (typeNameCleaned == "Plane") return jenova::MarshalTypeTag::Plane;
+		if (typeNameCleaned == "Quaternion") return jenova::MarshalTypeTag::Quaternion;
+		if (typeNameCleaned == "AABB") return jenova::MarshalTypeTag::AABB;
+		if (typeNameCleaned == "Basis") return jenova::MarshalTypeTag::Basis;
+		if (typeNameCleaned == "Transform3D") return jenova::MarshalTypeTag::Transform3D;
+		if (typeNameCleaned == "Projection") return jenova::MarshalTypeTag::Projection;
+		if (typeNameCleaned == "Color") return jenova::MarshalTypeTag::Color;
+		if (typeNameCleaned == "StringName") return jenova::MarshalTypeTag::StringName;
+		if (typeNameCleaned == "NodePath") return jenova::MarshalTypeTag::NodePath;
+		if (typeNameCleaned == "RID") return jenova::MarshalTypeTag::RID;
+		if (typeNameCleaned == "Callable") return jenova::MarshalTypeTag::Callable;
+		if (typeNameCleaned == "Signal") return jenova::MarshalTypeTag::Signal;
+		if (typeNameCleaned == "Dictionary") return jenova::MarshalTypeTag::Dictionary;
+		if (typeNameCleaned == "Array") return jenova::MarshalTypeTag::Array;
 
-		// Math types
-		if (variantValue->get_type() == Variant::VECTOR2)
-		{
-			Vector2* value = new Vector2(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::VECTOR2I)
-		{
-			Vector2i* value = new Vector2i(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::VECTOR3)
-		{
-			Vector3* value = new Vector3(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::VECTOR3I)
-		{
-			Vector3i* value = new Vector3i(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::RECT2)
-		{
-			Rect2* value = new Rect2(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::RECT2I)
-		{
-			Rect2i* value = new Rect2i(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::VECTOR4)
-		{
-			Vector4* value = new Vector4(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::VECTOR4I)
-		{
-			Vector4i* value = new Vector4i(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::TRANSFORM2D)
-		{
-			Transform2D* value = new Transform2D(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PLANE)
-		{
-			Plane* value = new Plane(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::QUATERNION)
-		{
-			Quaternion* value = new Quaternion(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::AABB)
-		{
-			AABB* value = new AABB(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::BASIS)
-		{
-			Basis* value = new Basis(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::TRANSFORM3D)
-		{
-			Transform3D* value = new Transform3D(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PROJECTION)
-		{
-			Projection* value = new Projection(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
+		// Typed arrays
+		if (typeNameCleaned == "PackedByteArray") return jenova::MarshalTypeTag::PackedByteArray;
+		if (typeNameCleaned == "PackedInt32Array") return jenova::MarshalTypeTag::PackedInt32Array;
+		if (typeNameCleaned == "PackedInt64Array") return jenova::MarshalTypeTag::PackedInt64Array;
+		if (typeNameCleaned == "PackedFloat32Array") return jenova::MarshalTypeTag::PackedFloat32Array;
+		if (typeNameCleaned == "PackedFloat64Array") return jenova::MarshalTypeTag::PackedFloat64Array;
+		if (typeNameCleaned == "PackedStringArray") return jenova::MarshalTypeTag::PackedStringArray;
+		if (typeNameCleaned == "PackedVector2Array") return jenova::MarshalTypeTag::PackedVector2Array;
+		if (typeNameCleaned == "PackedVector3Array") return jenova::MarshalTypeTag::PackedVector3Array;
+		if (typeNameCleaned == "PackedColorArray") return jenova::MarshalTypeTag::PackedColorArray;
+		if (typeNameCleaned == "PackedVector4Array") return jenova::MarshalTypeTag::PackedVector4Array;
+		if (typeNameCleaned.rfind("TypedArray<", 0) == 0) return jenova::MarshalTypeTag::Array;
+
+		// References
+		if (typeNameCleaned.rfind("Ref<", 0) == 0) return jenova::MarshalTypeTag::Reference;
+
+		// Array Spans [Views Into Packed Array Buffers]
+		jenova::ReplaceAllMatchesWithString(typeNameCleaned, "jenova::sdk::", "");
+		if (!typeNameCleaned.empty() && typeNameCleaned.back() == '>')
+		{
+			if (typeNameCleaned.rfind("ConstSpan<", 0) == 0) return GetSpanMarshalTypeTag(typeNameCleaned.substr(10, typeNameCleaned.size() - 11), false);
+			if (typeNameCleaned.rfind("Span<", 0) == 0) return GetSpanMarshalTypeTag(typeNameCleaned.substr(5, typeNameCleaned.size() - 6), true);
+		}
+
+		// Default Case [Variant & Unknown Types]
+		return jenova::MarshalTypeTag::Variant;
+	}
+	bool IsSpanTypeName(const std::string& typeName)
+	{
+		// Spans Resolving to Variant Tag Have Unsupported Element Types [Variant Layout Can't Stand In For Span]
+		return typeName.find("Span<") != std::string::npos;
+	}
+	const jenova::MarshalTypeOperations& GetMarshalTypeOperations(jenova::MarshalTypeTag typeTag)
+	{
+		static const std::vector<jenova::MarshalTypeOperations> marshalTypeOperations = []()
+		{
+			std::vector<jenova::MarshalTypeOperations> typeOperations(size_t(jenova::MarshalTypeTag::Variant) + 1);
+			typeOperations[size_t(jenova::MarshalTypeTag::Void)] = CreateScalarMarshalOperations(Variant::NIL, "void");
+			typeOperations[size_t(jenova::MarshalTypeTag::Bool)] = CreateScalarMarshalOperations(Variant::BOOL, "bool");
+			typeOperations[size_t(jenova::MarshalTypeTag::Int32)] = CreateScalarMarshalOperations(Variant::INT, "int");
+			typeOperations[size_t(jenova::MarshalTypeTag::UInt32)] = CreateScalarMarshalOperations(Variant::INT, "unsigned int");
+			typeOperations[size_t(jenova::MarshalTypeTag::Int64)] = CreateScalarMarshalOperations(Variant::INT, "long long");
+			typeOperations[size_t(jenova::MarshalTypeTag::UInt64)] = CreateScalarMarshalOperations(Variant::INT, "unsigned long long");
+			typeOperations[size_t(jenova::MarshalTypeTag::Float)] = CreateScalarMarshalOperations(Variant::FLOAT, "float");
+			typeOperations[size_t(jenova::MarshalTypeTag::Double)] = CreateScalarMarshalOperations(Variant::FLOAT, "double");
+			typeOperations[size_t(jenova::MarshalTypeTag::Object)] = CreateScalarMarshalOperations(Variant::OBJECT, "void*");
+			typeOperations[size_t(jenova::MarshalTypeTag::String)] = CreateMarshalOperations<godot::String>(Variant::STRING, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::Vector2)] = CreateMarshalOperations<godot::Vector2>(Variant::VECTOR2, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(2));
+			typeOperations[size_t(jenova::MarshalTypeTag::Vector2i)] = CreateMarshalOperations<godot::Vector2i>(Variant::VECTOR2I, jenova::VariantStorage::Copied, "int v[2];");
+			typeOperations[size_t(jenova::MarshalTypeTag::Rect2)] = CreateMarshalOperations<godot::Rect2>(Variant::RECT2, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(4));
+			typeOperations[size_t(jenova::MarshalTypeTag::Rect2i)] = CreateMarshalOperations<godot::Rect2i>(Variant::RECT2I, jenova::VariantStorage::Copied, "int v[4];");
+			typeOperations[size_t(jenova::MarshalTypeTag::Vector3)] = CreateMarshalOperations<godot::Vector3>(Variant::VECTOR3, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(3));
+			typeOperations[size_t(jenova::MarshalTypeTag::Vector3i)] = CreateMarshalOperations<godot::Vector3i>(Variant::VECTOR3I, jenova::VariantStorage::Copied, "int v[3];");
+			typeOperations[size_t(jenova::MarshalTypeTag::Transform2D)] = CreateMarshalOperations<godot::Transform2D>(Variant::TRANSFORM2D, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(6));
+			typeOperations[size_t(jenova::MarshalTypeTag::Vector4)] = CreateMarshalOperations<godot::Vector4>(Variant::VECTOR4, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(4));
+			typeOperations[size_t(jenova::MarshalTypeTag::Vector4i)] = CreateMarshalOperations<godot::Vector4i>(Variant::VECTOR4I, jenova::VariantStorage::Copied, "int v[4];");
+			typeOperations[size_t(jenova::MarshalTypeTag::Plane)] = CreateMarshalOperations<godot::Plane>(Variant::PLANE, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(4));
+			typeOperations[size_t(jenova::MarshalTypeTag::Quaternion)] = CreateMarshalOperations<godot::Quaternion>(Variant::QUATERNION, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(4));
+			typeOperations[size_t(jenova::MarshalTypeTag::AABB)] = CreateMarshalOperations<godot::AABB>(Variant::AABB, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(6));
+			typeOperations[size_t(jenova::MarshalTypeTag::Basis)] = CreateMarshalOperations<godot::Basis>(Variant::BASIS, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(9));
+			typeOperations[size_t(jenova::MarshalTypeTag::Transform3D)] = CreateMarshalOperations<godot::Transform3D>(Variant::TRANSFORM3D, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(12));
+			typeOperations[size_t(jenova::MarshalTypeTag::Projection)] = CreateMarshalOperations<godot::Projection>(Variant::PROJECTION, jenova::VariantStorage::Copied, JENOVA_REAL_LAYOUT(16));
+			typeOperations[size_t(jenova::MarshalTypeTag::Color)] = CreateMarshalOperations<godot::Color>(Variant::COLOR, jenova::VariantStorage::Copied, "float v[4];");
+			typeOperations[size_t(jenova::MarshalTypeTag::StringName)] = CreateMarshalOperations<godot::StringName>(Variant::STRING_NAME, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::NodePath)] = CreateMarshalOperations<godot::NodePath>(Variant::NODE_PATH, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::RID)] = CreateMarshalOperations<godot::RID>(Variant::RID, jenova::VariantStorage::Copied, "unsigned long long v[1];");
+			typeOperations[size_t(jenova::MarshalTypeTag::Callable)] = CreateMarshalOperations<godot::Callable>(Variant::CALLABLE, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::Signal)] = CreateMarshalOperations<godot::Signal>(Variant::SIGNAL, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::Dictionary)] = CreateMarshalOperations<godot::Dictionary>(Variant::DICTIONARY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::Array)] = CreateMarshalOperations<godot::Array>(Variant::ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::PackedByteArray)] = CreateMarshalOperations<godot::PackedByteArray>(Variant::PACKED_BYTE_ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::PackedInt32Array)] = CreateMarshalOperations<godot::PackedInt32Array>(Variant::PACKED_INT32_ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::PackedInt64Array)] = CreateMarshalOperations<godot::PackedInt64Array>(Variant::PACKED_INT64_ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::PackedFloat32Array)] = CreateMarshalOperations<godot::PackedFloat32Array>(Variant::PACKED_FLOAT32_ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::PackedFloat64Array)] = CreateMarshalOperations<godot::PackedFloat64Array>(Variant::PACKED_FLOAT64_ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::PackedStringArray)] = CreateMarshalOperations<godot::PackedStringArray>(Variant::PACKED_STRING_ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::PackedVector2Array)] = CreateMarshalOperations<godot::PackedVector2Array>(Variant::PACKED_VECTOR2_ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::PackedVector3Array)] = CreateMarshalOperations<godot::PackedVector3Array>(Variant::PACKED_VECTOR3_ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::PackedColorArray)] = CreateMarshalOperations<godot::PackedColorArray>(Variant::PACKED_COLOR_ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::PackedVector4Array)] = CreateMarshalOperations<godot::PackedVector4Array>(Variant::PACKED_VECTOR4_ARRAY, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::Reference)] = CreateMarshalOperations<godot::Ref<godot::RefCounted>>(Variant::OBJECT, jenova::VariantStorage::Copied);
+			typeOperations[size_t(jenova::MarshalTypeTag::ByteSpan)] = CreateSpanMarshalOperations<godot::PackedByteArray, false>(Variant::PACKED_BYTE_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::Int32Span)] = CreateSpanMarshalOperations<godot::PackedInt32Array, false>(Variant::PACKED_INT32_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::Int64Span)] = CreateSpanMarshalOperations<godot::PackedInt64Array, false>(Variant::PACKED_INT64_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::Float32Span)] = CreateSpanMarshalOperations<godot::PackedFloat32Array, false>(Variant::PACKED_FLOAT32_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::Float64Span)] = CreateSpanMarshalOperations<godot::PackedFloat64Array, false>(Variant::PACKED_FLOAT64_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::Vector2Span)] = CreateSpanMarshalOperations<godot::PackedVector2Array, false>(Variant::PACKED_VECTOR2_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::Vector3Span)] = CreateSpanMarshalOperations<godot::PackedVector3Array, false>(Variant::PACKED_VECTOR3_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::ColorSpan)] = CreateSpanMarshalOperations<godot::PackedColorArray, false>(Variant::PACKED_COLOR_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::Vector4Span)] = CreateSpanMarshalOperations<godot::PackedVector4Array, false>(Variant::PACKED_VECTOR4_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::WritableByteSpan)] = CreateSpanMarshalOperations<godot::PackedByteArray, true>(Variant::PACKED_BYTE_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::WritableInt32Span)] = CreateSpanMarshalOperations<godot::PackedInt32Array, true>(Variant::PACKED_INT32_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::WritableInt64Span)] = CreateSpanMarshalOperations<godot::PackedInt64Array, true>(Variant::PACKED_INT64_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::WritableFloat32Span)] = CreateSpanMarshalOperations<godot::PackedFloat32Array, true>(Variant::PACKED_FLOAT32_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::WritableFloat64Span)] = CreateSpanMarshalOperations<godot::PackedFloat64Array, true>(Variant::PACKED_FLOAT64_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::WritableVector2Span)] = CreateSpanMarshalOperations<godot::PackedVector2Array, true>(Variant::PACKED_VECTOR2_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::WritableVector3Span)] = CreateSpanMarshalOperations<godot::PackedVector3Array, true>(Variant::PACKED_VECTOR3_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::WritableColorSpan)] = CreateSpanMarshalOperations<godot::PackedColorArray, true>(Variant::PACKED_COLOR_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::WritableVector4Span)] = CreateSpanMarshalOperations<godot::PackedVector4Array, true>(Variant::PACKED_VECTOR4_ARRAY);
+			typeOperations[size_t(jenova::MarshalTypeTag::Variant)] = CreateMarshalOperations<godot::Variant>(Variant::NIL, jenova::VariantStorage::Self);
+			return typeOperations;
+		}();
+		return marshalTypeOperations[size_t(typeTag)];
+	}
+	uintptr_t MarshalVariantArgument(const Variant* variantValue, const jenova::ParameterMarshal& parameterMarshal, void* argumentStorage, bool& argumentConstructed)
+	{
+		// Get Type Operations
+		const jenova::MarshalTypeOperations& typeOperations = GetMarshalTypeOperations(parameterMarshal.typeTag);
+		argumentConstructed = false;
+
+		// Scalar Types Are Passed By Value
+		switch (parameterMarshal.typeTag)
+		{
+		case jenova::MarshalTypeTag::Bool:
+			return uintptr_t(bool(*variantValue));
+		case jenova::MarshalTypeTag::Int32:
+		case jenova::MarshalTypeTag::Int64:
+			return uintptr_t(int64_t(*variantValue));
+		case jenova::MarshalTypeTag::UInt32:
+		case jenova::MarshalTypeTag::UInt64:
+		{
+			// Floats Above INT64_MAX Are Converted Directly [Variant Integers Carry The Unsigned Bit Pattern]
+			if (variantValue->get_type() == Variant::FLOAT && double(*variantValue) >= 0.0) return uintptr_t(uint64_t(double(*variantValue)));
+			uint64_t argumentValue = uint64_t(int64_t(*variantValue));
+			if (parameterMarshal.typeTag == jenova::MarshalTypeTag::UInt32) argumentValue = uint32_t(argumentValue);
+			return uintptr_t(argumentValue);
+		}
+		case jenova::MarshalTypeTag::Float:
+		{
+			float value = float(*variantValue);
+			uintptr_t argumentValue = 0;
+			memcpy(&argumentValue, &value, sizeof(float));
+			return argumentValue;
+		}
+		case jenova::MarshalTypeTag::Double:
+		{
+			double value = double(*variantValue);
+			uintptr_t argumentValue = 0;
+			memcpy(&argumentValue, &value, sizeof(double));
+			return argumentValue;
+		}
+		case jenova::MarshalTypeTag::Object:
+			return reinterpret_cast<uintptr_t>(static_cast<Object*>(*variantValue));
+		default:
+			break;
 		}
 
-		// Misc types
-		if (variantValue->get_type() == Variant::COLOR)
-		{
-			Color* value = new Color(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::STRING_NAME)
-		{
-			StringName* value = new StringName(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::NODE_PATH)
-		{
-			NodePath* value = new NodePath(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::RID)
-		{
-			RID* value = new RID(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::OBJECT)
-		{
-			return jenova::Format("(void*)0x%llx", (void*)variantValue);
-		}
-		if (variantValue->get_type() == Variant::CALLABLE)
-		{
-			Callable* value = new Callable(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::SIGNAL)
-		{
-			Signal* value = new Signal(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::DICTIONARY)
-		{
-			Dictionary* value = new Dictionary(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::ARRAY)
-		{
-			Array* value = new Array(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
+		// Const Variant References Point At Caller Variant
+		if (parameterMarshal.passByReference && typeOperations.variantStorage == jenova::VariantStorage::Self) return reinterpret_cast<uintptr_t>(variantValue);
 
-		// Typed arrays
-		if (variantValue->get_type() == Variant::PACKED_BYTE_ARRAY)
-		{
-			PackedByteArray* value = new PackedByteArray(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PACKED_INT32_ARRAY)
-		{
-			PackedInt32Array* value = new PackedInt32Array(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PACKED_INT64_ARRAY)
-		{
-			PackedInt64Array* value = new PackedInt64Array(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PACKED_FLOAT32_ARRAY)
-		{
-			PackedFloat32Array* value = new PackedFloat32Array(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PACKED_FLOAT64_ARRAY)
-		{
-			PackedFloat64Array* value = new PackedFloat64Array(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PACKED_STRING_ARRAY)
-		{
-			PackedStringArray* value = new PackedStringArray(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PACKED_VECTOR2_ARRAY)
-		{
-			PackedVector2Array* value = new PackedVector2Array(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PACKED_VECTOR3_ARRAY)
-		{
-			PackedVector3Array* value = new PackedVector3Array(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PACKED_VECTOR4_ARRAY)
-		{
-			PackedVector4Array* value = new PackedVector4Array(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
-		}
-		if (variantValue->get_type() == Variant::PACKED_COLOR_ARRAY)
+		// Construct Converted Copy In Caller Provided Storage [Engine Variant-To-Type Constructor, Layout Stays Opaque]
+		if (typeOperations.typeSize > jenova::GlobalSettings::InterpreterMarshalStorageSize) return 0;
+		typeOperations.constructFromVariant(argumentStorage, *variantValue);
+		argumentConstructed = true;
+		return reinterpret_cast<uintptr_t>(argumentStorage);
+	}
+	bool UnmarshalReturnValue(Variant& variantValue, jenova::MarshalTypeTag returnTag, void* returnStorage)
+	{
+		// Scalar Types Are Read From Returned Register Value
+		switch (returnTag)
 		{
-			PackedColorArray* value = new PackedColorArray(*variantValue);
-			ptrList.push_back(value);
-			return jenova::Format("(void*)0x%llx", value);
+		case jenova::MarshalTypeTag::Void:
+			variantValue = Variant();
+			return true;
+		case jenova::MarshalTypeTag::Bool:
+			variantValue = *static_cast<const bool*>(returnStorage);
+			return true;
+		case jenova::MarshalTypeTag::Int32:
+			variantValue = int64_t(*static_cast<const int32_t*>(returnStorage));
+			return true;
+		case jenova::MarshalTypeTag::UInt32:
+			variantValue = int64_t(*static_cast<const uint32_t*>(returnStorage));
+			return true;
+		case jenova::MarshalTypeTag::Int64:
+			variantValue = *static_cast<const int64_t*>(returnStorage);
+			return true;
+		case jenova::MarshalTypeTag::UInt64:
+			variantValue = int64_t(*static_cast<const uint64_t*>(returnStorage));
+			return true;
+		case jenova::MarshalTypeTag::Float:
+			variantValue = *static_cast<const float*>(returnStorage);
+			return true;
+		case jenova::MarshalTypeTag::Double:
+			variantValue = *static_cast<const double*>(returnStorage);
+			return true;
+		case jenova::MarshalTypeTag::Object:
+			variantValue = *static_cast<Object* const*>(returnStorage);
+			return true;
+		default:
+			break;
 		}
 
-		// Default Case
-		return jenova::Format("(void*)0x%llx", (void*)variantValue);
-	}
-	std::string ResolveVariantTypeAsString(const Variant* variantValue)
-	{
-		if (variantValue->get_type() == Variant::BOOL) return "bool";
-		if (variantValue->get_type() == Variant::FLOAT) return "double";
-		if (variantValue->get_type() == Variant::INT) return "long long int";
-		return "void*";
+		// Other Types Were Constructed By Callee In Return Storage, Move Into Variant And Destroy
+		const jenova::MarshalTypeOperations& typeOperations = GetMarshalTypeOperations(returnTag);
+		if (typeOperations.typeSize > jenova::GlobalSettings::InterpreterMarshalStorageSize) return false;
+		typeOperations.assignToVariant(variantValue, returnStorage);
+		typeOperations.destructor(returnStorage);
+		return true;
 	}
 	std::string ResolveReturnTypeForJIT(const std::string& returnType)
 	{
-		// No Return
+		// Scalar Types Return In Registers, Others Through Hidden Return Storage
+		const jenova::MarshalTypeOperations& typeOperations = GetMarshalTypeOperations(GetMarshalTypeTagFromStdString(returnType));
+		if (typeOperations.variantStorage == jenova::VariantStorage::Scalar) return typeOperations.callerType;
 		if (returnType == "void") return returnType;
-
-		// Basic Types
-		if (returnType == "bool" || returnType == "float" || 
-			returnType == "int" || returnType == "double") 
-			return returnType;
-
-		// Other Types
 		return "Variant";
 	}
-	Variant* MakeVariantFromReturnType(Variant* variantObject, const char* returnType)
-	{
-		// Validate Return Type
-		if (returnType == 0) return new Variant(Variant::NIL);
-
-		// Atomic types
-		if (strcmp(returnType, "bool") == 0)
-		{
-			bool value = *(bool*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "int") == 0)
-		{
-			int64_t value = *(int64_t*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "float") == 0)
-		{
-			float value = *(float*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "double") == 0)
-		{
-			double value = *(double*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::String") == 0)
-		{
-			String value = *(String*)variantObject;
-			return new Variant(value);
-		}
-
-		// Math types
-		if (strcmp(returnType, "godot::Vector2") == 0)
-		{
-			Vector2 value = *(Vector2*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Vector2i") == 0)
-		{
-			Vector2i value = *(Vector2i*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Rect2") == 0)
-		{
-			Rect2 value = *(Rect2*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Rect2i") == 0)
-		{
-			Rect2i value = *(Rect2i*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Vector3") == 0)
-		{
-			Vector3 value = *(Vector3*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Vector3i") == 0)
-		{
-			Vector3i value = *(Vector3i*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Transform2D") == 0)
-		{
-			Transform2D value = *(Transform2D*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Vector4") == 0)
-		{
-			Vector4 value = *(Vector4*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Vector4i") == 0)
-		{
-			Vector4i value = *(Vector4i*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Plane") == 0)
-		{
-			Plane value = *(Plane*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Quaternion") == 0)
-		{
-			Quaternion value = *(Quaternion*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::AABB") == 0)
-		{
-			AABB value = *(AABB*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Basis") == 0)
-		{
-			Basis value = *(Basis*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Transform3D") == 0)
-		{
-			Transform3D value = *(Transform3D*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Projection") == 0)
-		{
-			Projection value = *(Projection*)variantObject;
-			return new Variant(value);
-		}
-
-		// Misc types
-		if (strcmp(returnType, "godot::Color") == 0)
-		{
-			Color value = *(Color*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::StringName") == 0)
-		{
-			StringName value = *(StringName*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::NodePath") == 0)
-		{
-			NodePath value = *(NodePath*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::RID") == 0)
-		{
-			RID value = *(RID*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Object") == 0)
-		{
-			Object* value = *(Object**)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Callable") == 0)
-		{
-			Callable value = *(Callable*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Signal") == 0)
-		{
-			Signal value = *(Signal*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Dictionary") == 0)
-		{
-			Dictionary value = *(Dictionary*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::Array") == 0)
-		{
-			Array value = *(Array*)variantObject;
-			return new Variant(value);
-		}
-
-		// Typed arrays
-		if (strcmp(returnType, "godot::PackedByteArray") == 0)
-		{
-			PackedByteArray value = *(PackedByteArray*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::PackedInt32Array") == 0)
-		{
-			PackedInt32Array value = *(PackedInt32Array*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::PackedInt64Array") == 0)
-		{
-			PackedInt64Array value = *(PackedInt64Array*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::PackedFloat32Array") == 0)
-		{
-			PackedFloat32Array value = *(PackedFloat32Array*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::PackedFloat64Array") == 0)
-		{
-			PackedFloat64Array value = *(PackedFloat64Array*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::PackedStringArray") == 0)
-		{
-			PackedStringArray value = *(PackedStringArray*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::PackedVector2Array") == 0)
-		{
-			PackedVector2Array value = *(PackedVector2Array*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::PackedVector3Array") == 0)
-		{
-			PackedVector3Array value = *(PackedVector3Array*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::PackedColorArray") == 0)
-		{
-			PackedColorArray value = *(PackedColorArray*)variantObject;
-			return new Variant(value);
-		}
-		if (strcmp(returnType, "godot::PackedVector4Array") == 0)
-		{
-			PackedVector4Array value = *(PackedVector4Array*)variantObject;
-			return new Variant(value);
-		}
-
-		// Variant
-		if (strcmp(returnType, "godot::Variant") == 0)
-		{
-			return new Variant(variantObject);
-		}
-
-		// Default case (unsupported type)
-		return new Variant(*variantObject);
-	}
 	uint32_t GetPropertyEnumFlagFromString(const std::string enumFlagStr)
 	{
 		// Check if the input is an integer
@@ -8044,6 +8177,112 @@ namespace jenova
 		else scriptSource = AS_GD_STRING(sourceStdStr);
 		return propertiesMetadata;
 	}
+	template <typename T, Variant::Type V> const jenova::PropertyTypeOperations* GetPropertyTypeOperations()
+	{
+		static const jenova::PropertyTypeOperations typeOperations =
+		{
+			sizeof(T),
+			V,
+			[](void* propertyStorage) { new (propertyStorage) T(); },
+			[](void* propertyStorage) { static_cast<T*>(propertyStorage)->~T(); },
+			[]() -> void* { return new T(); },
+			[](void* propertyStorage, const Variant& variantValue)
+			{
+				// Variant Storage Accepts Objects And Null, Others Accept Declared Type Or Numeric Promotion
+				if constexpr (std::is_same_v<T, Variant>)
+				{
+					if (variantValue.get_type() != Variant::OBJECT && variantValue.get_type() != Variant::NIL) return false;
+					*static_cast<T*>(propertyStorage) = variantValue;
+				}
+				else if (variantValue.get_type() == V) *static_cast<T*>(propertyStorage) = T(variantValue);
+				else if constexpr (V == Variant::INT || V == Variant::FLOAT)
+				{
+					if (variantValue.get_type() != Variant::INT && variantValue.get_type() != Variant::FLOAT) return false;
+					*static_cast<T*>(propertyStorage) = T(variantValue);
+				}
+				else return false;
+				return true;
+			},
+			[](const void* propertyStorage, Variant& variantValue) { variantValue = *static_cast<const T*>(propertyStorage); },
+			[](void* propertyStorage, const void* sourceStorage) { new (propertyStorage) T(*static_cast<const T*>(sourceStorage)); },
+			std::is_trivially_copyable_v<T>
+		};
+		return &typeOperations;
+	}
+	const std::unordered_map<std::string, const jenova::PropertyTypeOperations*>& GetPropertyTypeDescriptors()
+	{
+		// Type Descriptors Are Built Once And Shared By All Property Slots
+		static const std::unordered_map<std::string, const jenova::PropertyTypeOperations*> typeDescriptors =
+		{
+			// Atomic types
+			{ "bool", GetPropertyTypeOperations<bool, Variant::BOOL>() },
+			{ "int", GetPropertyTypeOperations<int64_t, Variant::INT>() },
+			{ "int32_t", GetPropertyTypeOperations<int64_t, Variant::INT>() },
+			{ "int64_t", GetPropertyTypeOperations<int64_t, Variant::INT>() },
+			{ "float", GetPropertyTypeOperations<double, Variant::FLOAT>() },
+			{ "double", GetPropertyTypeOperations<double, Variant::FLOAT>() },
+			{ "String", GetPropertyTypeOperations<godot::String, Variant::STRING>() },
+
+			// Math types
+			{ "Vector2", GetPropertyTypeOperations<godot::Vector2, Variant::VECTOR2>() },
+			{ "Vector2i", GetPropertyTypeOperations<godot::Vector2i, Variant::VECTOR2I>() },
+			{ "Rect2", GetPropertyTypeOperations<godot::Rect2, Variant::RECT2>() },
+			{ "Rect2i", GetPropertyTypeOperations<godot::Rect2i, Variant::RECT2I>() },
+			{ "Vector3", GetPropertyTypeOperations<godot::Vector3, Variant::VECTOR3>() },
+			{ "Vector3i", GetPropertyTypeOperations<godot::Vector3i, Variant::VECTOR3I>() },
+			{ "Transform2D", GetPropertyTypeOperations<godot::Transform2D, Variant::TRANSFORM2D>() },
+			{ "Vector4", GetPropertyTypeOperations<godot::Vector4, Variant::VECTOR4>() },
+			{ "Vector4i", GetPropertyTypeOperations<godot::Vector4i, Variant::VECTOR4I>() },
+			{ "Plane", GetPropertyTypeOperations<godot::Plane, Variant::PLANE>() },
+			{ "Quaternion", GetPropertyTypeOperations<godot::Quaternion, Variant::QUATERNION>() },
+			{ "AABB", GetPropertyTypeOperations<godot::AABB, Variant::AABB>() },
+			{ "Basis", GetPropertyTypeOperations<godot::Basis, Variant::BASIS>() },
+			{ "Transform3D", GetPropertyTypeOperations<godot::Transform3D, Variant::TRANSFORM3D>() },
+			{ "Projection", GetPropertyTypeOperations<godot::Projection, Variant::PROJECTION>() },
+
+			// Misc types
+			{ "Color", GetPropertyTypeOperations<godot::Color, Variant::COLOR>() },
+			{ "StringName", GetPropertyTypeOperations<godot::StringName, Variant::STRING_NAME>() },
+			{ "NodePath", GetPropertyTypeOperations<godot::NodePath, Variant::NODE_PATH>() },
+			{ "RID", GetPropertyTypeOperations<godot::RID, Variant::RID>() },
+			{ "Object", GetPropertyTypeOperations<Variant, Variant::OBJECT>() },
+			{ "Callable", GetPropertyTypeOperations<godot::Callable, Variant::CALLABLE>() },
+			{ "Signal", GetPropertyTypeOperations<godot::Signal, Variant::SIGNAL>() },
+			{ "Dictionary", GetPropertyTypeOperations<godot::Dictionary, Variant::DICTIONARY>() },
+			{ "Array", GetPropertyTypeOperations<godot::Array, Variant::ARRAY>() },
+
+			// Typed arrays
+			{ "PackedByteArray", GetPropertyTypeOperations<godot::PackedByteArray, Variant::PACKED_BYTE_ARRAY>() },
+			{ "PackedInt32Array", GetPropertyTypeOperations<godot::PackedInt32Array, Variant::PACKED_INT32_ARRAY>() },
+			{ "PackedInt64Array", GetPropertyTypeOperations<godot::PackedInt64Array, Variant::PACKED_INT64_ARRAY>() },
+			{ "PackedFloat32Array", GetPropertyTypeOperations<godot::PackedFloat32Array, Variant::PACKED_FLOAT32_ARRAY>() },
+			{ "PackedFloat64Array", GetPropertyTypeOperations<godot::PackedFloat64Array, Variant::PACKED_FLOAT64_ARRAY>() },
+			{ "PackedStringArray", GetPropertyTypeOperations<godot::PackedStringArray, Variant::PACKED_STRING_ARRAY>() },
+			{ "PackedVector2Array", GetPropertyTypeOperations<godot::PackedVector2Array, Variant::PACKED_VECTOR2_ARRAY>() },
+			{ "PackedVector3Array", GetPropertyTypeOperations<godot::PackedVector3Array, Variant::PACKED_VECTOR3_ARRAY>() },
+			{ "PackedColorArray", GetPropertyTypeOperations<godot::PackedColorArray, Variant::PACKED_COLOR_ARRAY>() },
+			{ "PackedVector4Array", GetPropertyTypeOperations<godot::PackedVector4Array, Variant::PACKED_VECTOR4_ARRAY>() }
+		};
+		return typeDescriptors;
+	}
+	const jenova::PropertyTypeOperations* GetVariantBasedPropertyOperations(const std::string& typeName)
+	{
+		// Clean Type Name
+		std::string typeNameCleaned = typeName;
+		CleanVariantTypeName(typeNameCleaned);
+
+		// Resolve Type Descriptor
+		const auto& typeDescriptors = GetPropertyTypeDescriptors();
+		auto typeDescriptor = typeDescriptors.find(typeNameCleaned);
+		if (typeDescriptor != typeDescriptors.end()) return typeDescriptor->second;
+
+		// Default Case [Material, Animation etc.]
+		return GetPropertyTypeOperations<Variant, Variant::OBJECT>();
+	}
+	void* AllocateVariantBasedProperty(const std::string& typeName)
+	{
+		return GetVariantBasedPropertyOperations(typeName)->allocator();
+	}
 	Variant::Type GetVariantTypeFromStdString(const std::string& typeName)
 	{
 		// Clean Type Name
@@ -8054,54 +8293,8 @@ namespace jenova
 		if (typeNameCleaned == "void") return Variant::Type::NIL;
 		if (typeNameCleaned == "jenova::sdk::Caller") return Variant::Type::NIL;
 
-		// Atomic types
-		if (typeNameCleaned == "bool") return Variant::Type::BOOL;
-		if (typeNameCleaned == "int" || typeNameCleaned == "int32_t" || typeNameCleaned == "int64_t") return Variant::Type::INT;
-		if (typeNameCleaned == "float" || typeNameCleaned == "double") return Variant::Type::FLOAT;
-		if (typeNameCleaned == "String") return Variant::Type::STRING;
-
-		// Math types
-		if (typeNameCleaned == "Vector2") return Variant::Type::VECTOR2;
-		if (typeNameCleaned == "Vector2i") return Variant::Type::VECTOR2I;
-		if (typeNameCleaned == "Rect2") return Variant::Type::RECT2;
-		if (typeNameCleaned == "Rect2i") return Variant::Type::RECT2I;
-		if (typeNameCleaned == "Vector3") return Variant::Type::VECTOR3;
-		if (typeNameCleaned == "Vector3i") return Variant::Type::VECTOR3I;
-		if (typeNameCleaned == "Transform2D") return Variant::Type::TRANSFORM2D;
-		if (typeNameCleaned == "Vector4") return Variant::Type::VECTOR4;
-		if (typeNameCleaned == "Vector4i") return Variant::Type::VECTOR4I;
-		if (typeNameCleaned == "Plane") return Variant::Type::PLANE;
-		if (typeNameCleaned == "Quaternion") return Variant::Type::QUATERNION;
-		if (typeNameCleaned == "AABB") return Variant::Type::AABB;
-		if (typeNameCleaned == "Basis") return Variant::Type::BASIS;
-		if (typeNameCleaned == "Transform3D") return Variant::Type::TRANSFORM3D;
-		if (typeNameCleaned == "Projection") return Variant::Type::PROJECTION;
-
-		// Misc types
-		if (typeNameCleaned == "Color") return Variant::Type::COLOR;
-		if (typeNameCleaned == "StringName") return Variant::Type::STRING_NAME;
-		if (typeNameCleaned == "NodePath") return Variant::Type::NODE_PATH;
-		if (typeNameCleaned == "RID") return Variant::Type::RID;
-		if (typeNameCleaned == "Object") return Variant::Type::OBJECT;
-		if (typeNameCleaned == "Callable") return Variant::Type::CALLABLE;
-		if (typeNameCleaned == "Signal") return Variant::Type::SIGNAL;
-		if (typeNameCleaned == "Dictionary") return Variant::Type::DICTIONARY;
-		if (typeNameCleaned == "Array") return Variant::Type::ARRAY;
-
-		// Typed arrays
-		if (typeNameCleaned == "PackedByteArray") return Variant::Type::PACKED_BYTE_ARRAY;
-		if (typeNameCleaned == "PackedInt32Array") return Variant::Type::PACKED_INT32_ARRAY;
-		if (typeNameCleaned == "PackedInt64Array") return Variant::Type::PACKED_INT64_ARRAY;
-		if (typeNameCleaned == "PackedFloat32Array") return Variant::Type::PACKED_FLOAT32_ARRAY;
-		if (typeNameCleaned == "PackedFloat64Array") return Variant::Type::PACKED_FLOAT64_ARRAY;
-		if (typeNameCleaned == "PackedStringArray") return Variant::Type::PACKED_STRING_ARRAY;
-		if (typeNameCleaned == "PackedVector2Array") return Variant::Type::PACKED_VECTOR2_ARRAY;
-		if (typeNameCleaned == "PackedVector3Array") return Variant::Type::PACKED_VECTOR3_ARRAY;
-		if (typeNameCleaned == "PackedColorArray") return Variant::Type::PACKED_COLOR_ARRAY;
-		if (typeNameCleaned == "PackedVector4Array") return Variant::Type::PACKED_VECTOR4_ARRAY;
-
-		// Default Case
-		return Variant::Type::OBJECT;
+		// Resolve Type From Descriptor [Unknown Types Are Stored As Objects]
+		return GetVariantBasedPropertyOperations(typeNameCleaned)->variantType;
 	}
 	jenova::ScriptPropertyContainer CreatePropertyContainerFromMetadata(const jenova::SerializedData& propertyMetadata, const std::string& scriptUID)
 	{
@@ -8151,61 +8344,6 @@ namespace jenova
 		jenova::ReplaceAllMatchesWithString(typeName, "&", "");
 		jenova::ReplaceAllMatchesWithString(typeName, "godot::", "");
 	}
-	void* AllocateVariantBasedProperty(const std::string& typeName)
-	{
-		// Clean Type Name
-		std::string typeNameCleaned = typeName;
-		CleanVariantTypeName(typeNameCleaned);
-
-		// Atomic types
-		if (typeNameCleaned == "bool") return new bool();
-		if (typeNameCleaned == "int" || typeNameCleaned == "int32_t" || typeNameCleaned == "int64_t") return new int64_t();
-		if (typeNameCleaned == "double" || typeNameCleaned == "float") return new double();
-		if (typeNameCleaned == "String") return new godot::String();
-
-		// Math types
-		if (typeNameCleaned == "Vector2") return new godot::Vector2();
-		if (typeNameCleaned == "Vector2i") return new godot::Vector2i();
-		if (typeNameCleaned == "Rect2") return new godot::Rect2();
-		if (typeNameCleaned == "Rect2i") return new godot::Rect2i();
-		if (typeNameCleaned == "Vector3") return new godot::Vector3();
-		if (typeNameCleaned == "Vector3i") return new godot::Vector3i();
-		if (typeNameCleaned == "Transform2D") return new godot::Transform2D();
-		if (typeNameCleaned == "Vector4") return new godot::Vector4();
-		if (typeNameCleaned == "Vector4i") return new godot::Vector4i();
-		if (typeNameCleaned == "Plane") return new godot::Plane();
-		if (typeNameCleaned == "Quaternion") return new godot::Quaternion();
-		if (typeNameCleaned == "AABB") return new godot::AABB();
-		if (typeNameCleaned == "Basis") return new godot::Basis();
-		if (typeNameCleaned == "Transform3D") return new godot::Transform3D();
-		if (typeNameCleaned == "Projection") return new godot::Projection();
-
-		// Misc types
-		if (typeNameCleaned == "Color") return new godot::Color();
-		if (typeNameCleaned == "StringName") return new godot::StringName();
-		if (typeNameCleaned == "NodePath") return new godot::NodePath();
-		if (typeNameCleaned == "RID") return new godot::RID();
-		if (typeNameCleaned == "Object") return new Variant();
-		if (typeNameCleaned == "Callable") return new godot::Callable();
-		if (typeNameCleaned == "Signal") return new godot::Signal();
-		if (typeNameCleaned == "Dictionary") return new godot::Dictionary();
-		if (typeNameCleaned == "Array") return new godot::Array();
-
-		// Typed arrays
-		if (typeNameCleaned == "PackedByteArray") return new godot::PackedByteArray();
-		if (typeNameCleaned == "PackedInt32Array") return new godot::PackedInt32Array();
-		if (typeNameCleaned == "PackedInt64Array") return new godot::PackedInt64Array();
-		if (typeNameCleaned == "PackedFloat32Array") return new godot::PackedFloat32Array();
-		if (typeNameCleaned == "PackedFloat64Array") return new godot::PackedFloat64Array();
-		if (typeNameCleaned == "PackedStringArray") return new godot::PackedStringArray();
-		if (typeNameCleaned == "PackedVector2Array") return new godot::PackedVector2Array();
-		if (typeNameCleaned == "PackedVector3Array") return new godot::PackedVector3Array();
-		if (typeNameCleaned == "PackedColorArray") return new godot::PackedColorArray();
-		if (typeNameCleaned == "PackedVector4Array") return new godot::PackedVector4Array();
-
-		// Default Case [Material, Animation etc.]
-		return new Variant();
-	}
 	bool SetPropertyPointerValueFromVariant(jenova::PropertyPointer propertyPointer, const Variant& variantValue)
 	{
 		// Get Property Information
@@ -8570,7 +8708,7 @@ namespace jenova
 	}
 	std::string ParseClassNameFromScriptSource(const std::string& sourceCode)
 	{
-		std::regex pattern(R"(JENOVA_CLASS_NAME\s*\(\s*\"([^\"]+)\"\s*\))");
+		std::regex pattern(R"(JENOVA_CLASS_NAME\s*\(\s*\"([^\"]+)\"\s*(,\s*\"[^\"]+\"\s*)?\))");
 		std::smatch match;
 		std::istringstream stream(sourceCode);
 		std::string line;
@@ -8583,6 +8721,198 @@ namespace jenova
 		}
 		return "";
 	}
+	std::string ParseClassBaseTypeFromScriptSource(const std::string& sourceCode)
+	{
+		std::regex pattern(R"(JENOVA_CLASS_NAME\s*\(\s*\"[^\"]+\"\s*,\s*\"([^\"]+)\"\s*\))");
+		std::smatch match;
+		std::istringstream stream(sourceCode);
+		std::string line;
+		while (std::getline(stream, line)) 
+		{
+			if (line.find("//") == std::string::npos && line.find("/*") == std::string::npos) 
+			{
+				if (std::regex_search(line, match, pattern)) return match[1].str();
+			}
+		}
+		return jenova::GlobalSettings::DefaultNativeClassBaseType;
+	}
+	std::string GenerateNativeInvokersFromScript(const std::string& scriptSource, const std::string& scriptUID)
+	{
+		// Check If Native Invokers Are Enabled
+		if (!jenova::GlobalSettings::GenerateScriptNativeInvokers) return "";
+
+		// Locate Script Block
+		size_t blockStart = scriptSource.find("namespace JNV_" + scriptUID);
+		if (blockStart == std::string::npos) return "";
+		blockStart = scriptSource.find('{', blockStart);
+		if (blockStart == std::string::npos) return "";
+		size_t blockEnd = scriptSource.find("}; using namespace JNV_" + scriptUID + ";", blockStart);
+		if (blockEnd == std::string::npos) return "";
+
+		// Helpers
+		auto isIdentifierChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+		auto readTokenBefore = [&](size_t pos) -> std::string
+		{
+			size_t tokenStart = pos;
+			while (tokenStart > blockStart && (isIdentifierChar(scriptSource[tokenStart - 1]) || scriptSource[tokenStart - 1] == '\'')) tokenStart--;
+			return scriptSource.substr(tokenStart, pos - tokenStart);
+		};
+		auto isLiteralStart = [&](size_t pos) -> bool
+		{
+			// Digit Separators Belong to Numeric Literals [1'000'000, 0xFF'FF]
+			if (scriptSource[pos] == '"') return true;
+			if (scriptSource[pos] != '\'') return false;
+			std::string numberToken = readTokenBefore(pos);
+			return numberToken.empty() || !std::isdigit(static_cast<unsigned char>(numberToken[0]));
+		};
+		auto skipLiteral = [&](size_t pos) -> size_t
+		{
+			// Raw String Literals [R"delimiter(...)delimiter" With u8/u/U/L Prefixes]
+			static const std::unordered_set<std::string> rawPrefixes = { "R", "u8R", "uR", "UR", "LR" };
+			if (scriptSource[pos] == '"' && rawPrefixes.contains(readTokenBefore(pos)))
+			{
+				size_t delimiterEnd = scriptSource.find('(', pos);
+				if (delimiterEnd == std::string::npos || delimiterEnd >= blockEnd) return blockEnd;
+				std::string rawTerminator = ")" + scriptSource.substr(pos + 1, delimiterEnd - pos - 1) + "\"";
+				size_t literalEnd = scriptSource.find(rawTerminator, delimiterEnd);
+				if (literalEnd == std::string::npos || literalEnd >= blockEnd) return blockEnd;
+				return literalEnd + rawTerminator.size() - 1;
+			}
+
+			// Regular String And Character Literals
+			char quote = scriptSource[pos];
+			for (size_t i = pos + 1; i < blockEnd; i++)
+			{
+				if (scriptSource[i] == '\\') { i++; continue; }
+				if (scriptSource[i] == quote) return i;
+			}
+			return blockEnd;
+		};
+		auto cleanDeclaration = [&](std::string declaration) -> std::string
+		{
+			// Strip Comments Between Statements
+			for (size_t commentStart = declaration.find('/'); commentStart != std::string::npos && commentStart + 1 < declaration.size(); commentStart = declaration.find('/', commentStart))
+			{
+				if (declaration[commentStart + 1] == '/') declaration.erase(commentStart, declaration.find('\n', commentStart) - commentStart);
+				else if (declaration[commentStart + 1] == '*') declaration.erase(commentStart, declaration.find("*/", commentStart) + 2 - commentStart);
+				else commentStart++;
+			}
+
+			// Strip Attribute Specifiers [[[nodiscard]], __attribute__((...)), __declspec(...)]
+			for (size_t attributeStart = declaration.find("[["); attributeStart != std::string::npos; attributeStart = declaration.find("[[", attributeStart))
+			{
+				size_t attributeEnd = declaration.find("]]", attributeStart + 2);
+				if (attributeEnd == std::string::npos) break;
+				declaration.erase(attributeStart, attributeEnd + 2 - attributeStart);
+			}
+			for (const char* attributeKeyword : { "__attribute__", "__declspec" })
+			{
+				for (size_t attributeStart = declaration.find(attributeKeyword); attributeStart != std::string::npos; attributeStart = declaration.find(attributeKeyword, attributeStart))
+				{
+					size_t attributeEnd = declaration.find('(', attributeStart);
+					if (attributeEnd == std::string::npos) break;
+					for (int parenDepth = 0; attributeEnd < declaration.size(); attributeEnd++)
+					{
+						if (declaration[attributeEnd] == '(') parenDepth++;
+						if (declaration[attributeEnd] == ')' && --parenDepth == 0) break;
+					}
+					declaration.erase(attributeStart, attributeEnd + 1 - attributeStart);
+				}
+			}
+			return declaration;
+		};
+		static const std::unordered_set<std::string> reservedNames = { "if", "for", "while", "switch", "catch", "return", "sizeof", "alignof", "decltype",
+			"alignas", "static_assert", "noexcept", "throw", "new", "delete", "defined", "operator", "__attribute__", "__declspec" };
+		static const std::regex excludedDeclarations(R"(\b(template|typedef|using|friend)\b)");
+
+		// Collect Top-Level Function Definitions
+		std::vector<std::string> functionNames;
+		std::unordered_map<std::string, int> functionDefinitions;
+		size_t statementStart = blockStart + 1;
+		int braceDepth = 0;
+		for (size_t i = statementStart; i < blockEnd; i++)
+		{
+			char c = scriptSource[i];
+			char n = (i + 1 < blockEnd) ? scriptSource[i + 1] : '\0';
+
+			// Skip Comments, Literals and Preprocessor Lines
+			if (c == '/' && n == '/') { i = scriptSource.find('\n', i); if (i == std::string::npos || i >= blockEnd) break; continue; }
+			if (c == '/' && n == '*') { i = scriptSource.find("*/", i + 2); if (i == std::string::npos || i >= blockEnd) break; i++; continue; }
+			if ((c == '"' || c == '\'') && isLiteralStart(i)) { i = skipLiteral(i); continue; }
+			if (c == '#')
+			{
+				size_t lineStart = scriptSource.find_last_of('\n', i);
+				lineStart = (lineStart == std::string::npos) ? 0 : lineStart + 1;
+				if (scriptSource.find_first_not_of(" \t", lineStart) != i) continue;
+				while (i < blockEnd && !(scriptSource[i] == '\n' && scriptSource[i - 1] != '\\')) i++;
+				statementStart = i + 1;
+				continue;
+			}
+
+			// Track Scopes And Statements
+			if (c == '{') { braceDepth++; continue; }
+			if (c == '}') { braceDepth--; if (braceDepth == 0) statementStart = i + 1; continue; }
+			if (c == ';' && braceDepth == 0) { statementStart = i + 1; continue; }
+			if (c != '(' || braceDepth != 0) continue;
+
+			// Match Parameter List
+			size_t paramsEnd = i;
+			for (int parenDepth = 0; paramsEnd < blockEnd; paramsEnd++)
+			{
+				if ((scriptSource[paramsEnd] == '"' || scriptSource[paramsEnd] == '\'') && isLiteralStart(paramsEnd)) { paramsEnd = skipLiteral(paramsEnd); continue; }
+				if (scriptSource[paramsEnd] == '(') parenDepth++;
+				if (scriptSource[paramsEnd] == ')' && --parenDepth == 0) break;
+			}
+			if (paramsEnd >= blockEnd) break;
+
+			// Read Identifier Before Parameter List
+			size_t nameEnd = i;
+			while (nameEnd > statementStart && std::isspace(static_cast<unsigned char>(scriptSource[nameEnd - 1]))) nameEnd--;
+			size_t nameStart = nameEnd;
+			while (nameStart > statementStart && isIdentifierChar(scriptSource[nameStart - 1])) nameStart--;
+			std::string functionName = scriptSource.substr(nameStart, nameEnd - nameStart);
+			std::string declaration = cleanDeclaration(scriptSource.substr(statementStart, nameStart - statementStart));
+			bool hasReturnType = declaration.find_first_not_of(" \t\r\n") != std::string::npos;
+
+			// Check If Parameter List Is Followed By a Body
+			size_t bodyStart = scriptSource.find_first_of("{;=(,)", paramsEnd + 1);
+			bool isDefinition = bodyStart < blockEnd && scriptSource[bodyStart] == '{';
+
+			// Validate Function Definition
+			if (isDefinition && hasReturnType && !functionName.empty() && !std::isdigit(static_cast<unsigned char>(functionName[0])) &&
+				!reservedNames.contains(functionName) && functionName.rfind("JENOVA_", 0) != 0 &&
+				std::string(":.>~").find(scriptSource[nameStart - 1]) == std::string::npos &&
+				declaration.find_first_of("=()") == std::string::npos && !std::regex_search(declaration, excludedDeclarations))
+			{
+				if (functionDefinitions[functionName]++ == 0) functionNames.push_back(functionName);
+			}
+
+			// Macro Invocations Without Semicolon End Statement
+			if (!hasReturnType && !isDefinition) statementStart = paramsEnd + 1;
+			i = paramsEnd;
+		}
+
+		// Generate Invokers (Overloaded Functions Are Skipped)
+		std::string invokersSource, invokersTable;
+		for (const auto& functionName : functionNames)
+		{
+			if (functionDefinitions[functionName] != 1) continue;
+			std::string invokerName = jenova::Format("__jnv_invoke_%s_%s", scriptUID.c_str(), functionName.c_str());
+			invokersSource += jenova::Format("extern \"C\" bool %s(const godot::Object* self, const godot::Variant** args, int argsCount, godot::Variant* returnValue) ", invokerName.c_str());
+			invokersSource += jenova::Format("{ return jenova::sdk::InvokeNative(&JNV_%s::%s, self, args, argsCount, returnValue); }\n", scriptUID.c_str(), functionName.c_str());
+			invokersTable += jenova::Format("\t{ \"%s\", &%s, jenova::sdk::GetNativePtrInvoker<&JNV_%s::%s>() },\n", functionName.c_str(), invokerName.c_str(), scriptUID.c_str(), functionName.c_str());
+		}
+		if (invokersTable.empty()) return "";
+
+		// Generate Exported Table
+		std::string nativeInvokers = "\n\n// Jenova Native Invokers\n#include <JenovaSDK.h>\n";
+		nativeInvokers += invokersSource;
+		nativeInvokers += jenova::Format("static const jenova::sdk::NativeInvokerEntry __jnv_invoker_table_%s[] =\n{\n", scriptUID.c_str());
+		nativeInvokers += invokersTable + "\t{ nullptr, nullptr, nullptr }\n};\n";
+		nativeInvokers += jenova::Format("extern \"C\" JENOVA_API_EXPORT const jenova::sdk::NativeInvokerEntry* %s%s() { return __jnv_invoker_table_%s; }\n",
+			jenova::GlobalSettings::ScriptNativeInvokerTablePrefix, scriptUID.c_str(), scriptUID.c_str());
+		return nativeInvokers;
+	}
 	jenova::ScriptFileState BackupScriptFileState(const std::string& scriptFilePath)
 	{
 		// Windows Implementation
@@ -8795,7 +9125,7 @@ namespace jenova
 			if (cppResource->is_class(jenova::GlobalSettings::JenovaScriptType))
 			{
 				Ref<CPPScript> cppScript = Object::cast_to<CPPScript>(cppResource.ptr());
-				if (AS_STD_STRING(cppScript->GetScriptIdentity()) == scriptUID) return AS_STD_STRING(cppScript->get_path());
+				if (cppScript->GetInternedIdentity()->scriptUIDString == scriptUID) return AS_STD_STRING(cppScript->get_path());
 			}
 		}
 
@@ -363,7 +363,9 @@ namespace jenova::sdk
 	}
 	bool JenovaSDK::ReloadJenovaRuntime(RuntimeReloadMode reloadMode)
 	{
-		jenova::sdk::Output("ReloadJenovaRuntime -> Not Implemented Yet");
+		// Hot Reload Stages Module Cache In Background, Swap Happens At Next Frame Boundary
+		if (reloadMode == RuntimeReloadMode::HotReload) return JenovaInterpreter::StageModuleFromDatabase(jenova::GlobalSettings::DefaultModuleDatabaseFile);
+		jenova::sdk::Output("ReloadJenovaRuntime -> Only Hot Reload Is Implemented");
 		return false;
 	}
 	void JenovaSDK::CreateCheckpoint(const godot::String& checkPointName)
@@ -651,6 +653,36 @@ namespace jenova::sdk
 	{
 		return Clektron::get_singleton()->ExecuteScriptFromFile(ctronScriptFile, noEntrypoint);
 	}
+
+	// Script Batch Utilities
+	size_t JenovaSDK::InvokeScriptMethod(godot::Object* const* objects, size_t objectCount, const godot::StringName& methodName, const godot::Variant** args, int argsCount, BatchExecution executionMode, godot::Variant* results)
+	{
+		// Resolve Script Instances From Owners
+		if (!objects || objectCount == 0) return 0;
+		std::vector<CPPScriptInstance*> scriptInstances(objectCount, nullptr);
+		for (size_t i = 0; i < objectCount; i++) scriptInstances[i] = JenovaScriptManager::get_singleton()->get_script_instance_from_owner(objects[i]);
+
+		// Invoke Batch
+		return JenovaScriptManager::get_singleton()->invoke_method_batch(methodName, scriptInstances.data(), objectCount, args, argsCount, jenova::BatchExecution(executionMode), results);
+	}
+	size_t JenovaSDK::InvokeScriptMethod(const godot::Ref<godot::Script>& script, const godot::StringName& methodName, const godot::Variant** args, int argsCount, BatchExecution executionMode, godot::Variant* results)
+	{
+		Ref<CPPScript> scriptObject = script;
+		if (scriptObject.is_null()) return 0;
+		return JenovaScriptManager::get_singleton()->invoke_script_method_batch(scriptObject, methodName, args, argsCount, jenova::BatchExecution(executionMode), results);
+	}
+
+	// Native Callable Utilities
+	godot::Callable JenovaSDK::CreateScriptCallable(godot::Object* target, const godot::StringName& methodName)
+	{
+		if (!target) return godot::Callable();
+		return godot::Callable(memnew(CPPScriptCallable(target, methodName)));
+	}
+	godot::Callable JenovaSDK::CreateNativeCallable(godot::Object* target, NativeInvoker invoker)
+	{
+		if (!target || !invoker) return godot::Callable();
+		return godot::Callable(memnew(CPPScriptCallable(target, jenova::NativeInvoker(invoker))));
+	}
 }
 
 // Jenova SDK Management
@@ -749,6 +781,14 @@ namespace jenova
 		if (string(sdkFunctionName) == "ExecuteScript") return FunctionPtr((bool(*)(StringPtr, bool))(&clektron::ExecuteScript));
 		if (string(sdkFunctionName) == "ExecuteScriptFromFile") return FunctionPtr((bool(*)(StringPtr, bool))(&clektron::ExecuteScriptFromFile));
 
+		// Solve Script Batch Utilities Functions
+		if (string(sdkFunctionName) == "InvokeScriptMethodOnObjects") return FunctionPtr((size_t(*)(godot::Object* const*, size_t, const godot::StringName&, const godot::Variant**, int, BatchExecution, godot::Variant*))(&InvokeScriptMethod));
+		if (string(sdkFunctionName) == "InvokeScriptMethodOnScript") return FunctionPtr((size_t(*)(const godot::Ref<godot::Script>&, const godot::StringName&, const godot::Variant**, int, BatchExecution, godot::Variant*))(&InvokeScriptMethod));
+
+		// Solve Native Callable Utilities Functions
+		if (string(sdkFunctionName) == "CreateScriptCallable") return FunctionPtr(&CreateScriptCallable);
+		if (string(sdkFunctionName) == "CreateNativeCallable") return FunctionPtr((godot::Callable(*)(godot::Object*, NativeInvoker))(&CreateNativeCallable));
+
 		// Invalid Function
 		return nullptr;
 	}
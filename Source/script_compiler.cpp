@@ -18,6 +18,361 @@
 // Jenova Namespace
 namespace jenova
 {
+    // Compiler Utilities
+    static size_t ResolveCompilerWorkerCount(const Dictionary& compilerSettings)
+    {
+        // Use Configured Worker Count, Otherwise Size Pool From Cores And Available Memory
+        int64_t workerCount = int64_t(compilerSettings.get("cpp_compiler_workers", 0));
+        if (workerCount <= 0) workerCount = int64_t(JenovaTaskSystem::GetRecommendedWorkerCount(jenova::GlobalSettings::CompilerWorkerMemoryBudget));
+        jenova::VerboseByID(__LINE__, "Compiling Scripts Using %lld Workers.", workerCount);
+        return size_t(workerCount);
+    }
+    static std::string QueryCompilerIdentity(const std::string& compilerBinary)
+    {
+        // Resolved Binaries Are Identified By Size & Timestamp
+        std::error_code errorCode;
+        if (std::filesystem::is_regular_file(compilerBinary, errorCode))
+        {
+            auto binarySize = std::filesystem::file_size(compilerBinary, errorCode);
+            auto binaryTime = std::filesystem::last_write_time(compilerBinary, errorCode).time_since_epoch().count();
+            return compilerBinary + ":" + std::to_string(binarySize) + ":" + std::to_string(binaryTime);
+        }
+
+        // Toolchain Drivers From PATH Are Identified By Their Version Banner
+        #ifdef TARGET_PLATFORM_LINUX
+            std::string versionBanner;
+            FILE* pipe = popen((compilerBinary + " --version 2>/dev/null").c_str(), "r");
+            if (pipe)
+            {
+                std::array<char, 256> buffer = {};
+                if (fgets(buffer.data(), buffer.size(), pipe) != nullptr) versionBanner = buffer.data();
+                pclose(pipe);
+            }
+            if (!versionBanner.empty()) return compilerBinary + ":" + versionBanner;
+        #endif
+
+        // Fallback to Binary Name
+        return compilerBinary;
+    }
+    static bool PreparePrecompiledHeader(const std::string& headerFile, const std::string& headerContent, const std::string& outputFile,
+        const std::string& dependencyFile, const std::string& buildCommand, const std::string& compilerIdentity)
+    {
+        // Solve Precompiled Header Key [Compiler Version, Flags & Content]
+        std::string precompiledKey = AS_STD_STRING(String((compilerIdentity + "\n" + buildCommand + "\n" + headerContent).c_str()).md5_text());
+        std::string keyFile = outputFile + jenova::GlobalSettings::PrecompiledHeaderKeyFileExtension;
+
+        // Reuse Existing Precompiled Header If Key Matches And No Input Is Newer
+        std::error_code errorCode;
+        if (std::filesystem::exists(outputFile, errorCode) && jenova::ReadStdStringFromFile(keyFile) == precompiledKey)
+        {
+            bool isUpToDate = std::filesystem::exists(dependencyFile, errorCode);
+            auto outputTime = std::filesystem::last_write_time(outputFile, errorCode);
+            if (isUpToDate)
+            {
+                for (const auto& dependency : jenova::ParseScriptDependencyFile(dependencyFile))
+                {
+                    auto dependencyTime = std::filesystem::last_write_time(dependency, errorCode);
+                    if (errorCode || dependencyTime > outputTime) { isUpToDate = false; break; }
+                }
+            }
+            if (isUpToDate) return true;
+        }
+
+        // Build Precompiled Header
+        auto buildStartTime = std::chrono::steady_clock::now();
+        std::filesystem::remove(keyFile, errorCode);
+        std::filesystem::remove(outputFile, errorCode);
+        if (!jenova::WriteStdStringToFile(headerFile, headerContent)) return false;
+        if (jenova::ExecuteCommand(std::string(), buildCommand) != 0 || !std::filesystem::exists(outputFile, errorCode))
+        {
+            jenova::Warning("Jenova Compiler", "Failed to Build Precompiled Header, Scripts Will Be Compiled Without It.");
+            return false;
+        }
+        jenova::WriteStdStringToFile(keyFile, precompiledKey);
+
+        // Verbose
+        auto buildTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - buildStartTime).count();
+        jenova::VerboseByID(__LINE__, "Precompiled Header Built In %lld ms.", int64_t(buildTime));
+        return true;
+    }
+
+    // Content-Addressed Script Object Store
+    class ScriptObjectStore
+    {
+    public:
+        ScriptObjectStore(const Dictionary& compilerSettings, const std::string& jenovaCachePath, const std::string& compilerIdentity, const std::string& compilerFlags)
+        {
+            // Solve Store Capacity [Megabytes, Zero Disables Store]
+            int64_t storeCapacity = int64_t(compilerSettings.get("cpp_object_store_size", 0));
+            if (storeCapacity <= 0) return;
+
+            // Solve Store Directory [Shared Local Directory or Project Cache]
+            String sharedStorePath = compilerSettings.get("cpp_object_store_path", String());
+            this->storePath = sharedStorePath.is_empty() ? jenovaCachePath + jenova::GlobalSettings::JenovaObjectStoreDirectory : AS_STD_STRING(sharedStorePath) + "/";
+            std::error_code errorCode;
+            std::filesystem::create_directories(this->storePath, errorCode);
+            if (errorCode)
+            {
+                jenova::Warning("Jenova Compiler", "Failed to Create Object Store At (%s), Object Store Disabled.", this->storePath.c_str());
+                return;
+            }
+
+            // Strip Project Location From Flags [Allows Sharing Objects Between Projects]
+            std::string configurationFlags = compilerFlags;
+            std::string projectDirectory = AS_STD_STRING(jenova::GetJenovaProjectDirectory());
+            if (!projectDirectory.empty()) jenova::ReplaceAllMatchesWithString(configurationFlags, projectDirectory, "<Project>");
+
+            // Collect Project Location Spellings Used By Compiler Outputs [Escaped, Native & Generic Separators]
+            if (!projectDirectory.empty())
+            {
+                std::string genericDirectory = std::filesystem::path(projectDirectory).lexically_normal().generic_string();
+                if (genericDirectory.back() != '/') genericDirectory += '/';
+                std::string nativeDirectory = jenova::ReplaceAllMatchesWithStringAndReturn(genericDirectory, "/", "\\");
+                this->projectDirectoryForms.push_back({ jenova::ReplaceAllMatchesWithStringAndReturn(nativeDirectory, "\\", "\\\\"), "<Project>\\\\" });
+                this->projectDirectoryForms.push_back({ nativeDirectory, "<Project>\\" });
+                this->projectDirectoryForms.push_back({ genericDirectory, "<Project>/" });
+            }
+
+            // Set Store Configuration
+            this->storeCapacity = uint64_t(storeCapacity) * 1024 * 1024;
+            this->configurationKey = compilerIdentity + "\n" + configurationFlags;
+        }
+        bool IsEnabled() const
+        {
+            return this->storeCapacity != 0;
+        }
+        void AddSharedDependencyFile(const std::string& dependencyFile)
+        {
+            this->sharedDependencyFiles.push_back(dependencyFile);
+        }
+        bool RestoreObject(const jenova::ScriptModule& scriptModule)
+        {
+            // Validate Store
+            if (!IsEnabled()) return false;
+
+            // Find Manifest Entry Whose Recorded Dependencies Still Match
+            std::string sourceKey = GetSourceKey(scriptModule);
+            for (const auto& manifestEntry : ReadManifest(sourceKey))
+            {
+                bool dependenciesMatch = true;
+                for (const auto& dependency : manifestEntry["Dependencies"].items())
+                {
+                    if (GetFileHash(ResolveProjectDirectory(dependency.key())) != dependency.value().get<std::string>()) { dependenciesMatch = false; break; }
+                }
+                if (!dependenciesMatch) continue;
+
+                // Restore Object & Dependency File [Dependency Paths Re-Resolved Against Current Project]
+                std::error_code errorCode;
+                std::string storedObject = GetEntryPath(manifestEntry["Object"].get<std::string>());
+                if (!std::filesystem::copy_file(storedObject + ".obj", AS_STD_STRING(scriptModule.scriptObjectFile), std::filesystem::copy_options::overwrite_existing, errorCode)) continue;
+                for (const std::string dependencyExtension : { jenova::GlobalSettings::ScriptDependencyFileExtension, jenova::GlobalSettings::ScriptSourceDependenciesFileExtension })
+                {
+                    if (!std::filesystem::exists(storedObject + dependencyExtension, errorCode)) continue;
+                    std::string dependencyContent = jenova::ReadStdStringFromFile(storedObject + dependencyExtension);
+                    jenova::WriteStdStringToFile(AS_STD_STRING(scriptModule.scriptCacheFile) + dependencyExtension, ResolveProjectDirectory(dependencyContent));
+                }
+
+                // Mark As Recently Used
+                std::filesystem::last_write_time(storedObject + ".obj", std::filesystem::file_time_type::clock::now(), errorCode);
+                return true;
+            }
+            return false;
+        }
+        void StoreObject(const jenova::ScriptModule& scriptModule)
+        {
+            // Validate Store
+            if (!IsEnabled()) return;
+
+            // Collect Dependencies Reported By Compiler
+            std::string dependencyExtension = jenova::GlobalSettings::ScriptDependencyFileExtension;
+            if (!std::filesystem::exists(AS_STD_STRING(scriptModule.scriptCacheFile) + dependencyExtension)) dependencyExtension = jenova::GlobalSettings::ScriptSourceDependenciesFileExtension;
+            std::vector<std::string> dependencyFiles = this->sharedDependencyFiles;
+            dependencyFiles.push_back(AS_STD_STRING(scriptModule.scriptCacheFile) + dependencyExtension);
+            jenova::json_t dependencies = jenova::json_t::object();
+            for (const auto& dependencyFile : dependencyFiles)
+            {
+                if (!std::filesystem::exists(dependencyFile)) continue;
+                for (const auto& dependency : jenova::ParseScriptDependencyFile(dependencyFile))
+                {
+                    std::string dependencyHash = GetFileHash(dependency);
+                    if (!dependencyHash.empty()) dependencies[StripProjectDirectory(dependency)] = dependencyHash;
+                }
+            }
+
+            // Publish Object [Copied Then Renamed So Concurrent Readers Never See Partial Files]
+            std::string sourceKey = GetSourceKey(scriptModule);
+            std::string objectKey = AS_STD_STRING(String((sourceKey + "\n" + dependencies.dump()).c_str()).md5_text());
+            std::string storedObject = GetEntryPath(objectKey);
+            std::error_code errorCode;
+            std::filesystem::create_directories(std::filesystem::path(storedObject).parent_path(), errorCode);
+            if (!PublishFile(AS_STD_STRING(scriptModule.scriptObjectFile), storedObject + ".obj")) return;
+            PublishContent(StripProjectDirectory(jenova::ReadStdStringFromFile(AS_STD_STRING(scriptModule.scriptCacheFile) + dependencyExtension)), storedObject + dependencyExtension);
+
+            // Update Manifest [Most Recent Entry First]
+            jenova::json_t manifest = jenova::json_t::array();
+            manifest.push_back({ { "Object", objectKey }, { "Dependencies", dependencies } });
+            for (const auto& manifestEntry : ReadManifest(sourceKey))
+            {
+                if (manifest.size() >= jenova::GlobalSettings::ObjectStoreManifestEntries) break;
+                if (manifestEntry["Object"].get<std::string>() != objectKey) manifest.push_back(manifestEntry);
+            }
+            PublishContent(manifest.dump(), GetEntryPath(sourceKey) + ".manifest");
+        }
+        void EvictObjects()
+        {
+            // Validate Store
+            if (!IsEnabled()) return;
+
+            // Merge Usage Added By This Build Into Shared Usage [Store Is Only Walked When Over Capacity]
+            uint64_t storeUsage = ReadStoreUsage() + this->addedUsage;
+            this->addedUsage = 0;
+            if (storeUsage <= this->storeCapacity)
+            {
+                WriteStoreUsage(storeUsage);
+                return;
+            }
+
+            // Collect Stored Objects & Total Size
+            struct StoredObject { std::filesystem::path objectPath; std::filesystem::file_time_type lastUsed; };
+            std::vector<StoredObject> storedObjects;
+            uint64_t storeSize = 0;
+            std::error_code errorCode;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(this->storePath, errorCode))
+            {
+                if (!entry.is_regular_file(errorCode)) continue;
+                storeSize += entry.file_size(errorCode);
+                if (entry.path().extension() == ".obj") storedObjects.push_back({ entry.path(), entry.last_write_time(errorCode) });
+            }
+            if (storeSize <= this->storeCapacity) return;
+
+            // Remove Least Recently Used Objects Until Store Fits Capacity
+            std::sort(storedObjects.begin(), storedObjects.end(), [](const StoredObject& a, const StoredObject& b) { return a.lastUsed < b.lastUsed; });
+            const std::string entryExtensions[] = { ".obj", jenova::GlobalSettings::ScriptDependencyFileExtension, jenova::GlobalSettings::ScriptSourceDependenciesFileExtension };
+            size_t evictedObjects = 0;
+            for (const auto& storedObject : storedObjects)
+            {
+                if (storeSize <= this->storeCapacity) break;
+                for (const auto& entryExtension : entryExtensions)
+                {
+                    std::filesystem::path entryPath = std::filesystem::path(storedObject.objectPath).replace_extension(entryExtension);
+                    uintmax_t entrySize = std::filesystem::file_size(entryPath, errorCode);
+                    if (!errorCode && std::filesystem::remove(entryPath, errorCode)) storeSize -= std::min<uint64_t>(storeSize, entrySize);
+                }
+                evictedObjects++;
+            }
+
+            // Record Measured Usage & Verbose
+            WriteStoreUsage(storeSize);
+            jenova::VerboseByID(__LINE__, "Object Store Evicted (%zu) Objects, Store Size (%llu) Bytes.", evictedObjects, (unsigned long long)storeSize);
+        }
+
+    private:
+        std::string GetSourceKey(const jenova::ScriptModule& scriptModule)
+        {
+            return AS_STD_STRING(String((this->configurationKey + "\n" + GetFileHash(AS_STD_STRING(scriptModule.scriptCacheFile))).c_str()).md5_text());
+        }
+        std::string GetEntryPath(const std::string& entryKey) const
+        {
+            return this->storePath + entryKey.substr(0, 2) + "/" + entryKey;
+        }
+        std::string GetFileHash(const std::string& filePath)
+        {
+            auto cachedHash = this->fileHashes.find(filePath);
+            if (cachedHash != this->fileHashes.end()) return cachedHash->second;
+            std::string fileHash = std::filesystem::exists(filePath) ? AS_STD_STRING(jenova::GenerateMD5HashFromFile(String(filePath.c_str()))) : std::string();
+            this->fileHashes[filePath] = fileHash;
+            return fileHash;
+        }
+        jenova::json_t ReadManifest(const std::string& sourceKey) const
+        {
+            try
+            {
+                std::string manifestContent = jenova::ReadStdStringFromFile(GetEntryPath(sourceKey) + ".manifest");
+                if (!manifestContent.empty())
+                {
+                    jenova::json_t manifest = jenova::json_t::parse(manifestContent);
+                    if (manifest.is_array()) return manifest;
+                }
+            }
+            catch (const std::exception&) {}
+            return jenova::json_t::array();
+        }
+        std::string StripProjectDirectory(std::string storedContent) const
+        {
+            for (const auto& projectDirectoryForm : this->projectDirectoryForms) jenova::ReplaceAllMatchesWithString(storedContent, projectDirectoryForm.first, projectDirectoryForm.second);
+            return storedContent;
+        }
+        std::string ResolveProjectDirectory(std::string storedContent) const
+        {
+            for (const auto& projectDirectoryForm : this->projectDirectoryForms) jenova::ReplaceAllMatchesWithString(storedContent, projectDirectoryForm.second, projectDirectoryForm.first);
+            return storedContent;
+        }
+        std::string GetTemporaryPath(const std::string& storedFile) const
+        {
+            // Unique Per Process & Publish [Several Editors May Publish Same Entry Into Shared Store]
+            static std::atomic<uint64_t> temporaryCounter = 0;
+            return jenova::Format("%s.%lld.%llu.tmp", storedFile.c_str(), int64_t(OS::get_singleton()->get_process_id()), (unsigned long long)temporaryCounter.fetch_add(1));
+        }
+        bool PublishFile(const std::string& sourceFile, const std::string& storedFile)
+        {
+            std::error_code errorCode;
+            std::string temporaryFile = GetTemporaryPath(storedFile);
+            if (!std::filesystem::copy_file(sourceFile, temporaryFile, std::filesystem::copy_options::overwrite_existing, errorCode)) return false;
+            return CommitPublishedFile(temporaryFile, storedFile);
+        }
+        bool PublishContent(const std::string& fileContent, const std::string& storedFile)
+        {
+            std::string temporaryFile = GetTemporaryPath(storedFile);
+            if (!jenova::WriteStdStringToFile(temporaryFile, fileContent)) return false;
+            return CommitPublishedFile(temporaryFile, storedFile);
+        }
+        bool CommitPublishedFile(const std::string& temporaryFile, const std::string& storedFile)
+        {
+            // Track Usage Delta Of Replaced Entry
+            std::error_code errorCode;
+            uintmax_t publishedSize = std::filesystem::file_size(temporaryFile, errorCode);
+            uintmax_t replacedSize = std::filesystem::file_size(storedFile, errorCode);
+            if (errorCode) replacedSize = 0;
+            std::filesystem::rename(temporaryFile, storedFile, errorCode);
+            if (errorCode)
+            {
+                std::filesystem::remove(temporaryFile, errorCode);
+                return false;
+            }
+            this->addedUsage += publishedSize - std::min<uint64_t>(publishedSize, replacedSize);
+            return true;
+        }
+        uint64_t ReadStoreUsage()
+        {
+            // Measure Store Once If Usage Was Never Recorded
+            std::string usageContent = jenova::ReadStdStringFromFile(this->storePath + jenova::GlobalSettings::JenovaObjectStoreUsageFile);
+            if (!usageContent.empty()) return std::strtoull(usageContent.c_str(), nullptr, 10);
+            uint64_t storeUsage = 0;
+            std::error_code errorCode;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(this->storePath, errorCode))
+            {
+                if (entry.is_regular_file(errorCode)) storeUsage += entry.file_size(errorCode);
+            }
+            return storeUsage;
+        }
+        void WriteStoreUsage(uint64_t storeUsage)
+        {
+            std::string usageFile = this->storePath + jenova::GlobalSettings::JenovaObjectStoreUsageFile;
+            std::string temporaryFile = GetTemporaryPath(usageFile);
+            std::error_code errorCode;
+            if (jenova::WriteStdStringToFile(temporaryFile, std::to_string(storeUsage))) std::filesystem::rename(temporaryFile, usageFile, errorCode);
+        }
+
+    private:
+        uint64_t storeCapacity = 0;
+        uint64_t addedUsage = 0;
+        std::string storePath;
+        std::string configurationKey;
+        std::vector<std::pair<std::string, std::string>> projectDirectoryForms;
+        std::vector<std::string> sharedDependencyFiles;
+        std::unordered_map<std::string, std::string> fileHashes;
+    };
+
     // Windows Compilers
     #ifdef TARGET_PLATFORM_WINDOWS
 
@@ -60,6 +415,8 @@ namespace jenova
                 internalDefaultSettings["cpp_conformance_mode"]                 = true;                             /* /permissive vs /permissive- */
                 internalDefaultSettings["cpp_exception_handling"]               = 2;                                /* 1 : /EHsc 2: /EHa */
                 internalDefaultSettings["cpp_use_task_system"]                  = false;                            /* Internal Multiprocessing vs Task System */
+                internalDefaultSettings["cpp_compiler_workers"]                 = 0;                                /* Task System Worker Count [0 : Auto] */
+                internalDefaultSettings["cpp_precompiled_header"]               = true;                             /* /Yc /Yu Jenova.Precompiled.hpp */
                 internalDefaultSettings["cpp_extra_compiler"]                   = "/Ot /Ox /GR /bigobj";            /* Extra Compiler Options Like /Zc:threadSafeInit /Bt /Zc:tlsGuards /d1reportTime */
                 internalDefaultSettings["cpp_definitions"]                      = "TYPED_METHOD_BIND;HOT_RELOAD_ENABLED;_WINDLL";
 
@@ -104,6 +461,8 @@ namespace jenova
                 internalDefaultSettings["cpp_conformance_mode"]                 = true;                             /* /permissive vs /permissive- */
                 internalDefaultSettings["cpp_exception_handling"]               = 2;                                /* 1 : /EHsc 2: /EHa */
                 internalDefaultSettings["cpp_use_task_system"]                  = true;                             /* Internal Multiprocessing vs Task System */
+                internalDefaultSettings["cpp_compiler_workers"]                 = 0;                                /* Task System Worker Count [0 : Auto] */
+                internalDefaultSettings["cpp_precompiled_header"]               = true;                             /* /Yc /Yu Jenova.Precompiled.hpp */
                 internalDefaultSettings["cpp_extra_compiler"]                   = "/Ot /Ox /GR /bigobj -w";         /* Extra Compiler Options Like /Zc:threadSafeInit /Bt /Zc:tlsGuards /d1reportTime */
                 internalDefaultSettings["cpp_definitions"]                      = "TYPED_METHOD_BIND;HOT_RELOAD_ENABLED;_WINDLL";
 
@@ -144,37 +503,8 @@ namespace jenova
             jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
             if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
 
-            // Preprocessor Definitions [Header]
-            String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
-
-            // Preprocessor Definitions [Version]
-            preprocessorDefinitions += String(jenova::Format("#define JENOVA_VERSION \"%d.%d.%d.%d\"\n",
-                jenova::GlobalSettings::JenovaBuildVersion[0], jenova::GlobalSettings::JenovaBuildVersion[1],
-                jenova::GlobalSettings::JenovaBuildVersion[2], jenova::GlobalSettings::JenovaBuildVersion[3]).c_str());
-
-            // Preprocessor Definitions [Compiler]
-            if (this->GetCompilerModel() == CompilerModel::MicrosoftCompiler)
-            {
-                preprocessorDefinitions += "#define JENOVA_COMPILER \"Microsoft Visual C++ Compiler\"\n";
-                preprocessorDefinitions += "#define MSVC_COMPILER\n";
-            }
-            if (this->GetCompilerModel() == CompilerModel::ClangLLVMCompiler)
-            {
-                preprocessorDefinitions += "#define JENOVA_COMPILER \"Microsoft Visual C++ Compiler LLVM\"\n";
-                preprocessorDefinitions += "#define MSVC_LLVM_COMPILER\n";
-            }
-
-            // Preprocessor Definitions [Linking]
-            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Statically) preprocessorDefinitions += "#define JENOVA_SDK_STATIC_LINKING\n";
-            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Dynamically) preprocessorDefinitions += "#define JENOVA_SDK_DYNAMIC_LINKING\n";
-
-            // Preprocessor Definitions [User]
-            String userPreprocessorDefinitions = preprocessorSettings["PreprocessorDefinitions"];
-            PackedStringArray userPreprocessorDefinitionsList = userPreprocessorDefinitions.split(";");
-            for (const auto& definition : userPreprocessorDefinitionsList) if (!definition.is_empty()) preprocessorDefinitions += "#define " + definition + "\n";
-
-            // Add Final Preprocessor Definitions
-            scriptSourceCode = scriptSourceCode.insert(0, preprocessorDefinitions + "\n");
+            // Add Final Preprocessor Definitions [Shared With Precompiled Header]
+            scriptSourceCode = scriptSourceCode.insert(0, GeneratePreprocessorDefinitions(preprocessorSettings["PreprocessorDefinitions"]) + "\n");
 
             // Replecements
             scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptToolIdentifier, "#define TOOL_SCRIPT");
@@ -354,37 +684,19 @@ namespace jenova
                 return result;
             }
 
-            // Check If Any Changes Applied to Headers
-            if (buildCacheDatabase.contains("Headers"))
-            {
-                // Detect Changes
-                bool detectedHeaderChanges = false;
-                PackedStringArray cppHeaderFiles = compilerSettings["CppHeaderFiles"];
-                for (const auto& cppHeaderFile : cppHeaderFiles)
-                {
-                    String cppHeaderUID = jenova::GenerateStandardUIDFromPath(cppHeaderFile);
-                    String cppHeaderHash = jenova::GenerateMD5HashFromFile(cppHeaderFile);
-                    if (buildCacheDatabase["Headers"].contains(AS_STD_STRING(cppHeaderUID)))
-                    {
-                        if (AS_STD_STRING(cppHeaderHash) != buildCacheDatabase["Headers"][AS_STD_STRING(cppHeaderUID)].get<std::string>())
-                        {
-                            detectedHeaderChanges = true;
-                            break;
-                        }
-                    }
-                }
-                if (buildCacheDatabase.contains("HeaderCount"))
-                {
-                    int headerCount = buildCacheDatabase["HeaderCount"].get<int>();
-                    if (headerCount != cppHeaderFiles.size()) detectedHeaderChanges = true;
-                }
+            // Reset Cache of Scripts Affected By Header Changes [Uses Include Graph From Build Cache]
+            jenova::InvalidateBuildCacheByHeaderChanges(buildCacheDatabase, compilerSettings["CppHeaderFiles"]);
 
-                // If Contains Changes Reset All Script Cache
-                if (detectedHeaderChanges)
-                {
-                    if (buildCacheDatabase.contains("Modules")) for (const auto& scriptModule : buildCacheDatabase["Modules"].items()) scriptModule.value() = "No Hash";
-                }
-            }
+            // Prepare Precompiled Header Before Reusing Objects [Objects Built With /Yu Need Its Object At Link]
+            std::string precompiledHeaderArgument = PreparePrecompiledHeaderArgument(compilerSettings, compilerArgument + AS_STD_STRING(String(compilerSettings["cpp_extra_compiler"])) + " ");
+            bool precompiledHeaderFailed = bool(compilerSettings.get("cpp_precompiled_header", false)) && precompiledHeaderArgument.empty();
+            if (precompiledHeaderFailed) jenova::VerboseByID(__LINE__, "Precompiled Header Unavailable, Unchanged Scripts Are Restored or Rebuilt Without It.");
+
+            // Open Object Store [Keyed By Preprocessed Source, Compiler Identity & Flags]
+            std::string objectStoreFlags = compilerArgument + AS_STD_STRING(String(compilerSettings["cpp_extra_compiler"]));
+            if (!precompiledHeaderArgument.empty()) objectStoreFlags += "[PrecompiledHeader]";
+            ScriptObjectStore objectStore(compilerSettings, this->jenovaCachePath, QueryCompilerIdentity(this->compilerBinaryPath), objectStoreFlags);
+            objectStore.AddSharedDependencyFile(this->jenovaCachePath + jenova::GlobalSettings::JenovaPrecompiledSourceFile + jenova::GlobalSettings::ScriptSourceDependenciesFileExtension);
 
             // Add Source/Output Based On Compile Model
             jenova::ModuleList compilationScripts;
@@ -392,8 +704,8 @@ namespace jenova
             {
                 for (const auto& scriptModule : scriptModulesContainer.scriptModules)
                 {
-                    // Skip If File Hash Didn't Change
-                    if (buildCacheDatabase.contains("Modules"))
+                    // Skip If File Hash Didn't Change [Unless Its Object Depends On Failed Precompiled Header]
+                    if (buildCacheDatabase.contains("Modules") && !precompiledHeaderFailed)
                     {
                         if (buildCacheDatabase["Modules"].contains(AS_STD_STRING(scriptModule.scriptUID)))
                         {
@@ -401,6 +713,13 @@ namespace jenova
                         }
                     }
 
+                    // Restore Object If Same Source Was Built Before [Store Is Keyed Without Header When It Failed]
+                    if (objectStore.RestoreObject(scriptModule))
+                    {
+                        result.scriptsRestored++;
+                        continue;
+                    }
+
                     // Add Source
                     compilationScripts.push_back(scriptModule);
 
@@ -415,10 +734,17 @@ namespace jenova
                 {
                     if (buildCacheDatabase["Modules"].contains(AS_STD_STRING(scriptModulesContainer.scriptModule.scriptUID)))
                     {
-                        if (AS_STD_STRING(scriptModulesContainer.scriptModule.scriptHash) != buildCacheDatabase["Modules"][AS_STD_STRING(scriptModulesContainer.scriptModule.scriptUID)].get<std::string>())
+                        if (precompiledHeaderFailed || AS_STD_STRING(scriptModulesContainer.scriptModule.scriptHash) != buildCacheDatabase["Modules"][AS_STD_STRING(scriptModulesContainer.scriptModule.scriptUID)].get<std::string>())
                         {
-                            compilationScripts.push_back(scriptModulesContainer.scriptModule);
-                            result.scriptsCount++;
+                            if (objectStore.RestoreObject(scriptModulesContainer.scriptModule))
+                            {
+                                result.scriptsRestored++;
+                            }
+                            else
+                            {
+                                compilationScripts.push_back(scriptModulesContainer.scriptModule);
+                                result.scriptsCount++;
+                            }
                         }
                     }
                 }
@@ -436,6 +762,9 @@ namespace jenova
             // Add Extra Options
             compilerArgument += AS_STD_STRING(String(compilerSettings["cpp_extra_compiler"])) + " ";
 
+            // Add Precompiled Header [Built Once Per Toolchain & Configuration]
+            compilerArgument += precompiledHeaderArgument;
+
             // Dump Compiler Command If Developer Mode Enabled
             if (jenova::GlobalStorage::DeveloperModeActivated) jenova::WriteStdStringToFile(jenovaCachePath + "CompilerCommand.txt", compilerArgument);
 
@@ -449,7 +778,7 @@ namespace jenova
                     jenova::Output("Using Task System for Multi-Processing...");
 
                     // Compile Scripts
-                    std::vector<jenova::TaskID> compilationTasks;
+                    std::vector<jenova::TaskFunction> compilationTasks;
                     bool compilationFailed = false;
                     std::mutex compilationMutex;
                     std::vector<std::string> errorMessages;
@@ -458,6 +787,7 @@ namespace jenova
                     for (const auto& scriptModule : compilationScripts)
                     {
                         std::string command = compilerArgument;
+                        command += "/sourceDependencies \"" + this->jenovaCachePath + "\" ";
                         command += "\"" + AS_STD_STRING(scriptModule.scriptCacheFile) + "\" ";
                         command += "-o \"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
 
@@ -465,8 +795,8 @@ namespace jenova
                         jenova::ReplaceAllMatchesWithString(command, "\\", "/");
                         jenova::ReplaceAllMatchesWithString(command, "\\\\", "/");
 
-                        // Initiate Compilation Task
-                        jenova::TaskID taskID = JenovaTaskSystem::InitiateTask([command, &compilationFailed, &compilationMutex, &errorMessages]()
+                        // Queue Compilation Task
+                        compilationTasks.push_back([command, &compilationFailed, &compilationMutex, &errorMessages]()
                         {
                             STARTUPINFOW si;
                             PROCESS_INFORMATION pi;
@@ -514,18 +844,10 @@ namespace jenova
                                 errorMessages.push_back(compilerOutput);
                             }
                         });
-                        compilationTasks.push_back(taskID);
                     }
 
-                    // Wait for all tasks to complete
-                    for (const auto& taskID : compilationTasks)
-                    {
-                        while (!JenovaTaskSystem::IsTaskComplete(taskID))
-                        {
-                            std::this_thread::yield();
-                        }
-                        JenovaTaskSystem::ClearTask(taskID);
-                    }
+                    // Run Tasks On Bounded Worker Pool [Blocks Until All Tasks Complete]
+                    JenovaTaskSystem::ExecuteTaskBatch(compilationTasks, ResolveCompilerWorkerCount(compilerSettings));
 
                     // Check Compile Result
                     if (compilationFailed)
@@ -540,6 +862,10 @@ namespace jenova
                         return result;
                     }
 
+                    // Publish Compiled Objects to Object Store
+                    for (const auto& compiledScript : compilationScripts) objectStore.StoreObject(compiledScript);
+                    objectStore.EvictObjects();
+
                     // Set Compiler Result
                     result.compileResult = !compilationFailed;
                     result.hasError = !compilationFailed;
@@ -562,6 +888,9 @@ namespace jenova
                     compilerArgument += "/MP ";
                     compilerArgument += "/Fo\"" + this->jenovaCachePath + "\" ";
 
+                    // Emit Source Dependencies Per Script [Written As Source Name + .json]
+                    compilerArgument += "/sourceDependencies \"" + this->jenovaCachePath + "\" ";
+
                     // Add Compilation Scripts to Compiler Argument
                     for (const auto& scriptModule : compilationScripts)
                     {
@@ -576,6 +905,7 @@ namespace jenova
             {
                 compilerArgument += "\"" + AS_STD_STRING(scriptModulesContainer.scriptModule.scriptCacheFile) + "\" ";
                 compilerArgument += "/Fo\"" + AS_STD_STRING(scriptModulesContainer.scriptModule.scriptObjectFile) + "\" ";
+                compilerArgument += "/sourceDependencies \"" + this->jenovaCachePath + "\" ";
             }
 
             // Run Compiler
@@ -674,6 +1004,13 @@ namespace jenova
             CloseHandle(pi.hThread);
             CloseHandle(hStdOutRead);
 
+            // Publish Compiled Objects to Object Store
+            if (exitCode == 0)
+            {
+                for (const auto& compiledScript : compilationScripts) objectStore.StoreObject(compiledScript);
+                objectStore.EvictObjects();
+            }
+
             // Set the compiler result
             result.compileResult = (exitCode == 0);
             result.hasError = (exitCode != 0);
@@ -758,6 +1095,12 @@ namespace jenova
                     return result;
                 };
 
+            // Per-Script Modules Are Linked By Linux Toolchains Only [This Linker Falls Back to Single Module]
+            if (jenova::GlobalStorage::ModuleBuildMode == jenova::ModuleBuildMode::PerScript)
+            {
+                jenova::Warning("Jenova Compiler", "Per-Script Modules Require GNU or Clang Linux Toolchain, Linking Single Module.");
+            }
+
             // Generate Linker Arguments
             std::string linkerArgument;
             linkerArgument += "\"" + this->linkerBinaryPath + "\" ";
@@ -811,6 +1154,10 @@ namespace jenova
             // Add Object Files
             for (const auto& scriptModule : scriptModules) linkerArgument += "\"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
 
+            // Add Precompiled Header Object
+            std::string precompiledObjectFile = std::filesystem::path(this->jenovaCachePath + jenova::GlobalSettings::JenovaPrecompiledSourceFile).replace_extension(".obj").string();
+            if (bool(linkerSettings.get("cpp_precompiled_header", false)) && std::filesystem::exists(precompiledObjectFile)) linkerArgument += "\"" + precompiledObjectFile + "\" ";
+
             // Add Extra Options
             linkerArgument += AS_STD_STRING(String(linkerSettings["cpp_extra_linker"])) + " ";
 
@@ -989,6 +1336,75 @@ namespace jenova
         }
 
     private:
+        String GeneratePreprocessorDefinitions(const String& userPreprocessorDefinitions)
+        {
+            // Preprocessor Definitions [Header]
+            String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
+
+            // Preprocessor Definitions [Version]
+            preprocessorDefinitions += String(jenova::Format("#define JENOVA_VERSION \"%d.%d.%d.%d\"\n",
+                jenova::GlobalSettings::JenovaBuildVersion[0], jenova::GlobalSettings::JenovaBuildVersion[1],
+                jenova::GlobalSettings::JenovaBuildVersion[2], jenova::GlobalSettings::JenovaBuildVersion[3]).c_str());
+
+            // Preprocessor Definitions [Compiler]
+            if (this->GetCompilerModel() == CompilerModel::MicrosoftCompiler)
+            {
+                preprocessorDefinitions += "#define JENOVA_COMPILER \"Microsoft Visual C++ Compiler\"\n";
+                preprocessorDefinitions += "#define MSVC_COMPILER\n";
+            }
+            if (this->GetCompilerModel() == CompilerModel::ClangLLVMCompiler)
+            {
+                preprocessorDefinitions += "#define JENOVA_COMPILER \"Microsoft Visual C++ Compiler LLVM\"\n";
+                preprocessorDefinitions += "#define MSVC_LLVM_COMPILER\n";
+            }
+
+            // Preprocessor Definitions [Linking]
+            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Statically) preprocessorDefinitions += "#define JENOVA_SDK_STATIC_LINKING\n";
+            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Dynamically) preprocessorDefinitions += "#define JENOVA_SDK_DYNAMIC_LINKING\n";
+
+            // Preprocessor Definitions [User]
+            PackedStringArray userPreprocessorDefinitionsList = userPreprocessorDefinitions.split(";");
+            for (const auto& definition : userPreprocessorDefinitionsList) if (!definition.is_empty()) preprocessorDefinitions += "#define " + definition + "\n";
+
+            // Return Definitions
+            return preprocessorDefinitions;
+        }
+        std::string PreparePrecompiledHeaderArgument(const Dictionary& compilerSettings, const std::string& compilerArgument)
+        {
+            // Check If Precompiled Header Enabled
+            if (!bool(compilerSettings.get("cpp_precompiled_header", false))) return std::string();
+
+            // Solve Precompiled Header Files
+            std::string headerFile = this->jenovaCachePath + jenova::GlobalSettings::JenovaPrecompiledHeaderFile;
+            std::string sourceFile = this->jenovaCachePath + jenova::GlobalSettings::JenovaPrecompiledSourceFile;
+            std::string outputFile = std::filesystem::path(headerFile).replace_extension(".pch").string();
+            std::string objectFile = std::filesystem::path(sourceFile).replace_extension(".obj").string();
+            std::string dependencyFile = sourceFile + jenova::GlobalSettings::ScriptSourceDependenciesFileExtension;
+
+            // Generate Precompiled Header [Definitions Must Match Preprocessed Scripts]
+            std::string headerContent = "// Jenova Precompiled Header\n";
+            headerContent += AS_STD_STRING(GeneratePreprocessorDefinitions(compilerSettings.get("PreprocessorDefinitions", String())));
+            headerContent += "\n#include <Godot/godot.hpp>\n#include <JenovaSDK.h>\n";
+
+            // Generate Precompiled Source [Header Is Force Included]
+            if (!std::filesystem::exists(sourceFile) && !jenova::WriteStdStringToFile(sourceFile, "// Jenova Precompiled Header Source\n")) return std::string();
+
+            // Build Precompiled Header If Missing or Outdated [Object Must Be Linked With Scripts]
+            std::string buildCommand = compilerArgument;
+            buildCommand += "/Yc\"" + headerFile + "\" /FI\"" + headerFile + "\" /Fp\"" + outputFile + "\" /Fo\"" + objectFile + "\" ";
+            buildCommand += "/sourceDependencies \"" + dependencyFile + "\" \"" + sourceFile + "\"";
+            if (!PreparePrecompiledHeader(headerFile, headerContent, outputFile, dependencyFile, buildCommand, QueryCompilerIdentity(this->compilerBinaryPath)))
+            {
+                // Scripts Compile Without Header, Stale Object Must Not Reach Linker
+                std::error_code errorCode;
+                std::filesystem::remove(objectFile, errorCode);
+                return std::string();
+            }
+
+            // Return Precompiled Header Arguments
+            return "/Yu\"" + headerFile + "\" /FI\"" + headerFile + "\" /Fp\"" + outputFile + "\" ";
+        }
+
         CompilerModel compilerModel = CompilerModel::Unspecified;
         Dictionary internalDefaultSettings;
         std::string projectPath;
@@ -1037,6 +1453,7 @@ namespace jenova
                 internalDefaultSettings["cpp_debug_database"]                   = true;                             /* -g */
                 internalDefaultSettings["cpp_exception_handling"]               = true;                             /* -fexceptions */
                 internalDefaultSettings["cpp_extra_compiler"]                   = "-O1 -pthread";                   /* Extra Compiler Options*/
+                internalDefaultSettings["cpp_compiler_workers"]                 = 0;                                /* Parallel Compiler Processes [0 : Auto] */
                 internalDefaultSettings["cpp_definitions"]                      = "TYPED_METHOD_BIND;HOT_RELOAD_ENABLED;_WINDLL"; /* REAL_T_IS_DOUBLE Removed for Now */
 
                 // MinGW GCC Linker Settings
@@ -1075,6 +1492,7 @@ namespace jenova
                 internalDefaultSettings["cpp_debug_database"]                   = true;                             /* -g */
                 internalDefaultSettings["cpp_exception_handling"]               = true;                             /* -fexceptions */
                 internalDefaultSettings["cpp_extra_compiler"]                   = "-O3 -pthread -femulated-tls";    /* Extra Compiler Options*/
+                internalDefaultSettings["cpp_compiler_workers"]                 = 0;                                /* Parallel Compiler Processes [0 : Auto] */
                 internalDefaultSettings["cpp_definitions"]                      = "TYPED_METHOD_BIND;HOT_RELOAD_ENABLED;_WINDLL"; /* REAL_T_IS_DOUBLE Removed for Now */
 
                 // MinGW Clang Linker Settings
@@ -1316,37 +1734,11 @@ namespace jenova
                 return result;
             }
 
-            // Check If Any Changes Applied to Headers
-            if (buildCacheDatabase.contains("Headers"))
-            {
-                // Detect Changes
-                bool detectedHeaderChanges = false;
-                PackedStringArray cppHeaderFiles = compilerSettings["CppHeaderFiles"];
-                for (const auto& cppHeaderFile : cppHeaderFiles)
-                {
-                    String cppHeaderUID = jenova::GenerateStandardUIDFromPath(cppHeaderFile);
-                    String cppHeaderHash = jenova::GenerateMD5HashFromFile(cppHeaderFile);
-                    if (buildCacheDatabase["Headers"].contains(AS_STD_STRING(cppHeaderUID)))
-                    {
-                        if (AS_STD_STRING(cppHeaderHash) != buildCacheDatabase["Headers"][AS_STD_STRING(cppHeaderUID)].get<std::string>())
-                        {
-                            detectedHeaderChanges = true;
-                            break;
-                        }
-                    }
-                }
-                if (buildCacheDatabase.contains("HeaderCount"))
-                {
-                    int headerCount = buildCacheDatabase["HeaderCount"].get<int>();
-                    if (headerCount != cppHeaderFiles.size()) detectedHeaderChanges = true;
-                }
+            // Reset Cache of Scripts Affected By Header Changes [Uses Include Graph From Build Cache]
+            jenova::InvalidateBuildCacheByHeaderChanges(buildCacheDatabase, compilerSettings["CppHeaderFiles"]);
 
-                // If Contains Changes Reset All Script Cache
-                if (detectedHeaderChanges)
-                {
-                    if (buildCacheDatabase.contains("Modules")) for (const auto& scriptModule : buildCacheDatabase["Modules"].items()) scriptModule.value() = "No Hash";
-                }
-            }
+            // Open Object Store [Keyed By Preprocessed Source, Compiler Identity & Flags]
+            ScriptObjectStore objectStore(compilerSettings, this->jenovaCachePath, QueryCompilerIdentity(this->compilerBinaryPath), compilerArgument);
 
             // Add Source/Output Based On Compile Model
             jenova::ModuleList compilationScripts;
@@ -1362,7 +1754,14 @@ namespace jenova
                             if (AS_STD_STRING(scriptModule.scriptHash) == buildCacheDatabase["Modules"][AS_STD_STRING(scriptModule.scriptUID)].get<std::string>()) continue;
                         }
                     }
-               
+
+                    // Restore Object If Same Source Was Built Before
+                    if (objectStore.RestoreObject(scriptModule))
+                    {
+                        result.scriptsRestored++;
+                        continue;
+                    }
+
                     // Add Source
                     compilationScripts.push_back(scriptModule);
 
@@ -1379,8 +1778,15 @@ namespace jenova
                     {
                         if (AS_STD_STRING(scriptModulesContainer.scriptModule.scriptHash) != buildCacheDatabase["Modules"][AS_STD_STRING(scriptModulesContainer.scriptModule.scriptUID)].get<std::string>())
                         {
-                            compilationScripts.push_back(scriptModulesContainer.scriptModule);
-                            result.scriptsCount++;
+                            if (objectStore.RestoreObject(scriptModulesContainer.scriptModule))
+                            {
+                                result.scriptsRestored++;
+                            }
+                            else
+                            {
+                                compilationScripts.push_back(scriptModulesContainer.scriptModule);
+                                result.scriptsCount++;
+                            }
                         }
                     }
                 }
@@ -1399,7 +1805,7 @@ namespace jenova
             if (jenova::GlobalStorage::DeveloperModeActivated) jenova::WriteStdStringToFile(jenovaCachePath + "CompilerCommand.txt", compilerArgument);
 
             // Compile Scripts
-            std::vector<jenova::TaskID> compilationTasks;
+            std::vector<jenova::TaskFunction> compilationTasks;
             bool compilationFailed = false;
             std::mutex compilationMutex;
             std::vector<std::string> errorMessages;
@@ -1408,6 +1814,7 @@ namespace jenova
             for (const auto& scriptModule : compilationScripts)
             {
                 std::string command = compilerArgument;
+                command += "-MMD -MF \"" + AS_STD_STRING(scriptModule.scriptCacheFile) + jenova::GlobalSettings::ScriptDependencyFileExtension + "\" ";
                 command += "\"" + AS_STD_STRING(scriptModule.scriptCacheFile) + "\" ";
                 command += "-o \"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
 
@@ -1415,8 +1822,8 @@ namespace jenova
                 jenova::ReplaceAllMatchesWithString(command, "\\", "/");
                 jenova::ReplaceAllMatchesWithString(command, "\\\\", "/");
 
-                // Initiate Compilation Task
-                jenova::TaskID taskID = JenovaTaskSystem::InitiateTask([command, &compilationFailed, &compilationMutex, &errorMessages]()
+                // Queue Compilation Task
+                compilationTasks.push_back([command, &compilationFailed, &compilationMutex, &errorMessages]()
                 {
                     STARTUPINFOW si;
                     PROCESS_INFORMATION pi;
@@ -1464,18 +1871,10 @@ namespace jenova
                         errorMessages.push_back(compilerOutput);
                     }
                 });
-                compilationTasks.push_back(taskID);
             }
 
-            // Wait for all tasks to complete
-            for (const auto& taskID : compilationTasks)
-            {
-                while (!JenovaTaskSystem::IsTaskComplete(taskID))
-                {
-                    std::this_thread::yield();
-                }
-                JenovaTaskSystem::ClearTask(taskID);
-            }
+            // Run Tasks On Bounded Worker Pool [Blocks Until All Tasks Complete]
+            JenovaTaskSystem::ExecuteTaskBatch(compilationTasks, ResolveCompilerWorkerCount(compilerSettings));
 
             // Check Compile Result
             if (compilationFailed)
@@ -1490,6 +1889,10 @@ namespace jenova
                 return result;
             }
 
+            // Publish Compiled Objects to Object Store
+            for (const auto& compiledScript : compilationScripts) objectStore.StoreObject(compiledScript);
+            objectStore.EvictObjects();
+
             // Set Compiler Result
             result.compileResult = !compilationFailed;
             result.hasError = !compilationFailed;
@@ -1574,6 +1977,12 @@ namespace jenova
                 return result;
             };
 
+            // Per-Script Modules Are Linked By Linux Toolchains Only [This Linker Falls Back to Single Module]
+            if (jenova::GlobalStorage::ModuleBuildMode == jenova::ModuleBuildMode::PerScript)
+            {
+                jenova::Warning("Jenova Compiler", "Per-Script Modules Require GNU or Clang Linux Toolchain, Linking Single Module.");
+            }
+
             // Generate Linker Arguments
             std::string linkerArgument;
             linkerArgument += "\"" + this->linkerBinaryPath + "\" ";
@@ -1887,6 +2296,8 @@ namespace jenova
             internalDefaultSettings["cpp_open_mp_support"]                  = true;                                 // -fopenmp
             internalDefaultSettings["cpp_debug_database"]                   = true;                                 // -g
             internalDefaultSettings["cpp_extra_compiler"]                   = "-O2 -march=native";                  // Extra Compiler Options
+            internalDefaultSettings["cpp_compiler_workers"]                 = 0;                                    // Parallel Compiler Processes [0 : Auto]
+            internalDefaultSettings["cpp_precompiled_header"]               = true;                                 // -include Jenova.Precompiled.hpp
             internalDefaultSettings["cpp_definitions"]                      = "TYPED_METHOD_BIND;HOT_RELOAD_ENABLED";
 
             // GNU Linker Settings
@@ -1923,29 +2334,8 @@ namespace jenova
             jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
             if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
 
-            // Preprocessor Definitions [Header]
-            String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
-
-            // Preprocessor Definitions [Version]
-            preprocessorDefinitions += String(jenova::Format("#define JENOVA_VERSION \"%d.%d.%d.%d\"\n",
-                jenova::GlobalSettings::JenovaBuildVersion[0], jenova::GlobalSettings::JenovaBuildVersion[1],
-                jenova::GlobalSettings::JenovaBuildVersion[2], jenova::GlobalSettings::JenovaBuildVersion[3]).c_str());
-
-            // Preprocessor Definitions [Compiler]
-            preprocessorDefinitions += "#define JENOVA_COMPILER \"GNU Compiler Collection\"\n";
-            preprocessorDefinitions += "#define GCC_COMPILER\n";
-
-            // Preprocessor Definitions [Linking]
-            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Statically) preprocessorDefinitions += "#define JENOVA_SDK_STATIC_LINKING\n";
-            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Dynamically) preprocessorDefinitions += "#define JENOVA_SDK_DYNAMIC_LINKING\n";
-
-            // Preprocessor Definitions [User]
-            String userPreprocessorDefinitions = preprocessorSettings["PreprocessorDefinitions"];
-            PackedStringArray userPreprocessorDefinitionsList = userPreprocessorDefinitions.split(";");
-            for (const auto& definition : userPreprocessorDefinitionsList) if (!definition.is_empty()) preprocessorDefinitions += "#define " + definition + "\n";
-
-            // Add Final Preprocessor Definitions
-            scriptSourceCode = scriptSourceCode.insert(0, preprocessorDefinitions + "\n");
+            // Add Final Preprocessor Definitions [Shared With Precompiled Header]
+            scriptSourceCode = scriptSourceCode.insert(0, GeneratePreprocessorDefinitions(preprocessorSettings["PreprocessorDefinitions"]) + "\n");
 
             // Replecements
             scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptToolIdentifier, "#define TOOL_SCRIPT");
@@ -2076,41 +2466,45 @@ namespace jenova
                 return result;
             }
 
-            // Check If Any Changes Applied to Headers
-            if (buildCacheDatabase.contains("Headers"))
-            {
-                // Detect Changes
-                bool detectedHeaderChanges = false;
-                PackedStringArray cppHeaderFiles = compilerSettings["CppHeaderFiles"];
-                for (const auto& cppHeaderFile : cppHeaderFiles)
-                {
-                    String cppHeaderUID = jenova::GenerateStandardUIDFromPath(cppHeaderFile);
-                    String cppHeaderHash = jenova::GenerateMD5HashFromFile(cppHeaderFile);
-                    if (buildCacheDatabase["Headers"].contains(AS_STD_STRING(cppHeaderUID)))
-                    {
-                        if (AS_STD_STRING(cppHeaderHash) != buildCacheDatabase["Headers"][AS_STD_STRING(cppHeaderUID)].get<std::string>())
-                        {
-                            detectedHeaderChanges = true;
-                            break;
-                        }
-                    }
-                }
-                if (buildCacheDatabase.contains("HeaderCount"))
-                {
-                    int headerCount = buildCacheDatabase["HeaderCount"].get<int>();
-                    if (headerCount != cppHeaderFiles.size()) detectedHeaderChanges = true;
-                }
+            // Reset Cache of Scripts Affected By Header Changes [Uses Include Graph From Build Cache]
+            jenova::InvalidateBuildCacheByHeaderChanges(buildCacheDatabase, compilerSettings["CppHeaderFiles"]);
 
-                // If Contains Changes, Reset All Script Cache
-                if (detectedHeaderChanges)
-                {
-                    if (buildCacheDatabase.contains("Modules")) for (auto& scriptModule : buildCacheDatabase["Modules"].items()) scriptModule.value() = "No Hash";
-                }
-            }
+            // Generate Shared Compiler Flags
+            std::string compilerFlags;
+
+            // Language Standards
+            if (String(compilerSettings["cpp_language_standards"]) == "cpp20") compilerFlags += "-std=c++20 ";
+            if (String(compilerSettings["cpp_language_standards"]) == "cpp17") compilerFlags += "-std=c++17 ";
+
+            // Debug Symbols
+            if (bool(compilerSettings["cpp_debug_database"])) compilerFlags += "-g ";
+
+            // Dynamic Base
+            if (bool(compilerSettings["cpp_dynamic_base"])) compilerFlags += "-fPIC ";
+
+            // Extra Compiler Flags
+            compilerFlags += AS_STD_STRING(String(compilerSettings["cpp_extra_compiler"])) + " ";
+
+            // Preprocessor Definitions
+            compilerFlags += GeneratePreprocessDefinitions(compilerSettings["cpp_definitions"]);
+
+            // Include Paths
+            compilerFlags += "-I./ ";
+            compilerFlags += "-I\"" + this->includePath + "\" ";
+            compilerFlags += "-I\"" + this->jenovaSDKPath + "\" ";
+            compilerFlags += "-I\"" + this->godotSDKPath + "\" ";
+            compilerFlags += GenerateAdditionalIncludeDirectories(compilerSettings["cpp_extra_include_directories"]);
+
+            // Open Object Store [Keyed By Preprocessed Source, Compiler Identity & Flags]
+            std::string compilerIdentity = QueryCompilerIdentity(AS_STD_STRING(String(compilerSettings["cpp_compiler_binary"])));
+            ScriptObjectStore objectStore(compilerSettings, this->jenovaCachePath, compilerIdentity, compilerFlags + (bool(compilerSettings.get("cpp_precompiled_header", false)) ? "[PrecompiledHeader]" : ""));
+            objectStore.AddSharedDependencyFile(this->jenovaCachePath + jenova::GlobalSettings::JenovaPrecompiledHeaderFile + ".gch" + jenova::GlobalSettings::ScriptDependencyFileExtension);
 
             // Create Task List for Parallel Compilation
-            std::vector<TaskID> taskIDs; size_t taskIndex = 0;
+            std::vector<jenova::TaskFunction> compilationTasks; size_t taskIndex = 0;
             std::vector<int> taskResults(scriptModulesContainer.scriptModules.size(), -1);
+            std::string precompiledHeaderArgument; bool precompiledHeaderPrepared = false;
+            jenova::ModuleList compiledScripts;
             for (const auto& scriptModule : scriptModulesContainer.scriptModules)
             {
                 // Skip If File Hash Didn't Change
@@ -2122,34 +2516,29 @@ namespace jenova
                     }
                 }
 
+                // Restore Object If Same Source Was Built Before
+                if (objectStore.RestoreObject(scriptModule))
+                {
+                    result.scriptsRestored++;
+                    continue;
+                }
+
+                // Prepare Precompiled Header Once [Only When Any Script Requires Compilation]
+                if (!precompiledHeaderPrepared)
+                {
+                    precompiledHeaderArgument = PreparePrecompiledHeaderArgument(compilerSettings, compilerFlags);
+                    precompiledHeaderPrepared = true;
+                }
+
                 // Generate Command for Each Script Module
                 std::string compilerArgument = AS_STD_STRING(String(compilerSettings["cpp_compiler_binary"]));
 
                 // Compile Without Linking
                 compilerArgument += " -c ";
 
-                // Language Standards
-                if (String(compilerSettings["cpp_language_standards"]) == "cpp20") compilerArgument += "-std=c++20 ";
-                if (String(compilerSettings["cpp_language_standards"]) == "cpp17") compilerArgument += "-std=c++17 ";
-
-                // Debug Symbols
-                if (bool(compilerSettings["cpp_debug_database"])) compilerArgument += "-g ";
-
-                // Dynamic Base
-                if (bool(compilerSettings["cpp_dynamic_base"])) compilerArgument += "-fPIC ";
-
-                // Extra Compiler Flags
-                compilerArgument += AS_STD_STRING(String(compilerSettings["cpp_extra_compiler"])) + " ";
-
-                // Preprocessor Definitions
-                compilerArgument += GeneratePreprocessDefinitions(compilerSettings["cpp_definitions"]);
-
-                // Include Paths
-                compilerArgument += "-I./ ";
-                compilerArgument += "-I\"" + this->includePath + "\" ";
-                compilerArgument += "-I\"" + this->jenovaSDKPath + "\" ";
-                compilerArgument += "-I\"" + this->godotSDKPath + "\" ";
-                compilerArgument += GenerateAdditionalIncludeDirectories(compilerSettings["cpp_extra_include_directories"]);
+                // Shared Compiler Flags & Precompiled Header
+                compilerArgument += compilerFlags;
+                compilerArgument += precompiledHeaderArgument;
 
                 // Add Source File
                 compilerArgument += "\"" + AS_STD_STRING(scriptModule.scriptCacheFile) + "\" ";
@@ -2157,9 +2546,13 @@ namespace jenova
                 // Specify Object File Output
                 compilerArgument += "-o \"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
 
+                // Emit Header Dependencies [Consumed By Build Cache Include Graph]
+                compilerArgument += "-MMD -MF \"" + AS_STD_STRING(scriptModule.scriptCacheFile) + jenova::GlobalSettings::ScriptDependencyFileExtension + "\" ";
+
                 // Store Task Index for Results
                 size_t currentTaskIndex = taskIndex++;
-                taskIDs.push_back(JenovaTaskSystem::InitiateTask([compilerArgument, &taskResults, currentTaskIndex, scriptModule]()
+                compiledScripts.push_back(scriptModule);
+                compilationTasks.push_back([compilerArgument, &taskResults, currentTaskIndex, scriptModule]()
                 {
                     // Run the compiler command using a process and capture its output
                     int pipefd[2];
@@ -2241,7 +2634,7 @@ namespace jenova
                             jenova::Output("Script [%s] Compilation Failed.", AS_C_STRING(scriptModule.scriptHash));
                         }
                     }
-                }));
+                });
 
                 // Increment Successfully Compiled Scripts
                 result.scriptsCount++;
@@ -2257,15 +2650,8 @@ namespace jenova
                 return result;
             }
 
-            // Wait for All Tasks to Complete
-            for (const auto& taskID : taskIDs)
-            {
-                while (!JenovaTaskSystem::IsTaskComplete(taskID))
-                {
-                    std::this_thread::yield();
-                }
-                JenovaTaskSystem::ClearTask(taskID);
-            }
+            // Run Tasks On Bounded Worker Pool [Blocks Until All Tasks Complete]
+            JenovaTaskSystem::ExecuteTaskBatch(compilationTasks, ResolveCompilerWorkerCount(compilerSettings));
 
             // Aggregate Results
             for (size_t i = 0; i < taskResults.size(); i++)
@@ -2283,6 +2669,10 @@ namespace jenova
                 }
             }
 
+            // Publish Compiled Objects to Object Store
+            for (const auto& compiledScript : compiledScripts) objectStore.StoreObject(compiledScript);
+            objectStore.EvictObjects();
+
             // Compilation Successful
             result.compileResult = true;
             result.hasError = false;
@@ -2362,88 +2752,92 @@ namespace jenova
                 return result;
             };
 
-            // Generate Linker Arguments
-            std::string linkerArgument = AS_STD_STRING(String(linkerSettings["cpp_linker_binary"]));
-            linkerArgument += " -o \"" + outputModule + "\" ";
-            if (result.hasDebugInformation && bool(linkerSettings["cpp_debug_symbol"])) linkerArgument += "-ggdb ";
-            linkerArgument += "-Wl,-Map=\"" + outputMap + "\" ";
-            linkerArgument += "-shared ";
-            linkerArgument += "-fPIC ";
-
-            // Machine Architecture
-            if (String(linkerSettings["cpp_machine_architecture"]) == "Linux64") linkerArgument += "-m64 ";
-            if (String(linkerSettings["cpp_machine_architecture"]) == "Linux32") linkerArgument += "-m32 ";
-
-            // Add Library Paths
-            linkerArgument += "-L./ ";
-            linkerArgument += "-L\"" + this->libraryPath + "\" ";
-            linkerArgument += "-L\"" + this->jenovaPath + "\" ";
-            linkerArgument += "-L\"" + this->jenovaSDKPath + "\" ";
-            linkerArgument += "-L\"" + this->godotSDKPath + "\" ";
-            linkerArgument += GenerateLibraryPaths(linkerSettings["cpp_extra_library_directories"]);
+            auto GenerateLinkerArgument = [&](const std::string& moduleOutput, const std::string& mapOutput, const jenova::ModuleList& linkModules, const std::string& linkInputs = std::string()) -> std::string
+            {
+                // Generate Linker Arguments
+                std::string linkerArgument = AS_STD_STRING(String(linkerSettings["cpp_linker_binary"]));
+                linkerArgument += " -o \"" + moduleOutput + "\" ";
+                if (result.hasDebugInformation && bool(linkerSettings["cpp_debug_symbol"])) linkerArgument += "-ggdb ";
+                linkerArgument += "-Wl,-Map=\"" + mapOutput + "\" ";
+                linkerArgument += "-shared ";
+                linkerArgument += "-fPIC ";
+
+                // Machine Architecture
+                if (String(linkerSettings["cpp_machine_architecture"]) == "Linux64") linkerArgument += "-m64 ";
+                if (String(linkerSettings["cpp_machine_architecture"]) == "Linux32") linkerArgument += "-m32 ";
+
+                // Add Library Paths
+                linkerArgument += "-L./ ";
+                linkerArgument += "-L\"" + this->libraryPath + "\" ";
+                linkerArgument += "-L\"" + this->jenovaPath + "\" ";
+                linkerArgument += "-L\"" + this->jenovaSDKPath + "\" ";
+                linkerArgument += "-L\"" + this->godotSDKPath + "\" ";
+                linkerArgument += GenerateLibraryPaths(linkerSettings["cpp_extra_library_directories"]);
+
+                // Add Object Files
+                for (const auto& scriptModule : linkModules)
+                {
+                    linkerArgument += "\"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
+                }
 
-            // Add Object Files
-            for (const auto& scriptModule : scriptModules)
-            {
-                linkerArgument += "\"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
-            }
+                // Add Extra Inputs [Placed Before Libraries So Shared Runtime Resolves Symbols First]
+                linkerArgument += linkInputs;
 
-            // Strip Symbols
-            if (bool(linkerSettings["cpp_strip_symbol"])) linkerArgument += "-Wl,--strip-all ";
+                // Strip Symbols
+                if (bool(linkerSettings["cpp_strip_symbol"])) linkerArgument += "-Wl,--strip-all ";
 
-            // Add Dependency Path
-            linkerArgument += "-Wl,-rpath,./Jenova ";
+                // Add Dependency Path
+                linkerArgument += "-Wl,-rpath,./Jenova ";
 
-            // Add Extra Options
-            linkerArgument += AS_STD_STRING(String(linkerSettings["cpp_extra_linker"])) + " ";
+                // Add Extra Options
+                linkerArgument += AS_STD_STRING(String(linkerSettings["cpp_extra_linker"])) + " ";
 
-            // Add Libraries [GCC Requires Libraries to be Added at the End]
-            linkerArgument += GenerateLibraries(linkerSettings["cpp_native_libs"], true);
-            linkerArgument += GenerateLibraries(linkerSettings["cpp_default_libs"]);
-            linkerArgument += GenerateLibraries(linkerSettings["cpp_extra_libs"]);
-
-            // Dump Linker Command If Developer Mode Enabled
-            if (jenova::GlobalStorage::DeveloperModeActivated) jenova::WriteStdStringToFile(this->jenovaCachePath + "LinkerCommand.txt", linkerArgument);
-
-            // Run Linker Command Using Process Management
-            int pipefd[2];
-            if (pipe(pipefd) == -1)
-            {
-                result.buildResult = false;
-                result.hasError = true;
-                result.buildError = "L667 : Failed to create pipe for linking process.";
-                return result;
-            }
-
-            pid_t pid = fork();
-            if (pid == -1)
+                // Add Libraries [GCC Requires Libraries to be Added at the End]
+                linkerArgument += GenerateLibraries(linkerSettings["cpp_native_libs"], true);
+                linkerArgument += GenerateLibraries(linkerSettings["cpp_default_libs"]);
+                linkerArgument += GenerateLibraries(linkerSettings["cpp_extra_libs"]);
+                return linkerArgument;
+            };
+            auto RunLinkerCommand = [&](const std::string& linkerArgument) -> bool
             {
-                close(pipefd[0]);
-                close(pipefd[1]);
-                result.buildResult = false;
-                result.hasError = true;
-                result.buildError = "L668 : Failed to fork process for linking.";
-                return result;
-            }
+                // Run Linker Command Using Process Management
+                int pipefd[2];
+                if (pipe(pipefd) == -1)
+                {
+                    result.buildResult = false;
+                    result.hasError = true;
+                    result.buildError = "L667 : Failed to create pipe for linking process.";
+                    return false;
+                }
 
-            if (pid == 0)
-            {
-                // Child process: Redirect output to pipe
-                dup2(pipefd[1], STDOUT_FILENO);
-                dup2(pipefd[1], STDERR_FILENO);
-                close(pipefd[0]); // Close unused read end
-                close(pipefd[1]);
+                pid_t pid = fork();
+                if (pid == -1)
+                {
+                    close(pipefd[0]);
+                    close(pipefd[1]);
+                    result.buildResult = false;
+                    result.hasError = true;
+                    result.buildError = "L668 : Failed to fork process for linking.";
+                    return false;
+                }
 
-                // Execute linker command
-                setenv("LANG", "C.UTF-8", 1);
-                setenv("LC_ALL", "C.UTF-8", 1);
-                execl("/bin/sh", "sh", "-c", linkerArgument.c_str(), nullptr);
+                if (pid == 0)
+                {
+                    // Child process: Redirect output to pipe
+                    dup2(pipefd[1], STDOUT_FILENO);
+                    dup2(pipefd[1], STDERR_FILENO);
+                    close(pipefd[0]); // Close unused read end
+                    close(pipefd[1]);
+
+                    // Execute linker command
+                    setenv("LANG", "C.UTF-8", 1);
+                    setenv("LC_ALL", "C.UTF-8", 1);
+                    execl("/bin/sh", "sh", "-c", linkerArgument.c_str(), nullptr);
+
+                    // If execl fails
+                    _exit(127);
+                }
 
-                // If execl fails
-                _exit(127);
-            }
-            else
-            {
                 // Parent process: Capture output
                 close(pipefd[1]); // Close unused write end
                 char buffer[128];
@@ -2488,10 +2882,76 @@ namespace jenova
                 {
                     result.hasError = true;
                     result.buildError = AS_GD_STRING(resultOutput);
-                    return result;
+                    return false;
                 }
+                return true;
+            };
+            auto ExtractModuleInformation = [&](const std::string& moduleOutput, const std::string& mapOutput) -> bool
+            {
+                // Generate Function Information
+                std::string funcInfoCmd = R"(gdb -q -batch -ex "set logging file "%FUNC_INFO_FILE%"" -ex "set logging on" -ex "info functions" -ex "quit" "%BINARY%" > /dev/null 2>&1)";
+                jenova::ReplaceAllMatchesWithString(funcInfoCmd, "%FUNC_INFO_FILE%", AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + std::filesystem::path(mapOutput).stem().string() + ".finfo");
+                jenova::ReplaceAllMatchesWithString(funcInfoCmd, "%BINARY%", moduleOutput);
+                if (jenova::ExecuteCommand(std::string(), funcInfoCmd) != 0)
+                {
+                    result.buildResult = false;
+                    result.hasError = true;
+                    result.buildError = "L850 : Failed to Extract Module Function Information.";
+                    return false;
+                }
+
+                // Generate Variable Information
+                std::string varInfoCmd = R"(gdb -q -batch -ex "set logging file "%VAR_INFO_FILE%"" -ex "set logging on" -ex "info variables" -ex "quit" "%BINARY%" > /dev/null 2>&1)";
+                jenova::ReplaceAllMatchesWithString(varInfoCmd, "%VAR_INFO_FILE%", AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + std::filesystem::path(mapOutput).stem().string() + ".pinfo");
+                jenova::ReplaceAllMatchesWithString(varInfoCmd, "%BINARY%", moduleOutput);
+                if (jenova::ExecuteCommand(std::string(), varInfoCmd) != 0)
+                {
+                    result.buildResult = false;
+                    result.hasError = true;
+                    result.buildError = "L860 : Failed to Extract Module Variable Information.";
+                    return false;
+                }
+                return true;
+            };
+            auto GetModuleGroupName = [](const jenova::ScriptModule& scriptModule) -> std::string
+            {
+                // Scripts Without Group Get Their Own Module
+                std::string groupName = AS_STD_STRING(scriptModule.scriptUID);
+                std::string scriptSource = AS_STD_STRING(scriptModule.scriptSource);
+                size_t groupStart = scriptSource.find(std::string(jenova::GlobalSettings::ScriptModuleGroupIdentifier) + "(");
+                if (groupStart != std::string::npos)
+                {
+                    groupStart += strlen(jenova::GlobalSettings::ScriptModuleGroupIdentifier) + 1;
+                    size_t groupEnd = scriptSource.find(')', groupStart);
+                    if (groupEnd != std::string::npos) groupName = scriptSource.substr(groupStart, groupEnd - groupStart);
+                }
+
+                // Keep Group Name Safe For File Names
+                std::string sanitizedName;
+                for (char groupChar : groupName) if (std::isalnum((unsigned char)groupChar) || groupChar == '_') sanitizedName += groupChar;
+                if (sanitizedName.empty() || sanitizedName.size() >= sizeof(jenova::ModuleDatabasePartHeader::partName)) sanitizedName = AS_STD_STRING(scriptModule.scriptUID);
+                return sanitizedName;
+            };
+
+            // Split Scripts Into Runtime And Script Modules
+            jenova::ModuleList runtimeModules;
+            std::unordered_map<std::string, jenova::ModuleList> moduleGroups;
+            bool buildPerScriptModules = jenova::GlobalStorage::ModuleBuildMode == jenova::ModuleBuildMode::PerScript;
+            for (const auto& scriptModule : scriptModules)
+            {
+                if (!buildPerScriptModules || scriptModule.scriptType == jenova::ScriptModuleType::InternalScript) runtimeModules.push_back(scriptModule);
+                else moduleGroups[GetModuleGroupName(scriptModule)].push_back(scriptModule);
             }
 
+            // Link Main Module [Holds Every Script In Monolithic Mode, Runtime Objects Only In Per-Script Mode]
+            std::string linkerArgument = GenerateLinkerArgument(outputModule, outputMap, runtimeModules);
+
+            // Dump Linker Command If Developer Mode Enabled
+            if (jenova::GlobalStorage::DeveloperModeActivated) jenova::WriteStdStringToFile(this->jenovaCachePath + "LinkerCommand.txt", linkerArgument);
+
+            // Run Linker Command
+            if (!RunLinkerCommand(linkerArgument)) return result;
+
             // Read Module to Buffer
             std::ifstream moduleReader(outputModule, std::ios::binary);
             result.builtModuleData = std::vector<uint8_t>(std::istreambuf_iterator<char>(moduleReader), {});
@@ -2505,32 +2965,11 @@ namespace jenova
                 return result;
             }
 
-            // Generate Function Information
-            std::string funcInfoCmd = R"(gdb -q -batch -ex "set logging file "%FUNC_INFO_FILE%"" -ex "set logging on" -ex "info functions" -ex "quit" "%BINARY%" > /dev/null 2>&1)";
-            jenova::ReplaceAllMatchesWithString(funcInfoCmd, "%FUNC_INFO_FILE%", AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + std::filesystem::path(outputMap).stem().string() + ".finfo");
-            jenova::ReplaceAllMatchesWithString(funcInfoCmd, "%BINARY%", outputModule);
-            if (jenova::ExecuteCommand(std::string(), funcInfoCmd) != 0)
-            {
-                result.buildResult = false;
-                result.hasError = true;
-                result.buildError = "L850 : Failed to Extract Module Function Information.";
-                return result;
-            }
-
-            // Generate Variable Information
-            std::string varInfoCmd = R"(gdb -q -batch -ex "set logging file "%VAR_INFO_FILE%"" -ex "set logging on" -ex "info variables" -ex "quit" "%BINARY%" > /dev/null 2>&1)";
-            jenova::ReplaceAllMatchesWithString(varInfoCmd, "%VAR_INFO_FILE%", AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + std::filesystem::path(outputMap).stem().string() + ".pinfo");
-            jenova::ReplaceAllMatchesWithString(varInfoCmd, "%BINARY%", outputModule);
-            if (jenova::ExecuteCommand(std::string(), varInfoCmd) != 0)
-            {
-                result.buildResult = false;
-                result.hasError = true;
-                result.buildError = "L860 : Failed to Extract Module Variable Information.";
-                return result;
-            }
+            // Extract Function And Variable Information
+            if (!ExtractModuleInformation(outputModule, outputMap)) return result;
 
             // Generate Metadata
-            result.moduleMetaData = JenovaInterpreter::GenerateModuleMetadata(outputMap, scriptModules, result);
+            result.moduleMetaData = JenovaInterpreter::GenerateModuleMetadata(outputMap, runtimeModules, result);
             if (result.moduleMetaData.empty())
             {
                 result.buildResult = false;
@@ -2539,6 +2978,117 @@ namespace jenova
                 return result;
             }
 
+            // Link Module Part [Relinks Only When Objects, Linker Command or Shared Runtime Changed]
+            auto LinkModulePart = [&](const std::string& partName, const jenova::ModuleList& partModules, const jenova::ModuleList& partScripts, const std::string& partInputs, const std::string& partHashSeed, jenova::ModulePart& modulePart) -> bool
+            {
+                // Part Names Are Stored In Fixed Size Database Headers
+                if (partName.size() >= sizeof(jenova::ModuleDatabasePartHeader::partName))
+                {
+                    result.buildResult = false;
+                    result.hasError = true;
+                    result.buildError = "L674 : Script Module Part Name " + AS_GD_STRING(partName) + " Is Too Long.";
+                    return false;
+                }
+
+                // Generate Part Paths
+                std::string partStem = std::filesystem::path(outputModule).stem().string() + "." + partName;
+                std::string partModule = this->jenovaCachePath + partStem + ".so";
+                std::string partMap = this->jenovaCachePath + partStem + ".map";
+                std::string partMetaDataFile = this->jenovaCachePath + partStem + ".json";
+                std::string partHashFile = this->jenovaCachePath + partStem + ".hash";
+
+                // Generate Part Hash From Linked Objects And Linker Command
+                std::string partArgument = GenerateLinkerArgument(partModule, partMap, partModules, partInputs);
+                String partHashSource = AS_GD_STRING(partArgument) + AS_GD_STRING(partHashSeed);
+                for (const auto& partScript : partModules) partHashSource += FileAccess::get_md5(partScript.scriptObjectFile);
+                for (const auto& partScript : partScripts) partHashSource += partScript.scriptUID;
+
+                // Create Module Part
+                modulePart.partName = partName;
+                modulePart.partHash = AS_STD_STRING(partHashSource.md5_text());
+
+                // Reuse Part If Nothing It Links Has Changed
+                bool partIsCached = std::filesystem::exists(partModule) && std::filesystem::exists(partMetaDataFile) && std::filesystem::exists(partHashFile);
+                if (partIsCached && jenova::ReadStdStringFromFile(partHashFile) == modulePart.partHash)
+                {
+                    std::ifstream partReader(partModule, std::ios::binary);
+                    modulePart.partData = jenova::MemoryBuffer(std::istreambuf_iterator<char>(partReader), {});
+                    modulePart.partMetaData = jenova::ReadStdStringFromFile(partMetaDataFile);
+                }
+
+                // Relink Changed Part
+                if (modulePart.partData.empty() || modulePart.partMetaData.empty())
+                {
+                    if (!RunLinkerCommand(partArgument)) return false;
+                    if (!ExtractModuleInformation(partModule, partMap)) return false;
+
+                    // Read Part Module And Generate Its Metadata
+                    jenova::BuildResult partResult;
+                    partResult.buildPath = result.buildPath;
+                    partResult.compilerModel = result.compilerModel;
+                    partResult.hasDebugInformation = result.hasDebugInformation;
+                    std::ifstream partReader(partModule, std::ios::binary);
+                    partResult.builtModuleData = std::vector<uint8_t>(std::istreambuf_iterator<char>(partReader), {});
+                    if (!partResult.builtModuleData.empty()) modulePart.partMetaData = JenovaInterpreter::GenerateModuleMetadata(partMap, partModules, partResult);
+
+                    // Keep Only Scripts Owned By Part [Runtime Modules Are Described Once By Main Module]
+                    if (!modulePart.partMetaData.empty())
+                    {
+                        jenova::json_t partMetaData = jenova::json_t::parse(modulePart.partMetaData);
+                        if (partMetaData.contains("Scripts"))
+                        {
+                            std::unordered_set<std::string> ownedScripts;
+                            for (const auto& partScript : partScripts) ownedScripts.insert(AS_STD_STRING(partScript.scriptUID));
+                            for (auto partScript = partMetaData["Scripts"].begin(); partScript != partMetaData["Scripts"].end();)
+                            {
+                                if (ownedScripts.count(partScript.key())) partScript++;
+                                else partScript = partMetaData["Scripts"].erase(partScript);
+                            }
+                        }
+                        modulePart.partMetaData = partMetaData.dump();
+                    }
+                    if (partResult.builtModuleData.empty() || modulePart.partMetaData.empty())
+                    {
+                        result.buildResult = false;
+                        result.hasError = true;
+                        result.buildError = "L673 : Failed to Generate Script Module Part " + AS_GD_STRING(modulePart.partName) + ".";
+                        return false;
+                    }
+                    modulePart.partData.swap(partResult.builtModuleData);
+
+                    // Store Part Hash And Metadata For Next Build
+                    jenova::WriteStdStringToFile(partMetaDataFile, modulePart.partMetaData);
+                    jenova::WriteStdStringToFile(partHashFile, modulePart.partHash);
+                    jenova::VerboseByID(__LINE__, "Script Module Part [%s] Linked.", modulePart.partName.c_str());
+                }
+
+                // All Good
+                return true;
+            };
+
+            // Link Shared Runtime Part [Script Parts Link Against It Instead of Carrying Their Own Runtime Objects]
+            if (!moduleGroups.empty())
+            {
+                // Runtime Part Is Found By Its Soname, Which Changes With Its Content So Reloads Never Bind to A Retired Copy
+                String runtimeHashSource = AS_GD_STRING(GenerateLinkerArgument(std::string(), std::string(), runtimeModules));
+                for (const auto& runtimeModule : runtimeModules) runtimeHashSource += FileAccess::get_md5(runtimeModule.scriptObjectFile);
+                std::string runtimeSoname = std::string(jenova::GlobalSettings::RuntimeModulePartName) + "." + AS_STD_STRING(runtimeHashSource.md5_text()) + ".so";
+                jenova::ModulePart runtimePart;
+                if (!LinkModulePart(jenova::GlobalSettings::RuntimeModulePartName, runtimeModules, jenova::ModuleList(), "-Wl,-soname," + runtimeSoname + " ", std::string(), runtimePart)) return result;
+
+                // Link Script Modules Against Shared Runtime Part [Runtime Part Is Loaded First]
+                std::string runtimePartModule = this->jenovaCachePath + std::filesystem::path(outputModule).stem().string() + "." + runtimePart.partName + ".so";
+                std::string runtimePartInput = "-Wl,--push-state,--no-as-needed \"" + runtimePartModule + "\" -Wl,--pop-state ";
+                std::string runtimePartHash = runtimePart.partHash;
+                result.moduleParts.push_back(std::move(runtimePart));
+                for (const auto& moduleGroup : moduleGroups)
+                {
+                    jenova::ModulePart modulePart;
+                    if (!LinkModulePart(moduleGroup.first, moduleGroup.second, moduleGroup.second, runtimePartInput, runtimePartHash, modulePart)) return result;
+                    result.moduleParts.push_back(std::move(modulePart));
+                }
+            }
+
             // Generate Build Cache
             if (!jenova::CreateBuildCacheDatabase(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, scriptModules, linkerSettings["CppHeaderFiles"]))
             {
@@ -2623,6 +3173,56 @@ namespace jenova
         }
 
     protected:
+        virtual String GeneratePreprocessorDefinitions(const String& userPreprocessorDefinitions)
+        {
+            // Preprocessor Definitions [Header]
+            String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
+
+            // Preprocessor Definitions [Version]
+            preprocessorDefinitions += String(jenova::Format("#define JENOVA_VERSION \"%d.%d.%d.%d\"\n",
+                jenova::GlobalSettings::JenovaBuildVersion[0], jenova::GlobalSettings::JenovaBuildVersion[1],
+                jenova::GlobalSettings::JenovaBuildVersion[2], jenova::GlobalSettings::JenovaBuildVersion[3]).c_str());
+
+            // Preprocessor Definitions [Compiler]
+            preprocessorDefinitions += "#define JENOVA_COMPILER \"GNU Compiler Collection\"\n";
+            preprocessorDefinitions += "#define GCC_COMPILER\n";
+
+            // Preprocessor Definitions [Linking]
+            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Statically) preprocessorDefinitions += "#define JENOVA_SDK_STATIC_LINKING\n";
+            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Dynamically) preprocessorDefinitions += "#define JENOVA_SDK_DYNAMIC_LINKING\n";
+
+            // Preprocessor Definitions [User]
+            PackedStringArray userPreprocessorDefinitionsList = userPreprocessorDefinitions.split(";");
+            for (const auto& definition : userPreprocessorDefinitionsList) if (!definition.is_empty()) preprocessorDefinitions += "#define " + definition + "\n";
+
+            // Return Definitions
+            return preprocessorDefinitions;
+        }
+        std::string PreparePrecompiledHeaderArgument(const Dictionary& compilerSettings, const std::string& compilerFlags)
+        {
+            // Check If Precompiled Header Enabled
+            if (!bool(compilerSettings.get("cpp_precompiled_header", false))) return std::string();
+
+            // Solve Precompiled Header Files [Output Is Picked Up By -include Next to Header]
+            std::string compilerBinary = AS_STD_STRING(String(compilerSettings["cpp_compiler_binary"]));
+            std::string headerFile = this->jenovaCachePath + jenova::GlobalSettings::JenovaPrecompiledHeaderFile;
+            std::string outputFile = headerFile + ".gch";
+            std::string dependencyFile = outputFile + jenova::GlobalSettings::ScriptDependencyFileExtension;
+
+            // Generate Precompiled Header [Definitions Must Match Preprocessed Scripts]
+            std::string headerContent = "// Jenova Precompiled Header\n";
+            headerContent += AS_STD_STRING(GeneratePreprocessorDefinitions(compilerSettings.get("PreprocessorDefinitions", String())));
+            headerContent += "\n#include <Godot/godot.hpp>\n#include <JenovaSDK.h>\n";
+
+            // Build Precompiled Header If Missing or Outdated
+            std::string buildCommand = compilerBinary + " -c " + compilerFlags;
+            buildCommand += "-x c++-header \"" + headerFile + "\" -o \"" + outputFile + "\" -MMD -MF \"" + dependencyFile + "\"";
+            if (!PreparePrecompiledHeader(headerFile, headerContent, outputFile, dependencyFile, buildCommand, QueryCompilerIdentity(compilerBinary))) return std::string();
+
+            // Return Include Argument
+            return "-include \"" + headerFile + "\" ";
+        }
+
         Dictionary internalDefaultSettings;
         std::string projectPath;
         std::string compilerBinaryPath;
@@ -2672,29 +3272,8 @@ namespace jenova
             jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
             if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
 
-            // Preprocessor Definitions [Header]
-            String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
-
-            // Preprocessor Definitions [Version]
-            preprocessorDefinitions += String(jenova::Format("#define JENOVA_VERSION \"%d.%d.%d.%d\"\n",
-                jenova::GlobalSettings::JenovaBuildVersion[0], jenova::GlobalSettings::JenovaBuildVersion[1],
-                jenova::GlobalSettings::JenovaBuildVersion[2], jenova::GlobalSettings::JenovaBuildVersion[3]).c_str());
-
-            // Preprocessor Definitions [Compiler]
-            preprocessorDefinitions += "#define JENOVA_COMPILER \"LLVM Clang Compiler\"\n";
-            preprocessorDefinitions += "#define CLANG_COMPILER\n";
-
-            // Preprocessor Definitions [Linking]
-            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Statically) preprocessorDefinitions += "#define JENOVA_SDK_STATIC_LINKING\n";
-            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Dynamically) preprocessorDefinitions += "#define JENOVA_SDK_DYNAMIC_LINKING\n";
-
-            // Preprocessor Definitions [User]
-            String userPreprocessorDefinitions = preprocessorSettings["PreprocessorDefinitions"];
-            PackedStringArray userPreprocessorDefinitionsList = userPreprocessorDefinitions.split(";");
-            for (const auto& definition : userPreprocessorDefinitionsList) if (!definition.is_empty()) preprocessorDefinitions += "#define " + definition + "\n";
-
-            // Add Final Preprocessor Definitions
-            scriptSourceCode = scriptSourceCode.insert(0, preprocessorDefinitions + "\n");
+            // Add Final Preprocessor Definitions [Shared With Precompiled Header]
+            scriptSourceCode = scriptSourceCode.insert(0, GeneratePreprocessorDefinitions(preprocessorSettings["PreprocessorDefinitions"]) + "\n");
 
             // Replecements
             scriptSourceCode = scriptSourceCode.replace(jenova::GlobalSettings::ScriptToolIdentifier, "#define TOOL_SCRIPT");
@@ -2756,6 +3335,33 @@ namespace jenova
             // All Good
             return true;
         }
+
+    protected:
+        String GeneratePreprocessorDefinitions(const String& userPreprocessorDefinitions) override
+        {
+            // Preprocessor Definitions [Header]
+            String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
+
+            // Preprocessor Definitions [Version]
+            preprocessorDefinitions += String(jenova::Format("#define JENOVA_VERSION \"%d.%d.%d.%d\"\n",
+                jenova::GlobalSettings::JenovaBuildVersion[0], jenova::GlobalSettings::JenovaBuildVersion[1],
+                jenova::GlobalSettings::JenovaBuildVersion[2], jenova::GlobalSettings::JenovaBuildVersion[3]).c_str());
+
+            // Preprocessor Definitions [Compiler]
+            preprocessorDefinitions += "#define JENOVA_COMPILER \"LLVM Clang Compiler\"\n";
+            preprocessorDefinitions += "#define CLANG_COMPILER\n";
+
+            // Preprocessor Definitions [Linking]
+            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Statically) preprocessorDefinitions += "#define JENOVA_SDK_STATIC_LINKING\n";
+            if (jenova::GlobalStorage::SDKLinkingMode == SDKLinkingMode::Dynamically) preprocessorDefinitions += "#define JENOVA_SDK_DYNAMIC_LINKING\n";
+
+            // Preprocessor Definitions [User]
+            PackedStringArray userPreprocessorDefinitionsList = userPreprocessorDefinitions.split(";");
+            for (const auto& definition : userPreprocessorDefinitionsList) if (!definition.is_empty()) preprocessorDefinitions += "#define " + definition + "\n";
+
+            // Return Definitions
+            return preprocessorDefinitions;
+        }
     };
 
     #endif // Linux Compilers
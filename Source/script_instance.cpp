@@ -124,24 +124,8 @@ bool CPPScriptInstance::set(const StringName &p_name, const Variant &p_value)
 		return true;
 	}
 
-	// Set Interpreted Properties [Optimize This!]
-	if (instanceProperties.has(p_name))
-	{
-		instanceProperties[p_name] = p_value;
-		return true;
-	}
-	else
-	{
-		auto propContainer = JenovaInterpreter::GetPropertyContainer(AS_STD_STRING(this->scriptInstanceIdentity));
-		for (size_t i = 0; i < propContainer.scriptProperties.size(); i++)
-		{
-			if (p_name == propContainer.scriptProperties[i].propertyInfo.name)
-			{
-				instanceProperties[p_name] = p_value;
-				return true;
-			}
-		}
-	}
+	// Set Interpreted Properties
+	if (JenovaInterpreter::SetPropertyBlockValue(get_property_block(), p_name, p_value)) return true;
 
 	// Not Handled
 	return false;
@@ -165,24 +149,8 @@ bool CPPScriptInstance::get(const StringName &p_name, Variant &r_ret) const
 		return true;
 	}
 
-	// Get Interpreted Properties [Optimize This!]
-	if (instanceProperties.has(p_name))
-	{
-		r_ret = instanceProperties[p_name];
-		return true;
-	}
-	else
-	{
-		auto propContainer = JenovaInterpreter::GetPropertyContainer(AS_STD_STRING(this->scriptInstanceIdentity));
-		for (size_t i = 0; i < propContainer.scriptProperties.size(); i++)
-		{
-			if (p_name == propContainer.scriptProperties[i].propertyInfo.name)
-			{
-				r_ret = propContainer.scriptProperties[i].defaultValue;
-				return true;
-			}
-		}
-	}
+	// Get Interpreted Properties
+	if (JenovaInterpreter::GetPropertyBlockValue(get_property_block(), p_name, r_ret)) return true;
 
 	// Not Handled
 	return false;
@@ -206,6 +174,22 @@ Variant CPPScriptInstance::callp(const StringName &p_method, const Variant **p_a
 		return Variant();
 	}
 
+	// Process Functions Run From Native Update Lists [Engine Callback Only Carries set_process State]
+	if (nativeUpdateIndex != UINT32_MAX)
+	{
+		static const StringName processName("_process");
+		static const StringName physicsProcessName("_physics_process");
+		if (p_method == processName || p_method == physicsProcessName)
+		{
+			const jenova::ScriptMethodSlot* methodSlot = script->GetMethodSlot(p_method);
+			if (methodSlot && JenovaScriptManager::is_native_update_method(*methodSlot))
+			{
+				r_error.error = GDEXTENSION_CALL_OK;
+				return Variant();
+			}
+		}
+	}
+
 	// Verbose Call
 	String script_name = this->script->get_path().get_file();
 	String owner_name = godot::Object::cast_to<godot::Node>(this->owner)->get_name();
@@ -236,68 +220,94 @@ Variant CPPScriptInstance::callp(const StringName &p_method, const Variant **p_a
 		return Variant();
 	}
 
-	// Update Interpreter Properties
-	if (this->instanceProperties.size() != 0)
-	{
-		Array instancePropertiesKeys = instanceProperties.keys();
-		for (size_t i = 0; i < instancePropertiesKeys.size(); i++)
-		{
-			if (!JenovaInterpreter::SetPropertyValueFromVariant(instancePropertiesKeys[i], instanceProperties[instancePropertiesKeys[i]], scriptInstanceIdentity))
-			{
-				jenova::Error("Jenova Interpreter", "Failed to Update Interpreter Property Storage Value!");
-				r_error.error = GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT;
-				return Variant();
-			}
-		}
-	}
-
-	// Call to Interpreter
-	bool hasMethod = false;
-	jenova::FunctionList jenovaMethods = JenovaInterpreter::GetFunctionsList(AS_STD_STRING(scriptInstanceIdentity));
-	for (auto& function : jenovaMethods)
-	{
-		if (p_method == StringName(function.c_str()))
-		{
-			hasMethod = true;
-			break;
-		}
-	}
-	if (hasMethod)
+	// Call to Interpreter [Method Map Holds Dispatch Snapshot Alive During Call]
+	std::shared_ptr<const jenova::MethodSlotMap> methodSlotMap = script->GetMethodSlotMap();
+	const jenova::ScriptMethodSlot* const* methodSlot = methodSlotMap ? methodSlotMap->getptr(p_method) : nullptr;
+	if (methodSlot)
 	{
 		// Invoke Function & Call
-		Variant callResult = JenovaInterpreter::CallFunction(this->owner, AS_STD_STRING(p_method), AS_STD_STRING(scriptInstanceIdentity), p_args, p_argument_count);
-
-		// Update Properties
-		if (jenova::GlobalSettings::UpdatePropertiesAfterCall)
-		{
-			// Update Interpreter Properties
-			if (this->instanceProperties.size() != 0)
-			{
-				Array instancePropertiesKeys = instanceProperties.keys();
-				for (size_t i = 0; i < instancePropertiesKeys.size(); i++)
-				{
-					Variant variantValue = Variant::NIL;
-					jenova::PropertyPointer propertyPointer = JenovaInterpreter::GetPropertyPointer(instancePropertiesKeys[i], scriptInstanceIdentity);
-					if (!jenova::GetVariantFromPropertyPointer(propertyPointer, variantValue, instanceProperties[instancePropertiesKeys[i]].get_type()))
-					{
-						jenova::Error("Jenova Interpreter", "Failed to Update Property Storage Value From Interpreter Property!");
-						r_error.error = GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT;
-						return Variant();
-					}
-					instanceProperties[instancePropertiesKeys[i]] = variantValue;
-				}
-			}
-		}
-
-		// Return Result
 		r_error.error = GDEXTENSION_CALL_OK;
-		return callResult;
+		return invoke_method_slot(**methodSlot, p_args, p_argument_count);
 	}
 
 	// Default Result
 	r_error.error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
 	return Variant();
 }
+Variant CPPScriptInstance::invoke_method_slot(const jenova::ScriptMethodSlot& methodSlot, const Variant** p_args, int p_argcount, bool p_bind_properties)
+{
+	// Call Without Binding Properties [Used By Parallel Batches]
+	if (!p_bind_properties) return JenovaInterpreter::CallFunction(this->owner, methodSlot, p_args, p_argcount);
+
+	// Call Without Lock If Instance Has No Properties
+	jenova::ScriptPropertyBlock* instancePropertyBlock = get_property_block();
+	if (!instancePropertyBlock || instancePropertyBlock->propertyLayout->propertySlots.empty()) return JenovaInterpreter::CallFunction(this->owner, methodSlot, p_args, p_argcount);
+
+	// Bind Instance Properties to Interpreter Per Call [Previous Binding Is Restored For Nested Calls]
+	jenova::ScriptPropertyBlock* previousPropertyBlock = nullptr;
+	if (!JenovaInterpreter::BindPropertyBlock(instancePropertyBlock, &previousPropertyBlock))
+	{
+		jenova::Error("Jenova Interpreter", "Failed to Bind Instance Property Block to Interpreter!");
+		return Variant("ERROR::PROPERTY_BINDING_FAILED");
+	}
+
+	// Invoke Function & Restore Binding
+	Variant callResult = JenovaInterpreter::CallFunction(this->owner, methodSlot, p_args, p_argcount);
+	if (previousPropertyBlock && previousPropertyBlock != instancePropertyBlock) JenovaInterpreter::BindPropertyBlock(previousPropertyBlock);
+	return callResult;
+}
+bool CPPScriptInstance::invoke_method_slot_ptr(const jenova::ScriptMethodSlot& methodSlot, const GDExtensionConstTypePtr* p_args, GDExtensionTypePtr r_ret)
+{
+	// Call Without Lock If Instance Has No Properties
+	jenova::ScriptPropertyBlock* instancePropertyBlock = get_property_block();
+	if (!instancePropertyBlock || instancePropertyBlock->propertyLayout->propertySlots.empty()) return JenovaInterpreter::CallFunctionPtr(this->owner, methodSlot, p_args, r_ret);
+
+	// Bind Instance Properties to Interpreter Per Call [Previous Binding Is Restored For Nested Calls]
+	jenova::ScriptPropertyBlock* previousPropertyBlock = nullptr;
+	if (!JenovaInterpreter::BindPropertyBlock(instancePropertyBlock, &previousPropertyBlock)) return false;
+
+	// Invoke Function & Restore Binding
+	bool callSucceeded = JenovaInterpreter::CallFunctionPtr(this->owner, methodSlot, p_args, r_ret);
+	if (previousPropertyBlock && previousPropertyBlock != instancePropertyBlock) JenovaInterpreter::BindPropertyBlock(previousPropertyBlock);
+	return callSucceeded;
+}
+bool CPPScriptInstance::bind_properties() const
+{
+	jenova::ScriptPropertyBlock* instancePropertyBlock = get_property_block();
+	if (!instancePropertyBlock) return true;
+	return JenovaInterpreter::BindPropertyBlock(instancePropertyBlock);
+}
+bool CPPScriptInstance::is_invokable() const
+{
+	if (isDeleting || !this->script.is_valid()) return false;
+	if (QUERY_ENGINE_MODE(Editor) && !script->is_tool()) return false;
+	return true;
+}
+const Ref<CPPScript>& CPPScriptInstance::get_script_object() const
+{
+	return this->script;
+}
+Object* CPPScriptInstance::get_owner_object() const
+{
+	return this->owner;
+}
+jenova::ScriptPropertyBlock* CPPScriptInstance::get_property_block() const
+{
+	// Use Current Block Without Resolving Layout
+	if (propertyBlock && propertyBlock->propertyLayout->layoutGeneration == JenovaInterpreter::GetDispatchGeneration()) return propertyBlock;
+
+	// Create or Migrate Instance Property Block
+	if (!JenovaInterpreter::UpdatePropertyBlock(propertyBlock, scriptIdentity->scriptUIDString)) return nullptr;
+	return propertyBlock;
+}
+const jenova::ScriptPropertyContainer& CPPScriptInstance::get_property_container() const
+{
+	// Use Container Cached In Instance Block Layout [Block Keeps Layout Alive Across Reloads]
+	static const jenova::ScriptPropertyContainer emptyPropertyContainer;
+	jenova::ScriptPropertyBlock* instancePropertyBlock = get_property_block();
+	if (instancePropertyBlock) return instancePropertyBlock->propertyLayout->propertyContainer;
+	return emptyPropertyContainer;
+}
 void CPPScriptInstance::update_methods() const 
 {
 	// Remove
@@ -308,7 +318,7 @@ void CPPScriptInstance::update_methods() const
 
 	// Update Script Methods
 	methodsInfo.clear();
-	auto functionContainer = JenovaInterpreter::GetFunctionContainer(AS_STD_STRING(scriptInstanceIdentity));
+	auto functionContainer = JenovaInterpreter::GetFunctionContainer(scriptIdentity->scriptUIDString);
 	for (auto& scriptFunction : functionContainer.scriptFunctions)
 	{
 		this->methodsInfo.push_back(scriptFunction.methodInfo);
@@ -370,19 +380,9 @@ const GDExtensionPropertyInfo* CPPScriptInstance::get_property_list(uint32_t *r_
 		propertiesInfo.push_back(sourceCodeProperty);
 	}
 	
-	// Add Jenova Script Interpreted Properties
-	auto propContainer = JenovaInterpreter::GetPropertyContainer(AS_STD_STRING(this->scriptInstanceIdentity));
-	for (size_t i = 0; i < propContainer.scriptProperties.size(); i++)
-	{
-		GDExtensionPropertyInfo sourceCodeProperty = {};
-		sourceCodeProperty.type = GDExtensionVariantType(propContainer.scriptProperties[i].propertyInfo.type);
-		sourceCodeProperty.name = AllocateStringName(propContainer.scriptProperties[i].propertyInfo.name);
-		sourceCodeProperty.class_name = AllocateStringName(propContainer.scriptProperties[i].propertyInfo.class_name);
-		sourceCodeProperty.hint_string = AllocateString(propContainer.scriptProperties[i].propertyInfo.hint_string);
-		sourceCodeProperty.hint = propContainer.scriptProperties[i].propertyInfo.hint;
-		sourceCodeProperty.usage = propContainer.scriptProperties[i].propertyInfo.usage;
-		propertiesInfo.push_back(sourceCodeProperty);
-	}
+	// Add Jenova Script Interpreted Properties [Prebuilt At Module Load]
+	const jenova::ScriptPropertyContainer& propContainer = get_property_container();
+	for (const GDExtensionPropertyInfo& propertyInfo : propContainer.propertyListInfo) propertiesInfo.push_back(propertyInfo);
 
 	// Add Jenova Script User-Defined Properties
 
@@ -400,8 +400,13 @@ void CPPScriptInstance::free_property_list(const GDExtensionPropertyInfo *p_list
 	jenova::VerboseByID(__LINE__, "CPPScriptInstance::free_property_list");
 	if (p_list)
 	{
+		// Only Internal Properties Are Allocated Per List, Interpreted Ones Are Owned by Property Container
+		static const StringName sourceCodePropertyName("cpp/source_code");
 		int size = memnew_ptr_size<GDExtensionPropertyInfo>(p_list);
-		for (int i = 0; i < size; i++) FreePropertyList(p_list[i]);
+		for (int i = 0; i < size; i++)
+		{
+			if (*(const StringName*)p_list[i].name == sourceCodePropertyName) FreePropertyList(p_list[i]);
+		}
 		memdelete_with_size<GDExtensionPropertyInfo>(p_list);
 	}
 }
@@ -417,18 +422,16 @@ Variant::Type CPPScriptInstance::get_property_type(const StringName &p_name, boo
 	}
 
 	// Handle Interpreted Properties
-	auto propContainer = JenovaInterpreter::GetPropertyContainer(AS_STD_STRING(this->scriptInstanceIdentity));
-	for (size_t i = 0; i < propContainer.scriptProperties.size(); i++)
+	const jenova::ScriptPropertyContainer& propContainer = get_property_container();
+	const uint32_t* propertyIndex = propContainer.propertyIndices.getptr(p_name);
+	if (propertyIndex)
 	{
-		if (p_name == propContainer.scriptProperties[i].propertyInfo.name)
-		{
-			if (r_is_valid) *r_is_valid = true;
-			return propContainer.scriptProperties[i].propertyInfo.type;
-		}
+		if (r_is_valid) *r_is_valid = true;
+		return propContainer.scriptProperties[*propertyIndex].propertyInfo.type;
 	}
 
 	// Not Found
-	*r_is_valid = false;
+	if (r_is_valid) *r_is_valid = false;
 	return Variant::NIL;
 }
 void CPPScriptInstance::get_property_state(GDExtensionScriptInstancePropertyStateAdd p_add_func, void *p_userdata) 
@@ -436,7 +439,23 @@ void CPPScriptInstance::get_property_state(GDExtensionScriptInstancePropertyStat
 	// Remove
 	jenova::VerboseByID(__LINE__, "CPPScriptInstance::get_property_state");
 
-	p_add_func = AddState; // Needs Investigation
+	// Report Properties Written Through Engine Or Differing From Default Image [Scripts Write Block Storage Directly]
+	jenova::ScriptPropertyBlock* instancePropertyBlock = get_property_block();
+	if (!instancePropertyBlock) return;
+	const jenova::ScriptPropertyLayout* propertyLayout = instancePropertyBlock->propertyLayout.get();
+	for (size_t i = 0; i < propertyLayout->propertySlots.size(); i++)
+	{
+		const jenova::ScriptPropertySlot& propertySlot = propertyLayout->propertySlots[i];
+		Variant propertyValue;
+		if (!JenovaInterpreter::GetPropertyBlockValue(instancePropertyBlock, propertySlot.propertyName, propertyValue)) continue;
+		if (!instancePropertyBlock->dirtyProperties[i] && propertyLayout->defaultImage)
+		{
+			Variant defaultValue;
+			propertySlot.typeOperations->readToVariant(propertyLayout->defaultImage + propertySlot.storageOffset, defaultValue);
+			if (propertyValue == defaultValue) continue;
+		}
+		p_add_func(&propertySlot.propertyName, &propertyValue, p_userdata);
+	}
 }
 bool CPPScriptInstance::validate_property(GDExtensionPropertyInfo &p_property) const 
 {
@@ -448,18 +467,7 @@ bool CPPScriptInstance::validate_property(GDExtensionPropertyInfo &p_property) c
 	StringName propertyName = *(StringName*)p_property.name;
 
 	// Handle Interpreted Properties
-	if (instanceProperties.has(propertyName))
-	{
-		return true;
-	}
-	else
-	{
-		auto propContainer = JenovaInterpreter::GetPropertyContainer(AS_STD_STRING(this->scriptInstanceIdentity));
-		for (size_t i = 0; i < propContainer.scriptProperties.size(); i++)
-		{
-			if (propertyName == propContainer.scriptProperties[i].propertyInfo.name) return true;
-		}
-	}
+	if (get_property_container().propertyIndices.has(propertyName)) return true;
 
 	// Not Implemented Yet
 	return false;
@@ -487,16 +495,8 @@ bool CPPScriptInstance::has_method(const StringName &p_name) const
 	// Jenova Module Functions Handling
 	if (!result)
 	{
-		// Get Jenova Function List And Search Over User Defined Functions
-		jenova::FunctionList jenovaMethods = JenovaInterpreter::GetFunctionsList(AS_STD_STRING(scriptInstanceIdentity));
-		for (auto& function : jenovaMethods)
-		{
-			if (p_name == StringName(function.c_str()))
-			{
-				result = true;
-				break;
-			}
-		}
+		// Search Over User Defined Functions
+		result = script->GetMethodSlot(p_name) != nullptr;
 
 		// In Editor and Tool Mode We Return All Functions As True
 		if (!result && QUERY_ENGINE_MODE(Editor) && script->is_tool()) result = true;
@@ -510,8 +510,11 @@ int CPPScriptInstance::get_method_argument_count(const StringName& p_method, boo
 {
 	// Remove
 	jenova::VerboseByID(__LINE__, "CPPScriptInstance::get_method_argument_count");
-	*r_is_valid = false;
-	return 0;
+
+	// Resolve Method Slot
+	const jenova::ScriptMethodSlot* methodSlot = script.is_valid() ? script->GetMethodSlot(p_method) : nullptr;
+	if (r_is_valid) *r_is_valid = methodSlot != nullptr;
+	return methodSlot ? int(methodSlot->parameterTypes.size()) : 0;
 }
 bool CPPScriptInstance::property_can_revert(const StringName &p_name) const 
 {
@@ -519,11 +522,7 @@ bool CPPScriptInstance::property_can_revert(const StringName &p_name) const
 	jenova::VerboseByID(__LINE__, "CPPScriptInstance::property_can_revert");
 
 	// Handle Interpreted Properties
-	auto propContainer = JenovaInterpreter::GetPropertyContainer(AS_STD_STRING(this->scriptInstanceIdentity));
-	for (size_t i = 0; i < propContainer.scriptProperties.size(); i++)
-	{
-		if (p_name == propContainer.scriptProperties[i].propertyInfo.name) return true;
-	}
+	if (get_property_container().propertyIndices.has(p_name)) return true;
 
 	// Not Found
 	return false;
@@ -534,14 +533,12 @@ bool CPPScriptInstance::property_get_revert(const StringName &p_name, Variant &r
 	jenova::VerboseByID(__LINE__, "CPPScriptInstance::property_get_revert");
 
 	// Handle Interpreted Properties
-	auto propContainer = JenovaInterpreter::GetPropertyContainer(AS_STD_STRING(this->scriptInstanceIdentity));
-	for (size_t i = 0; i < propContainer.scriptProperties.size(); i++)
+	const jenova::ScriptPropertyContainer& propContainer = get_property_container();
+	const uint32_t* propertyIndex = propContainer.propertyIndices.getptr(p_name);
+	if (propertyIndex)
 	{
-		if (p_name == propContainer.scriptProperties[i].propertyInfo.name)
-		{
-			r_ret = propContainer.scriptProperties[i].defaultValue;
-			return true;
-		}
+		r_ret = propContainer.scriptProperties[*propertyIndex].defaultValue;
+		return true;
 	}
 
 	// Not Found
@@ -610,6 +607,45 @@ String CPPScriptInstance::get_identity()
 }
 
 // C++ Script Instance Initializer/Destructor
+CPPScriptInstance* CPPScriptInstance::create_pooled_instance(Object* p_owner, const Ref<CPPScript>& p_script, const std::shared_ptr<jenova::ScriptInstancePool>& p_pool)
+{
+	// Use Engine Allocator Without Pool
+	if (!p_pool) return memnew(CPPScriptInstance(p_owner, p_script));
+
+	// Take Instance Slot From Script Pool
+	void* instanceSlot = nullptr;
+	{
+		std::lock_guard<std::mutex> poolLock(p_pool->poolMutex);
+		jenova::InstancePoolStatistics& poolStatistics = p_pool->poolStatistics;
+		if (p_pool->freeSlots.empty())
+		{
+			constexpr size_t slotSize = (sizeof(CPPScriptInstance) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+			uint8_t* slabChunk = static_cast<uint8_t*>(std::malloc(slotSize * jenova::GlobalSettings::InstancePoolSlotsPerChunk));
+			if (!slabChunk)
+			{
+				jenova::Warning("Jenova Script Instance", "Failed to Allocate Instance Slab, Falling Back to Engine Allocator.");
+				return memnew(CPPScriptInstance(p_owner, p_script));
+			}
+			p_pool->slabChunks.push_back(slabChunk);
+			for (size_t i = jenova::GlobalSettings::InstancePoolSlotsPerChunk; i > 0; i--) p_pool->freeSlots.push_back(slabChunk + (i - 1) * slotSize);
+			poolStatistics.slabAllocations++;
+		}
+		else
+		{
+			poolStatistics.pooledAllocations++;
+		}
+		instanceSlot = p_pool->freeSlots.back();
+		p_pool->freeSlots.pop_back();
+		poolStatistics.instanceAllocations++;
+		poolStatistics.activeInstances++;
+		poolStatistics.peakInstances = std::max(poolStatistics.peakInstances, poolStatistics.activeInstances);
+	}
+
+	// Construct Instance In Slot
+	CPPScriptInstance* instance = new (instanceSlot) CPPScriptInstance(p_owner, p_script);
+	instance->instancePool = p_pool;
+	return instance;
+}
 CPPScriptInstance::CPPScriptInstance(Object *p_owner, const Ref<CPPScript> p_script) :
 		owner(p_owner), script(p_script) 
 {
@@ -619,6 +655,8 @@ CPPScriptInstance::CPPScriptInstance(Object *p_owner, const Ref<CPPScript> p_scr
 	// Validate Script Object
 	if (p_script.is_null() || !p_script.is_valid())
 	{
+		static const std::shared_ptr<const jenova::ScriptIdentity> emptyIdentity = std::make_shared<jenova::ScriptIdentity>();
+		scriptIdentity = emptyIdentity;
 		jenova::VerboseByID(__LINE__, "ERROR : Null Script Passed to Instance.");
 		return;
 	}
@@ -627,8 +665,9 @@ CPPScriptInstance::CPPScriptInstance(Object *p_owner, const Ref<CPPScript> p_scr
 	godot::Node* parentNode = godot::Object::cast_to<godot::Node>(p_owner);
 	jenova::VerboseByID(__LINE__, "Creating Script Instance from (%s) Owner : %s", AS_C_STRING(p_script.ptr()->get_name()), AS_C_STRING(parentNode->get_name()));
 
-	// Generate Script Identifier Hash
-	scriptInstanceIdentity = jenova::GenerateStandardUIDFromPath(p_script.ptr());
+	// Use Interned Script Identity
+	scriptIdentity = p_script->GetInternedIdentity();
+	scriptInstanceIdentity = scriptIdentity->scriptUID;
 
 	// Register Script Instance to Manager
 	JenovaScriptManager::get_singleton()->add_script_instance(this);
@@ -638,6 +677,161 @@ CPPScriptInstance::~CPPScriptInstance()
 	// Remove
 	jenova::VerboseByID(__LINE__, "CPPScriptInstance::~CPPScriptInstance (%s)", AS_C_STRING(this->get_identity()));
 
-	// Register Script Instance to Manager
+	// Release Instance Property Block
+	JenovaInterpreter::ReleasePropertyBlock(propertyBlock);
+	propertyBlock = nullptr;
+
+	// Unregister Script Instance from Manager
+	JenovaScriptManager::get_singleton()->unregister_native_update(this);
 	JenovaScriptManager::get_singleton()->remove_script_instance(this);
+}
+void CPPScriptInstance::release_instance()
+{
+	// Release Instances Created Without Pool
+	if (!instancePool)
+	{
+		memdelete(this);
+		return;
+	}
+
+	// Keep Pool Alive Until Slot Is Returned [Destructor Releases Script Reference]
+	std::shared_ptr<jenova::ScriptInstancePool> slotPool = std::move(instancePool);
+	void* instanceSlot = this;
+	this->~CPPScriptInstance();
+
+	// Return Slot To Script Pool
+	std::lock_guard<std::mutex> poolLock(slotPool->poolMutex);
+	slotPool->freeSlots.push_back(instanceSlot);
+	slotPool->poolStatistics.releasedInstances++;
+	slotPool->poolStatistics.activeInstances--;
+}
+
+// Jenova Script Callable Implementation
+std::shared_ptr<const jenova::CallableSlotBinding> CPPScriptCallable::resolve_slot_binding(CPPScriptInstance* scriptInstance) const
+{
+	// Use Binding Resolved For Current Generation
+	std::shared_ptr<const jenova::CallableSlotBinding> currentBinding = std::atomic_load(&slotBinding);
+	if (currentBinding && currentBinding->dispatchGeneration == JenovaInterpreter::GetDispatchGeneration()) return currentBinding;
+
+	// Resolve Slot Once Per Module Load [Method Map Holds Dispatch Snapshot Alive]
+	std::shared_ptr<jenova::CallableSlotBinding> newBinding = std::make_shared<jenova::CallableSlotBinding>();
+	newBinding->dispatchGeneration = JenovaInterpreter::GetDispatchGeneration();
+	newBinding->methodSlotMap = scriptInstance->get_script_object()->GetMethodSlotMap();
+	const jenova::ScriptMethodSlot* const* methodSlot = newBinding->methodSlotMap ? newBinding->methodSlotMap->getptr(methodName) : nullptr;
+	newBinding->methodSlot = methodSlot ? *methodSlot : nullptr;
+	std::atomic_store(&slotBinding, std::shared_ptr<const jenova::CallableSlotBinding>(newBinding));
+	return newBinding;
+}
+bool CPPScriptCallable::compare_equal(const CallableCustom* p_a, const CallableCustom* p_b)
+{
+	const CPPScriptCallable* callableA = static_cast<const CPPScriptCallable*>(p_a);
+	const CPPScriptCallable* callableB = static_cast<const CPPScriptCallable*>(p_b);
+	return callableA->ownerID == callableB->ownerID && callableA->methodName == callableB->methodName && callableA->nativeInvoker == callableB->nativeInvoker;
+}
+bool CPPScriptCallable::compare_less(const CallableCustom* p_a, const CallableCustom* p_b)
+{
+	const CPPScriptCallable* callableA = static_cast<const CPPScriptCallable*>(p_a);
+	const CPPScriptCallable* callableB = static_cast<const CPPScriptCallable*>(p_b);
+	if (callableA->ownerID != callableB->ownerID) return uint64_t(callableA->ownerID) < uint64_t(callableB->ownerID);
+	if (callableA->nativeInvoker != callableB->nativeInvoker) return std::less<const void*>()((const void*)callableA->nativeInvoker, (const void*)callableB->nativeInvoker);
+	return callableA->methodName < callableB->methodName;
+}
+uint32_t CPPScriptCallable::hash() const
+{
+	uint32_t callableHash = hash_murmur3_one_64(uint64_t(ownerID));
+	callableHash = hash_murmur3_one_64(uint64_t(nativeInvoker), callableHash);
+	return hash_murmur3_one_32(methodName.hash(), callableHash);
+}
+String CPPScriptCallable::get_as_text() const
+{
+	if (nativeInvoker) return String("JenovaNativeCallable::") + String::num_uint64(uint64_t(nativeInvoker), 16);
+	return String("JenovaScriptCallable::") + String(methodName);
+}
+CallableCustom::CompareEqualFunc CPPScriptCallable::get_compare_equal_func() const
+{
+	return &CPPScriptCallable::compare_equal;
+}
+CallableCustom::CompareLessFunc CPPScriptCallable::get_compare_less_func() const
+{
+	return &CPPScriptCallable::compare_less;
+}
+bool CPPScriptCallable::is_valid() const
+{
+	if (nativeInvoker && invokerGeneration != JenovaInterpreter::GetDispatchGeneration()) return false;
+	return ObjectDB::get_instance(uint64_t(ownerID)) != nullptr;
+}
+ObjectID CPPScriptCallable::get_object() const
+{
+	return ownerID;
+}
+int CPPScriptCallable::get_argument_count(bool& r_is_valid) const
+{
+	// Argument Count Is Only Known For Script Method Slots
+	r_is_valid = false;
+	if (nativeInvoker) return 0;
+	CPPScriptInstance* scriptInstance = JenovaScriptManager::get_singleton()->get_script_instance_from_owner(ObjectDB::get_instance(uint64_t(ownerID)));
+	if (!scriptInstance) return 0;
+	std::shared_ptr<const jenova::CallableSlotBinding> currentBinding = resolve_slot_binding(scriptInstance);
+	if (!currentBinding->methodSlot) return 0;
+	r_is_valid = true;
+	return int(currentBinding->methodSlot->parameterMarshals.size());
+}
+void CPPScriptCallable::call(const Variant** p_arguments, int p_argcount, Variant& r_return_value, GDExtensionCallError& r_call_error) const
+{
+	// Validate Owner
+	Object* ownerObject = ObjectDB::get_instance(uint64_t(ownerID));
+	if (!ownerObject)
+	{
+		r_call_error.error = GDEXTENSION_CALL_ERROR_INSTANCE_IS_NULL;
+		return;
+	}
+
+	// Call Native Function Directly [Arguments Are Cast Once By Generated Invoker]
+	if (nativeInvoker)
+	{
+		// Invoker Lives In Module Image, Keep Image Alive And Reject Invoker Once Image Was Swapped
+		ExecutionEpochScope epochScope;
+		if (invokerGeneration != JenovaInterpreter::GetDispatchGeneration())
+		{
+			r_call_error.error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
+			return;
+		}
+		if (!nativeInvoker(ownerObject, p_arguments, p_argcount, &r_return_value))
+		{
+			r_call_error.error = GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT;
+			return;
+		}
+		r_call_error.error = GDEXTENSION_CALL_OK;
+		return;
+	}
+
+	// Call Resolved Script Method Slot [Skips Name Lookup And Internal Method Checks of callp]
+	CPPScriptInstance* scriptInstance = JenovaScriptManager::get_singleton()->get_script_instance_from_owner(ownerObject);
+	if (!scriptInstance || !scriptInstance->is_invokable())
+	{
+		r_call_error.error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
+		return;
+	}
+	std::shared_ptr<const jenova::CallableSlotBinding> currentBinding = resolve_slot_binding(scriptInstance);
+	if (!currentBinding->methodSlot)
+	{
+		r_call_error.error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
+		return;
+	}
+	if (p_argcount < int(currentBinding->methodSlot->parameterMarshals.size()))
+	{
+		r_call_error.error = GDEXTENSION_CALL_ERROR_TOO_FEW_ARGUMENTS;
+		r_call_error.expected = int32_t(currentBinding->methodSlot->parameterMarshals.size());
+		return;
+	}
+	r_return_value = scriptInstance->invoke_method_slot(*currentBinding->methodSlot, p_arguments, p_argcount);
+	r_call_error.error = GDEXTENSION_CALL_OK;
+}
+
+// Jenova Script Callable Initializer
+CPPScriptCallable::CPPScriptCallable(Object* p_owner, const StringName& p_method) : ownerID(p_owner ? p_owner->get_instance_id() : 0), methodName(p_method)
+{
+}
+CPPScriptCallable::CPPScriptCallable(Object* p_owner, jenova::NativeInvoker p_invoker) : ownerID(p_owner ? p_owner->get_instance_id() : 0), nativeInvoker(p_invoker), invokerGeneration(JenovaInterpreter::GetDispatchGeneration())
+{
 }
\ No newline at end of file
@@ -22,14 +22,18 @@ class CPPScriptInstance : public ScriptInstanceExtension
 protected:
 	Object* owner;
 	Ref<CPPScript> script;
-	mutable Dictionary instanceProperties;
+	mutable jenova::ScriptPropertyBlock* propertyBlock = nullptr;
 	mutable List<MethodInfo> methodsInfo;
 	size_t refCount = 0;
 	String scriptInstanceIdentity = "";
+	std::shared_ptr<const jenova::ScriptIdentity> scriptIdentity;
 	bool isDeleting = false;
+	std::shared_ptr<jenova::ScriptInstancePool> instancePool;
 
 private:
 	void update_methods() const;
+	jenova::ScriptPropertyBlock* get_property_block() const;
+	const jenova::ScriptPropertyContainer& get_property_container() const;
 
 public:
 	// Base Methods
@@ -57,12 +61,57 @@ public:
 	void property_set_fallback(const StringName& p_name, const Variant& p_value, bool* r_valid) override;
 	Variant property_get_fallback(const StringName& p_name, bool* r_valid) override;
 	ScriptLanguage* _get_language() override;
+	void release_instance() override;
 
 public:
 	// Methods
 	String get_identity();
+	const Ref<CPPScript>& get_script_object() const;
+	Object* get_owner_object() const;
+	bool is_invokable() const;
+	bool bind_properties() const;
+	Variant invoke_method_slot(const jenova::ScriptMethodSlot& methodSlot, const Variant** p_args, int p_argcount, bool p_bind_properties = true);
+	bool invoke_method_slot_ptr(const jenova::ScriptMethodSlot& methodSlot, const GDExtensionConstTypePtr* p_args, GDExtensionTypePtr r_ret);
 
 	// Initializer/Destructor
+	static CPPScriptInstance* create_pooled_instance(Object* p_owner, const Ref<CPPScript>& p_script, const std::shared_ptr<jenova::ScriptInstancePool>& p_pool);
 	CPPScriptInstance(Object* p_owner, const Ref<CPPScript> p_script);
 	~CPPScriptInstance();
+
+public:
+	// Script Manager Registration
+	jenova::RegistryHandle managerHandle;
+	jenova::RegistryHandle groupHandle;
+	uint32_t nativeUpdateIndex = UINT32_MAX;
+};
+
+// Jenova Script Callable Definition
+class CPPScriptCallable : public CallableCustom
+{
+private:
+	ObjectID ownerID;
+	StringName methodName;
+	jenova::NativeInvoker nativeInvoker = nullptr;
+	uint64_t invokerGeneration = 0;
+	mutable std::shared_ptr<const jenova::CallableSlotBinding> slotBinding;
+
+private:
+	std::shared_ptr<const jenova::CallableSlotBinding> resolve_slot_binding(CPPScriptInstance* scriptInstance) const;
+	static bool compare_equal(const CallableCustom* p_a, const CallableCustom* p_b);
+	static bool compare_less(const CallableCustom* p_a, const CallableCustom* p_b);
+
+public:
+	// Base Methods
+	uint32_t hash() const override;
+	String get_as_text() const override;
+	CompareEqualFunc get_compare_equal_func() const override;
+	CompareLessFunc get_compare_less_func() const override;
+	bool is_valid() const override;
+	ObjectID get_object() const override;
+	int get_argument_count(bool& r_is_valid) const override;
+	void call(const Variant** p_arguments, int p_argcount, Variant& r_return_value, GDExtensionCallError& r_call_error) const override;
+
+	// Initializer
+	CPPScriptCallable(Object* p_owner, const StringName& p_method);
+	CPPScriptCallable(Object* p_owner, jenova::NativeInvoker p_invoker);
 };
@@ -190,7 +190,7 @@ static void gdextension_script_instance_free(GDExtensionScriptInstanceDataPtr p_
 {
 	if (p_instance) {
 		ScriptInstanceExtension* instance = reinterpret_cast<ScriptInstanceExtension*>(p_instance);
-		memdelete(instance);
+		instance->release_instance();
 	}
 }
 static GDExtensionInt gdextension_script_instance_get_method_argument_count(GDExtensionScriptInstanceDataPtr p_instance, GDExtensionConstStringNamePtr p_name, GDExtensionBool* r_is_valid)
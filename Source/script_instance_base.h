@@ -62,6 +62,7 @@ namespace godot
 		virtual void property_set_fallback(const StringName& p_name, const Variant& p_value, bool* r_valid) = 0;
 		virtual Variant property_get_fallback(const StringName& p_name, bool* r_valid) = 0;
 		virtual ScriptLanguage* _get_language() = 0;
+		virtual void release_instance() { memdelete(this); }
 
 		virtual ~ScriptInstanceExtension() {};
 	};
@@ -25,8 +25,163 @@
 // Tiny C Compiler
 #include <TinyCC/libtcc.h>
 
-// Helper Macros
-#define RESOLVE_PARAMETER(index) JenovaInterpreter::GetResolvedParameterPointer(objectPtr, functionParameters[index], functionParametersType[index + parameterOffset])
+// Storages
+static asmjit::JitRuntime* thunkRuntime = nullptr;
+
+// Helper Functions
+static bool WritePropertySlotValue(const jenova::ScriptPropertySlot& propertySlot, void* propertyStorage, const Variant& propertyValue)
+{
+    // Dispatch Through Type Descriptor Resolved At Load [Rejects Mismatching Variant Types]
+    return propertySlot.typeOperations->writeFromVariant(propertyStorage, propertyValue);
+}
+static void AddNativeClassMetadata(jenova::json_t& serializer, const jenova::ModuleList& scriptModules)
+{
+    // Native Class Binding Is Opt-In
+    if (!jenova::GlobalStorage::UseNativeClassBinding) return;
+
+    // Record Class Name, Base Type And Resource Path of Named Scripts
+    for (const auto& scriptModule : scriptModules)
+    {
+        if (!scriptModule.scriptFilename.begins_with("res://")) continue;
+        std::string scriptSource = AS_STD_STRING(scriptModule.scriptSource);
+        std::string className = jenova::ParseClassNameFromScriptSource(scriptSource);
+        if (className.empty()) continue;
+        std::string baseType = jenova::ParseClassBaseTypeFromScriptSource(scriptSource);
+        serializer["Scripts"][AS_STD_STRING(scriptModule.scriptUID)]["NativeClass"] = { {"ClassName", className}, {"BaseType", baseType}, {"ScriptPath", AS_STD_STRING(scriptModule.scriptFilename)} };
+    }
+}
+static GDExtensionClassMethodArgumentMetadata GetNativeArgumentMetadata(jenova::MarshalTypeTag typeTag)
+{
+    switch (typeTag)
+    {
+    case jenova::MarshalTypeTag::Int32: return GDEXTENSION_METHOD_ARGUMENT_METADATA_INT_IS_INT32;
+    case jenova::MarshalTypeTag::UInt32: return GDEXTENSION_METHOD_ARGUMENT_METADATA_INT_IS_UINT32;
+    case jenova::MarshalTypeTag::Int64: return GDEXTENSION_METHOD_ARGUMENT_METADATA_INT_IS_INT64;
+    case jenova::MarshalTypeTag::UInt64: return GDEXTENSION_METHOD_ARGUMENT_METADATA_INT_IS_UINT64;
+    case jenova::MarshalTypeTag::Float: return GDEXTENSION_METHOD_ARGUMENT_METADATA_REAL_IS_FLOAT;
+    case jenova::MarshalTypeTag::Double: return GDEXTENSION_METHOD_ARGUMENT_METADATA_REAL_IS_DOUBLE;
+    default: return GDEXTENSION_METHOD_ARGUMENT_METADATA_NONE;
+    }
+}
+static const jenova::ScriptMethodSlot* GetNativeClassMethodSlot(CPPScriptInstance* scriptInstance, const StringName& methodName, std::shared_ptr<const jenova::MethodSlotMap>& methodSlotMap)
+{
+    // Method Map Holds Dispatch Snapshot Alive During Call
+    if (!scriptInstance || !scriptInstance->is_invokable()) return nullptr;
+    methodSlotMap = scriptInstance->get_script_object()->GetMethodSlotMap();
+    const jenova::ScriptMethodSlot* const* methodSlot = methodSlotMap ? methodSlotMap->getptr(methodName) : nullptr;
+    return methodSlot ? *methodSlot : nullptr;
+}
+
+// Native Class Callbacks
+static GDExtensionObjectPtr CreateNativeClassInstance(void* classUserdata)
+{
+    // Construct Parent Object
+    jenova::NativeClass* nativeClass = static_cast<jenova::NativeClass*>(classUserdata);
+    GDExtensionObjectPtr objectPtr = godot::internal::gdextension_interface_classdb_construct_object(nativeClass->parentClassName._native_ptr());
+    if (!objectPtr) return nullptr;
+
+    // Attach Instance [Wrapper Is Bound While Object Still Reports Parent Class]
+    jenova::NativeClassInstance* classInstance = new jenova::NativeClassInstance();
+    classInstance->nativeClass = nativeClass;
+    classInstance->ownerObject = godot::internal::get_object_instance_binding(objectPtr);
+    godot::internal::gdextension_interface_object_set_instance(objectPtr, nativeClass->className._native_ptr(), classInstance);
+
+    // Attach Script Resolved At Registration [Script Instance Keeps Owning Properties And Callbacks]
+    if (nativeClass->scriptResource.is_valid()) classInstance->ownerObject->set_script(nativeClass->scriptResource);
+    return objectPtr;
+}
+static void FreeNativeClassInstance(void* classUserdata, GDExtensionClassInstancePtr instancePtr)
+{
+    delete static_cast<jenova::NativeClassInstance*>(instancePtr);
+}
+static GDExtensionClassCallVirtual GetNativeClassVirtual(void* classUserdata, GDExtensionConstStringNamePtr virtualName)
+{
+    // Virtuals Are Served By Script Instance
+    return nullptr;
+}
+static void CallNativeClassMethod(void* methodUserdata, GDExtensionClassInstancePtr instancePtr, const GDExtensionConstVariantPtr* callArguments, GDExtensionInt argumentsCount, GDExtensionVariantPtr returnValue, GDExtensionCallError* callError)
+{
+    // Resolve Method Slot From Owner Script Instance
+    const jenova::NativeClassMethod* classMethod = static_cast<const jenova::NativeClassMethod*>(methodUserdata);
+    const jenova::NativeClassInstance* classInstance = static_cast<const jenova::NativeClassInstance*>(instancePtr);
+    CPPScriptInstance* scriptInstance = JenovaScriptManager::get_singleton()->get_script_instance_from_owner(classInstance->ownerObject);
+    std::shared_ptr<const jenova::MethodSlotMap> methodSlotMap;
+    const jenova::ScriptMethodSlot* methodSlot = GetNativeClassMethodSlot(scriptInstance, classMethod->methodName, methodSlotMap);
+    if (!methodSlot)
+    {
+        callError->error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
+        godot::internal::gdextension_interface_variant_new_nil(returnValue);
+        return;
+    }
+
+    // Invoke Using Variant Path
+    Variant callResult = scriptInstance->invoke_method_slot(*methodSlot, (const Variant**)callArguments, int(argumentsCount));
+    if (!classMethod->mustReturn) callResult = Variant();
+    godot::internal::gdextension_interface_variant_new_copy(returnValue, callResult._native_ptr());
+    callError->error = GDEXTENSION_CALL_OK;
+}
+static uint64_t GetNativeMethodSignatureHash(const jenova::ScriptMethodSlot& methodSlot)
+{
+    // Engine Encodes Pointer Call Arguments By Registered Types, Hash Covers Everything That Encoding Depends On
+    uint64_t signatureHash = hash_murmur3_one_64(uint64_t(methodSlot.returnTag));
+    signatureHash = hash_murmur3_one_64(uint64_t(methodSlot.mustReturn), signatureHash);
+    for (const jenova::ParameterMarshal& parameterMarshal : methodSlot.parameterMarshals) signatureHash = hash_murmur3_one_64(uint64_t(parameterMarshal.typeTag), signatureHash);
+    return signatureHash;
+}
+static void WriteNativeReturnValue(const jenova::NativeClassMethod* classMethod, const Variant& resultValue, GDExtensionTypePtr returnValue)
+{
+    // Engine Passes Return Storage Only For Methods Registered With Return Value
+    if (!classMethod->mustReturn || !returnValue) return;
+    if (classMethod->returnType == Variant::NIL)
+    {
+        *static_cast<Variant*>(returnValue) = resultValue;
+        return;
+    }
+
+    // Mismatching Results Are Replaced By Default Constructed Value of Registered Type
+    Variant typedValue;
+    if (resultValue.get_type() == classMethod->returnType) typedValue = resultValue;
+    else
+    {
+        GDExtensionCallError constructError;
+        godot::internal::gdextension_interface_variant_construct(GDExtensionVariantType(classMethod->returnType), typedValue._native_ptr(), nullptr, 0, &constructError);
+    }
+    godot::internal::gdextension_interface_get_variant_to_type_constructor(GDExtensionVariantType(classMethod->returnType))(returnValue, typedValue._native_ptr());
+}
+static void PtrCallNativeClassMethod(void* methodUserdata, GDExtensionClassInstancePtr instancePtr, const GDExtensionConstTypePtr* callArguments, GDExtensionTypePtr returnValue)
+{
+    // Resolve Method Slot From Owner Script Instance
+    const jenova::NativeClassMethod* classMethod = static_cast<const jenova::NativeClassMethod*>(methodUserdata);
+    const jenova::NativeClassInstance* classInstance = static_cast<const jenova::NativeClassInstance*>(instancePtr);
+    CPPScriptInstance* scriptInstance = JenovaScriptManager::get_singleton()->get_script_instance_from_owner(classInstance->ownerObject);
+    std::shared_ptr<const jenova::MethodSlotMap> methodSlotMap;
+    const jenova::ScriptMethodSlot* methodSlot = GetNativeClassMethodSlot(scriptInstance, classMethod->methodName, methodSlotMap);
+
+    // Invoke Using Engine Encoded Arguments While Slot Still Matches Registered Signature
+    if (methodSlot && methodSlot->nativePtrInvoker && classMethod->signatureHash == classMethod->registeredSignatureHash)
+    {
+        if (scriptInstance->invoke_method_slot_ptr(*methodSlot, callArguments, returnValue)) return;
+    }
+
+    // Signature Changed By Reload, Decode Arguments Using Registered Types And Invoke Using Variant Path
+    else if (methodSlot)
+    {
+        std::vector<Variant> variantArguments(classMethod->argumentTypes.size());
+        std::vector<const Variant*> variantArgumentPtrs(classMethod->argumentTypes.size());
+        for (uint32_t i = 0; i < classMethod->argumentTypes.size(); i++)
+        {
+            if (classMethod->argumentTypes[i] == Variant::NIL) variantArguments[i] = *static_cast<const Variant*>(callArguments[i]);
+            else godot::internal::gdextension_interface_get_variant_from_type_constructor(GDExtensionVariantType(classMethod->argumentTypes[i]))(variantArguments[i]._native_ptr(), (GDExtensionTypePtr)callArguments[i]);
+            variantArgumentPtrs[i] = &variantArguments[i];
+        }
+        WriteNativeReturnValue(classMethod, scriptInstance->invoke_method_slot(*methodSlot, variantArgumentPtrs.data(), int(variantArgumentPtrs.size())), returnValue);
+        return;
+    }
+
+    // Never Leave Return Storage Unwritten
+    jenova::Error("Jenova Interpreter", "Native Class Method [%s] Could Not Be Called.", AS_C_STRING(String(classMethod->methodName)));
+    WriteNativeReturnValue(classMethod, Variant(), returnValue);
+}
 
 // Jenova Interpreter Implementation :: Boot
 void JenovaInterpreter::BootInterpreter()
@@ -89,102 +244,66 @@ bool JenovaInterpreter::ReleaseInterpreter()
 }
 
 // Jenova Interpreter Implementation :: Module Management
-bool JenovaInterpreter::LoadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData)
+bool JenovaInterpreter::LoadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const jenova::ModulePartList& moduleParts)
 {
     // Check If A Module Is Already Loaded
     if (moduleBaseAddress) return false;
 
-    // Update Metadata And Configuration
-    if (!JenovaInterpreter::UpdateConfigurationsFromMetaData(metaData))
-    {
-        jenova::Error("Jenova Interpreter", "Failed to Update Interpreter Configurations from Metadata.");
-        return false;
-    }
-
-    // Create Loader Flags
-    jenova::LoaderFlags loaderFlags = 0;
-    if (executeInDebugMode && !QUERY_ENGINE_MODE(Editor)) loaderFlags |= jenova::LoaderFlag::LoadInDebugMode;
-
-    // Load And Map Module to Memory
-    if (hasDebugInformation)
-    {
-        // Load Module As Virtual
-        moduleHandle = JenovaLoader::LoadModuleAsVirtual((void*)moduleDataPtr, moduleSize, "Jenova.Module.dll", moduleDiskPath.c_str(), loaderFlags);
-
-        // Load Debug Symbol If MSE Disabled
-        if (!jenova::GlobalStorage::UseManagedSafeExecution)
-        {
-            jenova::LoadSymbolForModule(jenova::GetCurrentProcessHandle(), jenova::LongWord(moduleHandle), moduleDiskPath + "\\Jenova.Module.pdb", moduleSize);
-        }
-    }
-    else
-    {
-        // Load Module As Regular
-        moduleHandle = JenovaLoader::LoadModule((void*)moduleDataPtr, moduleSize, loaderFlags);
-    }
-    if (!moduleHandle) return false;
-
-    // Get Module Base Address
-    moduleBaseAddress = JenovaLoader::GetModuleBaseAddress(moduleHandle);
-    if (!moduleBaseAddress) return false;
-
-    // Update Property Storage From Metadata
-    if (!JenovaInterpreter::UpdatePropertyStorageFromMetaData())
-    {
-        jenova::Error("Jenova Interpreter", "Failed to Update Interpreter Property Database from Metadata.");
-        return false;
-    }
-
-    // Resolve And Load Addon Modules
-    if (!jenova::ResolveAndLoadAddonModulesAtRuntime())
-    {
-        jenova::Error("Jenova Interpreter", "Failed to Resolve and Load Addon Modules.");
-        return false;
-    }
-
-    // Solve Functions Inside Module
-    if(!jenova::InitializeExtensionModule("InitializeJenovaModule", moduleHandle, jenova::ModuleCallMode::Virtual))
-    {
-        jenova::Error("Jenova Interpreter", "Failed to Initialize Jenova Module API Solver.");
-        return false;
-    }
+    // Prepare Module Image
+    jenova::ModuleImage moduleImage;
+    if (!JenovaInterpreter::PrepareModuleImage(moduleImage, moduleDataPtr, moduleSize, metaData, moduleParts)) return false;
 
-    // Call Module Boot Event If Exists
-    if (!jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleBootEventName, moduleHandle, jenova::ModuleCallMode::Virtual))
-    {
-        jenova::Warning("Jenova Interpreter", "Module Boot Event Failed. Unexpected Behaviors May Occur.");
-    }
-
-    // Enable Execution
-    allowExecution = true;
-
-    // All Good
-	return true;
+    // Activate Module Image
+    return JenovaInterpreter::CommitModuleImage(moduleImage);
 }
 bool JenovaInterpreter::LoadModule(const jenova::BuildResult& buildResult)
 {
-    return LoadModule(buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData);
+    return LoadModule(buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData, buildResult.moduleParts);
 }
-bool JenovaInterpreter::ReloadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData)
+bool JenovaInterpreter::ReloadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const jenova::ModulePartList& moduleParts)
 {
     // Reload Not Supported In Debug Mode
     if (executeInDebugMode) return false;
 
-    // Unload Module
-    if (!UnloadModule(jenova::ModuleUnloadStage::UnloadModuleToReload)) return false;
+    // Prepare New Module Image Aside [Loaded Module Keeps Running Until Swap]
+    jenova::ModuleImage moduleImage;
+    if (!JenovaInterpreter::PrepareModuleImage(moduleImage, moduleDataPtr, moduleSize, metaData, moduleParts)) return false;
 
-    // Load Module
-    return LoadModule(moduleDataPtr, moduleSize, metaData);
+    // Swap Module Images
+    return JenovaInterpreter::CommitModuleImage(moduleImage);
 }
 bool JenovaInterpreter::ReloadModule(const jenova::BuildResult& buildResult)
 {
-    return ReloadModule(buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData);
+    return ReloadModule(buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData, buildResult.moduleParts);
 }
 bool JenovaInterpreter::UnloadModule(const jenova::ModuleUnloadStage& unloadStage)
 {
+    // Deny Execution While Module Is Unloading
+    allowExecution = false;
+
+    // Drop Staged Module Image
+    {
+        std::lock_guard<std::mutex> stagingLock(moduleStagingMutex);
+        if (stagedModule) JenovaInterpreter::ReleaseModuleImage(*stagedModule);
+        stagedModule.reset();
+    }
+
+    // Unload Requested From Inside a Script Call [Waiting Would Never Return, Retire Module Instead]
+    bool isReentrantUnload = threadActiveCalls != 0;
+
+    // Wait For In-Flight Calls to Leave Module
+    JenovaInterpreter::AdvanceExecutionEpoch();
+    if (!isReentrantUnload)
+    {
+        while (epochActiveCalls[0].load() != 0 || epochActiveCalls[1].load() != 0) std::this_thread::yield();
+    }
+
     // Adjust Agressive Mode [Disable For All For Now]
     JenovaLoader::SetAgressiveMode(!(QUERY_ENGINE_MODE(Editor) || QUERY_ENGINE_MODE(Debug) || QUERY_ENGINE_MODE(Runtime)));
 
+    // Release Retired Module Images
+    JenovaInterpreter::ReleaseRetiredModules();
+
     // Flush Property Storage
     if (!JenovaInterpreter::FlushPropertyStorage())
     {
@@ -192,11 +311,25 @@ bool JenovaInterpreter::UnloadModule(const jenova::ModuleUnloadStage& unloadStag
         return false;
     }
 
+    // Invalidate Cached Caller Thunks [Caller May Still Run Through One When Re-Entrant]
+    if (!isReentrantUnload && !JenovaInterpreter::ReleaseCallerThunks())
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Release Interpreter Caller Thunks.");
+        return false;
+    }
+
     // Call Module Shutdown Event If Exists
     if (!jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleShutdownEventName, moduleHandle, jenova::ModuleCallMode::Virtual))
     {
         jenova::Warning("Jenova Interpreter", "Module Shutdown Event Failed. Unexpected Behaviors May Occur.");
     }
+    for (const auto& loadedPart : loadedModuleParts)
+    {
+        if (!jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleShutdownEventName, loadedPart->moduleHandle, jenova::ModuleCallMode::Virtual))
+        {
+            jenova::Warning("Jenova Interpreter", "Module Part [%s] Shutdown Event Failed. Unexpected Behaviors May Occur.", loadedPart->partName.c_str());
+        }
+    }
 
     // If Debug Mode is Activated Unload Module Loaded From Disk
     if (executeInDebugMode) return jenova::ReleaseTemporaryModuleCache();
@@ -207,136 +340,585 @@ bool JenovaInterpreter::UnloadModule(const jenova::ModuleUnloadStage& unloadStag
     // Unload Module
 	if (!moduleHandle) return false;
 	if (!moduleBaseAddress) return false;
-    if (!JenovaLoader::ReleaseModule(moduleHandle)) return false;
+    if (isReentrantUnload)
+    {
+        // Defer Release Until Calls Counted Up To Current Epoch Have Left
+        jenova::RetiredModule retiredModule;
+        retiredModule.moduleHandle = moduleHandle;
+        retiredModule.moduleBaseAddress = moduleBaseAddress;
+        retiredModule.retireEpoch = executionEpoch.load();
+        retiredModules.push_back(retiredModule);
+        std::lock_guard<std::mutex> loaderLock(moduleLoaderMutex);
+        for (const auto& loadedPart : loadedModuleParts)
+        {
+            retiredModule.moduleHandle = loadedPart->moduleHandle;
+            retiredModule.moduleBaseAddress = loadedPart->moduleBaseAddress;
+            retiredModules.push_back(retiredModule);
+            loadedPart->isActive = false;
+            loadedPart->isRetired = true;
+        }
+        loadedModuleParts.clear();
+        jenova::VerboseByID(__LINE__, "Jenova Module Unloaded From Script Call, Release Deferred to Epoch %llu.", (unsigned long long)retiredModule.retireEpoch);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> loaderLock(moduleLoaderMutex);
+        if (!JenovaLoader::ReleaseModule(moduleHandle)) return false;
+        for (const auto& loadedPart : loadedModuleParts)
+        {
+            if (!JenovaLoader::ReleaseModule(loadedPart->moduleHandle)) jenova::Warning("Jenova Interpreter", "Failed to Release Jenova Module Part [%s].", loadedPart->partName.c_str());
+            loadedPart->isActive = false;
+            loadedPart->isRetired = true;
+        }
+        loadedModuleParts.clear();
+    }
     moduleHandle = nullptr;
 	moduleBaseAddress = 0;
-    moduleMetaData = "{}";
+    PublishDispatchSnapshot(std::make_shared<jenova::DispatchSnapshot>());
 
     // All Good
 	return true;
 }
-bool JenovaInterpreter::LoadDebugSymbol(const std::string symbolFilePath)
+bool JenovaInterpreter::StageModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const jenova::ModulePartList& moduleParts)
 {
-    return jenova::LoadSymbolForModule(jenova::GetCurrentProcessHandle(), moduleBaseAddress, symbolFilePath.c_str(), moduleBinarySize);
+    // Reload Not Supported In Debug Mode
+    if (executeInDebugMode) return false;
+
+    // Prepare Module Image While Loaded Module Keeps Running
+    std::unique_ptr<jenova::ModuleImage> moduleImage = std::make_unique<jenova::ModuleImage>();
+    if (!JenovaInterpreter::PrepareModuleImage(*moduleImage, moduleDataPtr, moduleSize, metaData, moduleParts)) return false;
+
+    // Replace Pending Module Image [Newest Build Wins]
+    std::lock_guard<std::mutex> stagingLock(moduleStagingMutex);
+    if (stagedModule) JenovaInterpreter::ReleaseModuleImage(*stagedModule);
+    stagedModule = std::move(moduleImage);
+    return true;
 }
-intptr_t JenovaInterpreter::GetModuleBaseAddress()
+bool JenovaInterpreter::StageModuleFromDatabase(const std::string& moduleDatabaseName)
 {
-	return moduleBaseAddress;
+    // Only One Staging Task At A Time
+    if (isStaging) return false;
+
+    // Read And Prepare Module On Task Thread, Swap Happens In UpdateModuleStaging
+    isStaging = true;
+    stagingTaskID = JenovaTaskSystem::InitiateTask([moduleDatabaseName]()
+    {
+        jenova::MemoryBuffer moduleData;
+        jenova::SerializedData metaData;
+        jenova::ModulePartList moduleParts;
+        if (!JenovaInterpreter::ReadModuleDatabase(moduleDatabaseName, moduleData, metaData, moduleParts))
+        {
+            jenova::Error("Jenova Interpreter", "Unable to Read Jenova Module Database for Staging.");
+            return;
+        }
+        if (!JenovaInterpreter::StageModule(moduleData.data(), moduleData.size(), metaData, moduleParts))
+        {
+            jenova::Error("Jenova Interpreter", "Unable to Stage Compiled Jenova Module From Database.");
+        }
+    });
+
+    // All Good
+    return true;
 }
-jenova::FunctionList JenovaInterpreter::GetFunctionsList(const std::string& scriptUID)
+bool JenovaInterpreter::StageModuleFromBuild(const jenova::BuildResult& buildResult)
 {
-    try
+    // Only One Staging Task At A Time
+    if (isStaging) return false;
+
+    // Copy Build Output For Task Thread [Builder Releases Its Buffers Once Build Returns]
+    auto moduleData = std::make_shared<jenova::MemoryBuffer>(buildResult.builtModuleData);
+    auto metaData = std::make_shared<jenova::SerializedData>(buildResult.moduleMetaData);
+    auto moduleParts = std::make_shared<jenova::ModulePartList>(buildResult.moduleParts);
+
+    // Prepare Module On Task Thread, Swap Happens In UpdateModuleStaging
+    isStaging = true;
+    stagingTaskID = JenovaTaskSystem::InitiateTask([moduleData, metaData, moduleParts]()
     {
-        // Create Function List
-        jenova::FunctionList functionNames;
-        
-        // Get Script Metadata by UID
-        jenova::json_t scriptMetadata = moduleMetaData["Scripts"][scriptUID]["methods"];
+        if (!JenovaInterpreter::StageModule(moduleData->data(), moduleData->size(), *metaData, *moduleParts))
+        {
+            jenova::Error("Jenova Interpreter", "Unable to Stage Compiled Jenova Module From Build.");
+        }
+    });
 
-        // Add Functions to List
-        for (const auto& functionName : scriptMetadata.items()) functionNames.push_back(functionName.key());
+    // All Good
+    return true;
+}
+bool JenovaInterpreter::IsModuleStaging()
+{
+    return isStaging;
+}
+bool JenovaInterpreter::UpdateModuleStaging()
+{
+    // Clear Finished Staging Task
+    if (isStaging && JenovaTaskSystem::IsTaskComplete(stagingTaskID))
+    {
+        JenovaTaskSystem::ClearTask(stagingTaskID);
+        isStaging = false;
+    }
 
-        // Return List
-        return functionNames;
+    // Take Staged Module Image
+    std::unique_ptr<jenova::ModuleImage> moduleImage;
+    {
+        std::lock_guard<std::mutex> stagingLock(moduleStagingMutex);
+        moduleImage = std::move(stagedModule);
     }
-    catch (const std::exception&)
+
+    // Swap Module Images At Frame Boundary
+    if (moduleImage && !JenovaInterpreter::CommitModuleImage(*moduleImage))
     {
-        return jenova::FunctionList();
+        jenova::Error("Jenova Interpreter", "Unable to Activate Staged Jenova Module.");
     }
+
+    // Release Retired Module Images
+    return JenovaInterpreter::ReleaseRetiredModules();
 }
-jenova::FunctionAddress JenovaInterpreter::GetFunctionAddress(const std::string& functionName, const std::string& scriptUID)
+bool JenovaInterpreter::ReleaseRetiredModules()
 {
-    try
+    // Validate Retired Modules
+    if (retiredModules.empty()) return true;
+
+    // Close Epoch Of Latest Retirement [Its Snapshot Is Already Published]
+    uint64_t currentEpoch = executionEpoch.load();
+    for (const auto& retiredModule : retiredModules)
     {
-        // Validate Script UID
-        if (!moduleMetaData["Scripts"].contains(scriptUID)) return 0;
+        if (retiredModule.retireEpoch < currentEpoch) continue;
+        if (JenovaInterpreter::AdvanceExecutionEpoch()) currentEpoch = executionEpoch.load();
+        break;
+    }
 
-        // Get Script Metadata by UID
-        jenova::json_t scriptMetadata = moduleMetaData["Scripts"][scriptUID]["methods"];
+    // Release Modules Once No Call From Their Epoch Or Any Earlier One Is In Flight
+    for (auto retiredModule = retiredModules.begin(); retiredModule != retiredModules.end();)
+    {
+        if (!JenovaInterpreter::IsExecutionEpochDrained(retiredModule->retireEpoch))
+        {
+            retiredModule++;
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> loaderLock(moduleLoaderMutex);
+            JenovaInterpreter::ReleaseModuleCallerThunks(retiredModule->moduleBaseAddress);
+            if (!JenovaLoader::ReleaseModule(retiredModule->moduleHandle)) jenova::Warning("Jenova Interpreter", "Failed to Release Retired Jenova Module.");
+        }
+        jenova::VerboseByID(__LINE__, "Retired Jenova Module [%p] Released At Epoch %llu.", retiredModule->moduleHandle, (unsigned long long)currentEpoch);
+        retiredModule = retiredModules.erase(retiredModule);
+    }
 
-        // Get Function Address
-        for (const auto& funcName : scriptMetadata.items())
+    // All Good
+    return true;
+}
+uint64_t JenovaInterpreter::EnterExecutionEpoch()
+{
+    // Count Call In Current Epoch, Retry If Epoch Advanced Meanwhile
+    while (true)
+    {
+        uint64_t currentEpoch = executionEpoch.load();
+        epochActiveCalls[currentEpoch & 1].fetch_add(1);
+        if (executionEpoch.load() == currentEpoch)
         {
-            if (funcName.key() == functionName)
+            threadActiveCalls++;
+            return currentEpoch;
+        }
+        epochActiveCalls[currentEpoch & 1].fetch_sub(1);
+    }
+}
+void JenovaInterpreter::LeaveExecutionEpoch(uint64_t callEpoch)
+{
+    threadActiveCalls--;
+    epochActiveCalls[callEpoch & 1].fetch_sub(1);
+}
+bool JenovaInterpreter::AdvanceExecutionEpoch()
+{
+    // Advance Only Once Previous Epoch Has Drained [Keeps At Most Two Epochs In Flight So Counters Never Alias]
+    uint64_t currentEpoch = executionEpoch.load();
+    if (epochActiveCalls[(currentEpoch + 1) & 1].load() != 0) return false;
+    return executionEpoch.compare_exchange_strong(currentEpoch, currentEpoch + 1);
+}
+bool JenovaInterpreter::IsExecutionEpochDrained(uint64_t callEpoch)
+{
+    // Only Current And Previous Epoch Can Hold Calls, Anything Older Drained Before Epoch Advanced
+    uint64_t currentEpoch = executionEpoch.load();
+    if (currentEpoch <= callEpoch) return false;
+    if (currentEpoch > callEpoch + 1) return true;
+    return epochActiveCalls[callEpoch & 1].load() == 0;
+}
+bool JenovaInterpreter::PrepareModuleImage(jenova::ModuleImage& moduleImage, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const jenova::ModulePartList& moduleParts)
+{
+    // Update Metadata And Configuration
+    if (!JenovaInterpreter::UpdateConfigurationsFromMetaData(moduleImage, metaData))
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Update Interpreter Configurations from Metadata.");
+        return false;
+    }
+
+    // Create Loader Flags
+    jenova::LoaderFlags loaderFlags = 0;
+    if ((executeInDebugMode || moduleImage.executeInDebugMode) && !QUERY_ENGINE_MODE(Editor)) loaderFlags |= jenova::LoaderFlag::LoadInDebugMode;
+
+    // Load And Map Module to Memory
+    {
+        std::lock_guard<std::mutex> loaderLock(moduleLoaderMutex);
+        if (moduleImage.hasDebugInformation)
+        {
+            // Load Module As Virtual
+            moduleImage.moduleHandle = JenovaLoader::LoadModuleAsVirtual((void*)moduleDataPtr, moduleSize, "Jenova.Module.dll", moduleImage.moduleDiskPath.c_str(), loaderFlags);
+
+            // Load Debug Symbol If MSE Disabled
+            bool useManagedSafeExecution = jenova::GlobalStorage::UseManagedSafeExecution;
+            if (!QUERY_ENGINE_MODE(Editor) && moduleImage.moduleMetaData.contains("ManagedSafeExecution")) useManagedSafeExecution = moduleImage.moduleMetaData["ManagedSafeExecution"].get<bool>();
+            if (moduleImage.moduleHandle && !useManagedSafeExecution)
             {
-                // Calculate Offset + BaseAddress And Return
-                jenova::FunctionAddress functionOffset = funcName.value()["Offset"].get<jenova::FunctionAddress>();
-                return moduleBaseAddress + functionOffset;
+                jenova::LoadSymbolForModule(jenova::GetCurrentProcessHandle(), jenova::LongWord(moduleImage.moduleHandle), moduleImage.moduleDiskPath + "\\Jenova.Module.pdb", moduleSize);
             }
         }
+        else
+        {
+            // Load Module As Regular
+            moduleImage.moduleHandle = JenovaLoader::LoadModule((void*)moduleDataPtr, moduleSize, loaderFlags);
+        }
     }
-    catch (const std::exception&)
+    if (!moduleImage.moduleHandle) return false;
+
+    // Get Module Base Address
+    moduleImage.moduleBaseAddress = JenovaLoader::GetModuleBaseAddress(moduleImage.moduleHandle);
+    if (!moduleImage.moduleBaseAddress)
     {
-        // Error Happened
-        return 0;
+        JenovaInterpreter::ReleaseModuleImage(moduleImage);
+        return false;
     }
 
-    // Function Was Not Found
-    return 0;
+    // Update Property Storage From Metadata
+    if (!JenovaInterpreter::UpdatePropertyStorageFromMetaData(moduleImage))
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Update Interpreter Property Database from Metadata.");
+        JenovaInterpreter::ReleaseModuleImage(moduleImage);
+        return false;
+    }
+
+    // Collect Native Invokers From Module
+    if (!JenovaInterpreter::UpdateNativeInvokersFromModule(moduleImage))
+    {
+        jenova::Warning("Jenova Interpreter", "Failed to Collect Native Invokers, Falling Back to JIT Backend.");
+    }
+
+    // Prepare Backend Callers
+    if (!JenovaInterpreter::PrepareDispatchCallers(moduleImage))
+    {
+        jenova::Warning("Jenova Interpreter", "Failed to Prepare Backend Callers, Callers Will Be Resolved On Demand.");
+    }
+
+    // Prepare Script Module Parts
+    if (!moduleParts.empty() && !JenovaInterpreter::PrepareModuleParts(moduleImage, moduleParts))
+    {
+        JenovaInterpreter::ReleaseModuleImage(moduleImage);
+        return false;
+    }
+
+    // All Good
+    return true;
 }
-jenova::ParameterTypeList JenovaInterpreter::GetFunctionParameters(const std::string& functionName, const std::string& scriptUID)
+bool JenovaInterpreter::PrepareModuleParts(jenova::ModuleImage& moduleImage, const jenova::ModulePartList& moduleParts)
 {
-    try
+    // Take Loaded Parts [Main Thread May Swap While Staging Thread Prepares]
+    jenova::ModuleImageList activeParts;
     {
-        // Validate Script UID
-        if (!moduleMetaData["Scripts"].contains(scriptUID)) return jenova::ParameterTypeList();
+        std::lock_guard<std::mutex> loaderLock(moduleLoaderMutex);
+        activeParts = loadedModuleParts;
+    }
 
-        // Get Script Metadata by UID
-        jenova::json_t scriptMetadata = moduleMetaData["Scripts"][scriptUID]["methods"];
+    // Share Unchanged Parts With Loaded Module And Load Changed Ones Aside
+    int reusedPartsCount = 0;
+    for (const jenova::ModulePart& modulePart : moduleParts)
+    {
+        std::shared_ptr<jenova::ModuleImage> partImage;
+        for (const auto& activePart : activeParts)
+        {
+            if (activePart->partName != modulePart.partName || activePart->partHash != modulePart.partHash) continue;
+            partImage = activePart;
+            reusedPartsCount++;
+            break;
+        }
+        if (!partImage)
+        {
+            partImage = std::make_shared<jenova::ModuleImage>();
+            partImage->partName = modulePart.partName;
+            partImage->partHash = modulePart.partHash;
+            if (!JenovaInterpreter::PrepareModuleImage(*partImage, modulePart.partData.data(), modulePart.partData.size(), modulePart.partMetaData))
+            {
+                jenova::Error("Jenova Interpreter", "Failed to Prepare Jenova Module Part [%s].", modulePart.partName.c_str());
+                return false;
+            }
+        }
+        moduleImage.partImages.push_back(partImage);
+    }
 
-        // Get Function Parameters
-        for (const auto& funcName : scriptMetadata.items())
+    // Merge Part Scripts Into Image [Slots And Layouts Keep Their Owner Part Addresses]
+    jenova::DispatchSnapshot& imageSnapshot = *moduleImage.dispatchSnapshot;
+    for (const auto& partImage : moduleImage.partImages)
+    {
+        if (partImage->moduleMetaData.contains("Scripts"))
         {
-            if (funcName.key() == functionName)
+            for (const auto& partScript : partImage->moduleMetaData["Scripts"].items())
             {
-                jenova::ParameterTypeList parameterTypes;
-                int paramCount = funcName.value()["ParamCount"].get<int>();
-                for (int i = 1; i <= paramCount; ++i) parameterTypes.push_back(funcName.value()[jenova::Format("Param%02d", i)].get<std::string>());
-                return parameterTypes;
+                // Each Script Identity Must Be Owned By Exactly One Part
+                if (moduleImage.moduleMetaData.contains("Scripts") && moduleImage.moduleMetaData["Scripts"].contains(partScript.key()))
+                {
+                    jenova::Error("Jenova Interpreter", "Script [%s] Is Described By More Than One Module Part [%s].", partScript.key().c_str(), partImage->partName.c_str());
+                    return false;
+                }
+                moduleImage.moduleMetaData["Scripts"][partScript.key()] = partScript.value();
             }
         }
+        for (const auto& dispatchEntry : partImage->dispatchSnapshot->dispatchTable)
+        {
+            imageSnapshot.dispatchIndices[dispatchEntry.scriptUID] = int(imageSnapshot.dispatchTable.size());
+            imageSnapshot.dispatchTable.push_back(dispatchEntry);
+        }
+        for (const auto& propertyLayout : partImage->propertyLayouts) moduleImage.propertyLayouts[propertyLayout.first] = propertyLayout.second;
     }
-    catch (const std::exception&)
+
+    // Verbose
+    jenova::VerboseByID(__LINE__, "Interpreter Prepared %d Module Parts, %d Reused From Loaded Module.", int(moduleImage.partImages.size()), reusedPartsCount);
+
+    // All Good
+    return true;
+}
+bool JenovaInterpreter::CommitModuleImage(jenova::ModuleImage& moduleImage)
+{
+    // Create Profiler Checkpoint
+    JenovaTinyProfiler::CreateCheckpoint("JenovaModuleSwap");
+
+    // Hold Property Binding So No Call Observes Half Swapped Property Globals
+    std::unique_lock<std::recursive_mutex> bindingLock = JenovaInterpreter::LockPropertyBinding();
+
+    // Validate Shared Parts [A Newer Swap May Have Retired Them Meanwhile]
+    for (const auto& partImage : moduleImage.partImages)
+    {
+        if (!partImage->isRetired) continue;
+        jenova::Error("Jenova Interpreter", "Jenova Module Part [%s] Was Retired Before Swap.", partImage->partName.c_str());
+        JenovaInterpreter::ReleaseModuleImage(moduleImage);
+        JenovaTinyProfiler::DeleteCheckpoint("JenovaModuleSwap");
+        return false;
+    }
+
+    // Collect Parts Booted By This Swap [Shared Parts Are Already Running]
+    jenova::ModuleImageList bootParts;
     {
-        // Error Happened
-        return jenova::ParameterTypeList();
+        std::lock_guard<std::mutex> loaderLock(moduleLoaderMutex);
+        for (const auto& partImage : moduleImage.partImages) if (!partImage->isActive) bootParts.push_back(partImage);
     }
 
-    // Not Found
-    return jenova::ParameterTypeList();
+    // Solve Functions Inside New Module And Parts Before Anything Is Retired [Failure Keeps Loaded Module Running]
+    for (const auto& bootPart : bootParts)
+    {
+        if (!jenova::InitializeExtensionModule("InitializeJenovaModule", bootPart->moduleHandle, jenova::ModuleCallMode::Virtual))
+        {
+            jenova::Error("Jenova Interpreter", "Failed to Initialize Jenova Module Part [%s] API Solver.", bootPart->partName.c_str());
+            JenovaInterpreter::ReleaseModuleImage(moduleImage);
+            JenovaTinyProfiler::DeleteCheckpoint("JenovaModuleSwap");
+            return false;
+        }
+    }
+    if (!jenova::InitializeExtensionModule("InitializeJenovaModule", moduleImage.moduleHandle, jenova::ModuleCallMode::Virtual))
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Initialize Jenova Module API Solver.");
+        JenovaInterpreter::ReleaseModuleImage(moduleImage);
+        JenovaTinyProfiler::DeleteCheckpoint("JenovaModuleSwap");
+        return false;
+    }
+
+    // Resolve And Load Addon Modules
+    if (!jenova::ResolveAndLoadAddonModulesAtRuntime())
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Resolve and Load Addon Modules.");
+        JenovaInterpreter::ReleaseModuleImage(moduleImage);
+        JenovaTinyProfiler::DeleteCheckpoint("JenovaModuleSwap");
+        return false;
+    }
+
+    // Advance Execution Epoch [Calls Entering Before Publish Still Observe Old Snapshot, So Retirees Belong to New Epoch]
+    JenovaInterpreter::AdvanceExecutionEpoch();
+
+    // Retire Loaded Module
+    if (moduleBaseAddress && !JenovaInterpreter::RetireLoadedModule(moduleImage))
+    {
+        JenovaInterpreter::ReleaseModuleImage(moduleImage);
+        JenovaTinyProfiler::DeleteCheckpoint("JenovaModuleSwap");
+        return false;
+    }
+
+    // Apply Module Configurations
+    JenovaInterpreter::SetInterpreterBackend(moduleImage.interpreterBackend);
+    if (moduleImage.executeInDebugMode) executeInDebugMode = true;
+    if (!QUERY_ENGINE_MODE(Editor))
+    {
+        if (moduleImage.moduleMetaData.contains("DeveloperMode")) jenova::GlobalStorage::DeveloperModeActivated = moduleImage.moduleMetaData["DeveloperMode"].get<bool>();
+        if (moduleImage.moduleMetaData.contains("ManagedSafeExecution")) jenova::GlobalStorage::UseManagedSafeExecution = moduleImage.moduleMetaData["ManagedSafeExecution"].get<bool>();
+    }
+
+    // Activate Module Image
+    moduleHandle = moduleImage.moduleHandle;
+    moduleBaseAddress = moduleImage.moduleBaseAddress;
+    moduleBinarySize = moduleImage.moduleBinarySize;
+    hasDebugInformation = moduleImage.hasDebugInformation;
+    calleeDestroysArguments = moduleImage.calleeDestroysArguments;
+    moduleDiskPath = moduleImage.moduleDiskPath;
+    moduleImage.moduleHandle = nullptr;
+    moduleImage.moduleBaseAddress = 0;
+
+    // Activate Module Parts
+    {
+        std::lock_guard<std::mutex> loaderLock(moduleLoaderMutex);
+        for (const auto& bootPart : bootParts) bootPart->isActive = true;
+        loadedModuleParts = std::move(moduleImage.partImages);
+    }
+
+    // Publish Dispatch Snapshot [Metadata And Property Layouts Are Published With It, Layouts Take Generation Being Published]
+    moduleImage.dispatchSnapshot->moduleMetaData = std::move(moduleImage.moduleMetaData);
+    moduleImage.dispatchSnapshot->propertyLayouts = std::move(moduleImage.propertyLayouts);
+    for (auto& propertyLayout : moduleImage.dispatchSnapshot->propertyLayouts) propertyLayout.second->layoutGeneration = GetDispatchGeneration() + 1;
+    PublishDispatchSnapshot(moduleImage.dispatchSnapshot);
+
+    // Register Script Classes to ClassDB
+    if (!JenovaInterpreter::RegisterNativeClasses())
+    {
+        jenova::Warning("Jenova Interpreter", "Failed to Register Native Classes, Script Instance Path Will Be Used.");
+    }
+
+    // Call Module Boot Event If Exists
+    if (!jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleBootEventName, moduleHandle, jenova::ModuleCallMode::Virtual))
+    {
+        jenova::Warning("Jenova Interpreter", "Module Boot Event Failed. Unexpected Behaviors May Occur.");
+    }
+    for (const auto& bootPart : bootParts)
+    {
+        if (!jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleBootEventName, bootPart->moduleHandle, jenova::ModuleCallMode::Virtual))
+        {
+            jenova::Warning("Jenova Interpreter", "Module Part [%s] Boot Event Failed. Unexpected Behaviors May Occur.", bootPart->partName.c_str());
+        }
+    }
+
+    // Enable Execution
+    allowExecution = true;
+
+    // Refresh Native Update Registrations [Reloaded Scripts May Add or Remove Opt-In]
+    if (JenovaScriptManager::get_singleton()) JenovaScriptManager::get_singleton()->refresh_native_updates();
+
+    // Verbose
+    jenova::VerboseByID(__LINE__, "Jenova Module Activated, Swap Time : %f ms", JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaModuleSwap"));
+
+    // All Good
+    return true;
 }
-std::string JenovaInterpreter::GetFunctionReturn(const std::string& functionName, const std::string& scriptUID)
+bool JenovaInterpreter::RetireLoadedModule(const jenova::ModuleImage& nextModuleImage)
 {
-    try
+    // Adjust Agressive Mode [Disable For All For Now]
+    JenovaLoader::SetAgressiveMode(!(QUERY_ENGINE_MODE(Editor) || QUERY_ENGINE_MODE(Debug) || QUERY_ENGINE_MODE(Runtime)));
+
+    // Flush Property Storage
+    if (!JenovaInterpreter::FlushPropertyStorage())
     {
-        // Validate Script UID
-        if (!moduleMetaData["Scripts"].contains(scriptUID)) return "Unknown";
+        jenova::Error("Jenova Interpreter", "Failed to Flush Interpreter Property Database.");
+        return false;
+    }
 
-        // Get Script Metadata by UID
-        jenova::json_t scriptMetadata = moduleMetaData["Scripts"][scriptUID]["methods"];
+    // Call Module Shutdown Event If Exists
+    if (!jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleShutdownEventName, moduleHandle, jenova::ModuleCallMode::Virtual))
+    {
+        jenova::Warning("Jenova Interpreter", "Module Shutdown Event Failed. Unexpected Behaviors May Occur.");
+    }
+
+    // Queue Module For Release [Calls Counted Up To Current Epoch May Still Run Inside It]
+    jenova::RetiredModule retiredModule;
+    retiredModule.moduleHandle = moduleHandle;
+    retiredModule.moduleBaseAddress = moduleBaseAddress;
+    retiredModule.retireEpoch = executionEpoch.load();
+    retiredModules.push_back(retiredModule);
+    moduleHandle = nullptr;
+    moduleBaseAddress = 0;
 
-        // Get Function Return Type
-        for (const auto& funcName : scriptMetadata.items())
+    // Retire Parts Replaced By Next Image [Unchanged Parts Stay Loaded With Their Instances]
+    for (const auto& loadedPart : loadedModuleParts)
+    {
+        if (std::find(nextModuleImage.partImages.begin(), nextModuleImage.partImages.end(), loadedPart) != nextModuleImage.partImages.end()) continue;
+        if (!jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleShutdownEventName, loadedPart->moduleHandle, jenova::ModuleCallMode::Virtual))
         {
-            if (funcName.key() == functionName)
-            {
-                return funcName.value()["ReturnType"].get<std::string>();
-            }
+            jenova::Warning("Jenova Interpreter", "Module Part [%s] Shutdown Event Failed. Unexpected Behaviors May Occur.", loadedPart->partName.c_str());
         }
+        retiredModule.moduleHandle = loadedPart->moduleHandle;
+        retiredModule.moduleBaseAddress = loadedPart->moduleBaseAddress;
+        retiredModules.push_back(retiredModule);
+        std::lock_guard<std::mutex> loaderLock(moduleLoaderMutex);
+        loadedPart->isActive = false;
+        loadedPart->isRetired = true;
     }
-    catch (const std::exception&)
+
+    // All Good
+    return true;
+}
+void JenovaInterpreter::ReleaseModuleImage(jenova::ModuleImage& moduleImage)
+{
+    // Release Parts That Never Got Activated [Shared Parts Belong to Loaded Module]
+    for (const auto& partImage : moduleImage.partImages)
     {
-        // Error Happened
-        return "Unknown";
+        bool isPartOwned = false;
+        {
+            std::lock_guard<std::mutex> loaderLock(moduleLoaderMutex);
+            isPartOwned = !partImage->isActive && !partImage->isRetired;
+        }
+        if (isPartOwned) JenovaInterpreter::ReleaseModuleImage(*partImage);
     }
+    moduleImage.partImages.clear();
+
+    // Release Image That Never Got Activated
+    if (!moduleImage.moduleHandle) return;
+    std::lock_guard<std::mutex> loaderLock(moduleLoaderMutex);
+    JenovaInterpreter::ReleaseModuleCallerThunks(moduleImage.moduleBaseAddress);
+    JenovaLoader::ReleaseModule(moduleImage.moduleHandle);
+    moduleImage.moduleHandle = nullptr;
+    moduleImage.moduleBaseAddress = 0;
+}
+bool JenovaInterpreter::LoadDebugSymbol(const std::string symbolFilePath)
+{
+    return jenova::LoadSymbolForModule(jenova::GetCurrentProcessHandle(), moduleBaseAddress, symbolFilePath.c_str(), moduleBinarySize);
+}
+intptr_t JenovaInterpreter::GetModuleBaseAddress()
+{
+	return moduleBaseAddress;
+}
+jenova::FunctionList JenovaInterpreter::GetFunctionsList(const std::string& scriptUID)
+{
+    // Create Function List
+    jenova::FunctionList functionNames;
 
-    // Not Found
-    return "Unknown";
+    // Get Script Dispatch Entry by UID
+    jenova::DispatchSnapshotPtr currentSnapshot = GetDispatchSnapshot();
+    const jenova::ScriptDispatchEntry* dispatchEntry = GetScriptDispatchEntry(*currentSnapshot, scriptUID);
+    if (!dispatchEntry) return functionNames;
+
+    // Add Functions to List
+    for (const auto& methodSlot : dispatchEntry->methodSlots) functionNames.push_back(methodSlot.functionName);
+
+    // Return List
+    return functionNames;
+}
+jenova::FunctionAddress JenovaInterpreter::GetFunctionAddress(const std::string& functionName, const std::string& scriptUID)
+{
+    // Calculate Offset + BaseAddress And Return
+    const jenova::ScriptMethodSlot* methodSlot = GetMethodSlot(scriptUID, StringName(functionName.c_str()));
+    if (!methodSlot) return 0;
+    return methodSlot->functionAddress;
+}
+jenova::ParameterTypeList JenovaInterpreter::GetFunctionParameters(const std::string& functionName, const std::string& scriptUID)
+{
+    const jenova::ScriptMethodSlot* methodSlot = GetMethodSlot(scriptUID, StringName(functionName.c_str()));
+    if (!methodSlot) return jenova::ParameterTypeList();
+    return methodSlot->parameterTypeNames;
 }
-uintptr_t JenovaInterpreter::GetResolvedParameterPointer(const godot::Object* objectPtr, const godot::Variant* functionParameter, const std::string& parameterType)
+std::string JenovaInterpreter::GetFunctionReturn(const std::string& functionName, const std::string& scriptUID)
 {
-    void* valueAddress = (void*)functionParameter;
-    return reinterpret_cast<uintptr_t>(valueAddress);
+    const jenova::ScriptMethodSlot* methodSlot = GetMethodSlot(scriptUID, StringName(functionName.c_str()));
+    if (!methodSlot) return "Unknown";
+    return methodSlot->returnTypeName;
 }
 bool JenovaInterpreter::IsFunctionReturnable(const std::string& returnType)
 {
@@ -345,43 +927,37 @@ bool JenovaInterpreter::IsFunctionReturnable(const std::string& returnType)
 }
 jenova::ScriptFunctionContainer JenovaInterpreter::GetFunctionContainer(const std::string& scriptUID)
 {
-    // Todo : For Faster Execution Implement Same as GetPropertyContainer
-
     // Create Function Container
     jenova::ScriptFunctionContainer functionContainer;
     functionContainer.scriptUID = AS_GD_STRING(scriptUID);
 
+    // Get Script Dispatch Entry by UID
+    jenova::DispatchSnapshotPtr currentSnapshot = GetDispatchSnapshot();
+    const jenova::ScriptDispatchEntry* dispatchEntry = GetScriptDispatchEntry(*currentSnapshot, scriptUID);
+    if (!dispatchEntry) return functionContainer;
+
     // Collect Script Functions
-    jenova::FunctionList jenovaMethods = GetFunctionsList(scriptUID);
-    for (size_t fid = 0; fid < jenovaMethods.size(); fid++)
+    const std::vector<jenova::ScriptMethodSlot>& methodSlots = dispatchEntry->methodSlots;
+    for (size_t fid = 0; fid < methodSlots.size(); fid++)
     {
         // Create Script Function
         jenova::ScriptFunction scriptFunction;
         scriptFunction.functionID = fid;
-        scriptFunction.functionName = String(jenovaMethods[fid].c_str());
+        scriptFunction.functionName = String(methodSlots[fid].functionName.c_str());
         scriptFunction.ownerScriptUID = functionContainer.scriptUID;
 
         // Create Method Information
-        scriptFunction.methodInfo.name = StringName(scriptFunction.functionName);
+        scriptFunction.methodInfo.name = methodSlots[fid].methodName;
         scriptFunction.methodInfo.flags = METHOD_FLAGS_DEFAULT;
         scriptFunction.methodInfo.id = scriptFunction.functionID;
 
-        // Get Function Return Type
-        Variant::Type returnType = jenova::GetVariantTypeFromStdString(GetFunctionReturn(jenovaMethods[fid], scriptUID));
-        scriptFunction.methodInfo.return_val = PropertyInfo(returnType, "return");
+        // Set Function Return Type
+        scriptFunction.methodInfo.return_val = PropertyInfo(methodSlots[fid].returnType, "return");
 
-        // Get Function Parameter Types
-        jenova::ParameterTypeList paramTypes = GetFunctionParameters(jenovaMethods[fid], scriptUID);
-        for (size_t pid = 0; pid < paramTypes.size(); pid++)
+        // Set Function Parameter Types
+        for (size_t argid = 0; argid < methodSlots[fid].parameterTypes.size(); argid++)
         {
-            Variant::Type paramType = jenova::GetVariantTypeFromStdString(paramTypes[pid]);
-            if (paramType != Variant::NIL) scriptFunction.methodInfo.arguments.push_back(PropertyInfo(paramType, "Param"));
-        }
-
-        // Name Added Arguments
-        for (size_t argid = 0; argid < scriptFunction.methodInfo.arguments.size(); argid++)
-        {
-            scriptFunction.methodInfo.arguments[argid].name = String(jenova::Format("Param%d", argid + 1).c_str());
+            scriptFunction.methodInfo.arguments.push_back(PropertyInfo(methodSlots[fid].parameterTypes[argid], String(jenova::Format("Param%d", argid + 1).c_str())));
         }
 
         // Add New Function to Container
@@ -391,314 +967,489 @@ jenova::ScriptFunctionContainer JenovaInterpreter::GetFunctionContainer(const st
     // Return Function Container
     return functionContainer;
 }
-jenova::ScriptPropertyContainer JenovaInterpreter::GetPropertyContainer(const std::string& scriptUID)
+std::shared_ptr<const jenova::ScriptPropertyContainer> JenovaInterpreter::GetPropertyContainer(const std::string& scriptUID)
 {
-    try
-    {
-        // Create Property Container
-        jenova::ScriptPropertyContainer propertyContainer;
-
-        // Check If Script has Database
-        if (!moduleMetaData["Scripts"][scriptUID].contains("database")) return propertyContainer;
-
-        // Get Script Database by UID
-        jenova::json_t scriptDatabase = moduleMetaData["Scripts"][scriptUID]["database"];
-
-        // Check If Script has Properties
-        if (!scriptDatabase.contains("properties")) return propertyContainer;
-
-        // Collect & Create Properties
-        propertyContainer = jenova::CreatePropertyContainerFromMetadata(scriptDatabase["properties"].dump(), scriptUID);
-
-        // Return List
-        return propertyContainer;
-    }
-    catch (const std::exception&)
-    {
-        return jenova::ScriptPropertyContainer();
-    }
+    // Return Container Cached At Module Load [Shares Ownership With Layout So It Outlives Reloads]
+    std::shared_ptr<jenova::ScriptPropertyLayout> propertyLayout = GetPropertyLayout(scriptUID);
+    if (!propertyLayout) return nullptr;
+    return std::shared_ptr<const jenova::ScriptPropertyContainer>(propertyLayout, &propertyLayout->propertyContainer);
 }
 Variant JenovaInterpreter::CallFunction(const godot::Object* objectPtr, const std::string& functionName, std::string& scriptUID, const Variant** functionParameters, const int functionParametersCount)
+{
+    // Get Method Slot From Dispatch Table
+    const jenova::ScriptMethodSlot* methodSlot = GetMethodSlot(scriptUID, StringName(functionName.c_str()));
+    if (!methodSlot) return Variant("ERROR::FUNCTION_ADDRESS_NOT_FOUND");
+
+    // Call Function Using Slot
+    return CallFunction(objectPtr, *methodSlot, functionParameters, functionParametersCount);
+}
+Variant JenovaInterpreter::CallFunction(const godot::Object* objectPtr, const jenova::ScriptMethodSlot& methodSlot, const Variant** functionParameters, const int functionParametersCount)
 {
     // Validate Module
     if (!allowExecution) return Variant("ERROR::EXECUTION_DENIED");
     if (!moduleHandle || !moduleBaseAddress) return Variant("ERROR::INVALID_MODULE");
 
+    // Enter Execution Epoch [Retired Module Images Are Released After Their Calls Leave]
+    ExecutionEpochScope epochScope;
+    if (methodSlot.dispatchGeneration != GetDispatchGeneration()) return Variant("ERROR::STALE_METHOD_SLOT");
+
     // Create Profiler Checkpoint [Not Required For Now]
     /* JenovaTinyProfiler::CreateCheckpoint("InterpreterCallFunction"); */
 
     // Verbose
-    jenova::VerboseByID(__LINE__, "Interpreter Calling Function [%s] From Script [%s] On Object [%p]", functionName.c_str(), scriptUID.c_str(), objectPtr);
+    jenova::VerboseByID(__LINE__, "Interpreter Calling Function [%s] From Script [%s] On Object [%p]", methodSlot.functionName.c_str(), methodSlot.ownerScriptUID.c_str(), objectPtr);
 
-    // Get Function Address Offset
-    jenova::FunctionAddress functionAddress = JenovaInterpreter::GetFunctionAddress(functionName, scriptUID);
-    if (!functionAddress) return Variant("ERROR::FUNCTION_ADDRESS_NOT_FOUND");
+    // Get Function Address
+    if (!methodSlot.functionAddress) return Variant("ERROR::FUNCTION_ADDRESS_NOT_FOUND");
+    jenova::FunctionAddress functionAddress = methodSlot.functionAddress;
 
-    // Get Function Return Type
-    std::string functionReturnType = JenovaInterpreter::GetFunctionReturn(functionName, scriptUID);
-    if (functionReturnType == "Unknown") return Variant("ERROR::FUNCTION_RETURN_TYPE_NOT_FOUND");
-
-    // Get Function Parameters Type
-    jenova::ParameterTypeList functionParametersType = JenovaInterpreter::GetFunctionParameters(functionName, scriptUID);
+    // Get Function Return And Parameters Type
+    const jenova::ParameterTypeList& functionParametersType = methodSlot.parameterTypeNames;
     if (functionParametersType.size() == 0) return Variant("ERROR::FUNCTION_PARAMETERS_TYPE_NOT_FOUND");
 
-    // Determine and Set Flags
-    bool callMustReturn = JenovaInterpreter::IsFunctionReturnable(functionReturnType);
-    bool callHasParameters = !(functionParametersType.size() == 1 && functionParametersType[0] == "void");
-    bool needsPassingOwner = functionParametersType[0] == "jenova::sdk::Caller*";
-
-    // Create Final Parameter List
-    std::vector<uintptr_t> resolvedParameters;
+    // Get Flags
+    bool callMustReturn = methodSlot.mustReturn;
+    bool needsPassingOwner = methodSlot.passesCaller;
 
-    // Pass Owner
-    std::shared_ptr<jenova::ScriptCaller> scriptHandle = nullptr;
-    if (needsPassingOwner)
+    // Call Using Native Invoker If Module Provides One
+    if (methodSlot.nativeInvoker)
     {
-        scriptHandle = std::make_shared<jenova::ScriptCaller>(objectPtr);
-        resolvedParameters.push_back(reinterpret_cast<uintptr_t>(scriptHandle.get()));
+        Variant result;
+        if (methodSlot.nativeInvoker(objectPtr, functionParameters, functionParametersCount, &result))
+        {
+            if (!callMustReturn) return Variant(true);
+            if (result.get_type() == Variant::NIL) return Variant("RESULT::VOID");
+            return result;
+        }
     }
 
-    // Add Godot Parameters
+    // Validate Arguments Count [Extra Arguments Are Ignored]
     int parameterOffset = needsPassingOwner ? 1 : 0;
-    for (size_t i = 0; i < functionParametersCount; i++) resolvedParameters.push_back(RESOLVE_PARAMETER(i));
+    int marshalledParametersCount = int(methodSlot.parameterMarshals.size());
+    if (functionParametersCount < marshalledParametersCount) return Variant("ERROR::INVALID_ARGUMENTS_COUNT");
+    if (size_t(marshalledParametersCount + parameterOffset) > jenova::GlobalSettings::InterpreterMaxCallArguments) return Variant("ERROR::TOO_MANY_ARGUMENTS");
+
+    // Create Call Frame [Stack Storage Keeps Marshalling Scratch Private to Calling Thread]
+    uintptr_t resolvedParameters[jenova::GlobalSettings::InterpreterMaxCallArguments];
+    alignas(16) uint8_t argumentStorage[jenova::GlobalSettings::InterpreterMaxCallArguments][jenova::GlobalSettings::InterpreterMarshalStorageSize];
+    bool argumentConstructed[jenova::GlobalSettings::InterpreterMaxCallArguments] = { false };
+    alignas(16) uint8_t returnStorage[jenova::GlobalSettings::InterpreterMarshalStorageSize] = { 0 };
+
+    // Pass Owner
+    jenova::ScriptCaller scriptCaller(objectPtr);
+    if (needsPassingOwner) resolvedParameters[0] = reinterpret_cast<uintptr_t>(&scriptCaller);
 
-    // Calculate Final Size
-    int resolvedParametersCount = callHasParameters ? resolvedParameters.size() : 0;
+    // Marshal Godot Parameters Using Precomputed Type Tags
+    for (int i = 0; i < marshalledParametersCount; i++)
+    {
+        resolvedParameters[i + parameterOffset] = jenova::MarshalVariantArgument(functionParameters[i], methodSlot.parameterMarshals[i], argumentStorage[i], argumentConstructed[i]);
+    }
 
-    // Generate Code And Call Using Backends
+    // Generate Code And Call Using Backends [Callers Are Prepared At Load, Slots Are Never Written Here]
+    bool callSucceeded = false;
+    bool useCallerStub = interpreterBackend == jenova::InterpreterBackend::TinyCC;
     if (interpreterBackend == jenova::InterpreterBackend::AsmJIT)
     {
-        try
+        // Get Prepared Caller Thunk
+        typedef uintptr_t(*CallerThunk)(const uintptr_t* parameters, void* returnBuffer);
+        CallerThunk callerThunk = (CallerThunk)(methodSlot.callerThunk ? methodSlot.callerThunk : JenovaInterpreter::GetSlotCallerThunk(methodSlot));
+
+        // Call Thunk [Scalar Results Come Back In Register, Others In Return Storage]
+        if (callerThunk)
         {
-            // Create a JIT Runtime
-            asmjit::JitRuntime jitRuntime;
+            uintptr_t returnValue = callerThunk(resolvedParameters, returnStorage);
+            if (jenova::GetMarshalTypeOperations(methodSlot.returnTag).variantStorage == jenova::VariantStorage::Scalar) memcpy(returnStorage, &returnValue, sizeof(returnValue));
+            callSucceeded = true;
+        }
 
-            // Create Code Holder
-            asmjit::CodeHolder code;
-            code.init(jitRuntime.environment());
+        // Fall Back to Caller Stub For Signatures Thunk Does Not Lower [Aggregates Passed By Value]
+        if (!callerThunk) useCallerStub = true;
+    }
+    if (useCallerStub)
+    {
+        // Get Prepared Caller Stub
+        using MetaCallerType = void(*)(void* functionAddress, const uintptr_t* arguments, void* returnBuffer);
+        MetaCallerType interpreterCaller = (MetaCallerType)(methodSlot.callerStub ? methodSlot.callerStub : JenovaInterpreter::GetSlotCallerStub(methodSlot));
 
-            // Assembler to Emit Code
-            asmjit::x86::Assembler assembler(&code);
+        // Execute Caller Stub
+        if (interpreterCaller)
+        {
+            interpreterCaller((void*)functionAddress, resolvedParameters, returnStorage);
+            callSucceeded = true;
+        }
+        else jenova::Error("Interpreter Backend", "Failed to Get Interpreter JIT Caller.");
+    }
 
-            // Calculate Stack Size
-            int stackAlignmentSize = 0x38; int stackAdjusterSize = 0x08;
-            if (resolvedParametersCount > 4) stackAlignmentSize += (resolvedParametersCount - 4) * stackAdjusterSize;
+    // Destroy Converted Arguments [Callee Owns By-Value Arguments On Microsoft ABI]
+    for (int i = 0; i < marshalledParametersCount; i++)
+    {
+        if (!argumentConstructed[i]) continue;
+        const jenova::MarshalTypeOperations& typeOperations = jenova::GetMarshalTypeOperations(methodSlot.parameterMarshals[i].typeTag);
 
-            // Generate Assembly Caller Code
-            {
-                // Push Required Stack Size
-                assembler.sub(asmjit::x86::rsp, stackAlignmentSize);
+        // Writable Spans Wrote Into Detached Buffer, Assign It Back So Caller Observes Writes
+        if (callSucceeded && typeOperations.writesBack && functionParameters[i]->get_type() == typeOperations.variantType)
+        {
+            typeOperations.assignToVariant(*const_cast<Variant*>(functionParameters[i]), argumentStorage[i]);
+        }
+        if (calleeDestroysArguments && !methodSlot.parameterMarshals[i].passByReference && typeOperations.variantStorage != jenova::VariantStorage::View) continue;
+        typeOperations.destructor(argumentStorage[i]);
+    }
 
-                // Pushing Parameters
-                if (resolvedParametersCount > 0)
-                {
-                    // Microsoft Windows x64 Architecture
-                    if (QUERY_PLATFORM(Windows))
-                    {
-                        // Handle First 4 Parameters in Registers
-                        if (resolvedParametersCount > 0) assembler.mov(asmjit::x86::rcx, resolvedParameters[0]);
-                        if (resolvedParametersCount > 1) assembler.mov(asmjit::x86::rdx, resolvedParameters[1]);
-                        if (resolvedParametersCount > 2) assembler.mov(asmjit::x86::r8, resolvedParameters[2]);
-                        if (resolvedParametersCount > 3) assembler.mov(asmjit::x86::r9, resolvedParameters[3]);
-
-                        // Push Remaining Parameters Directly to Stack
-                        for (int i = 4; i < resolvedParametersCount; ++i)
-                        {
-                            int offset = 32 + ((i - 4) * stackAdjusterSize); // Offset starts at 32 bytes after the 4th parameter
-                            assembler.mov(asmjit::x86::qword_ptr(asmjit::x86::rsp, offset), resolvedParameters[i]);
-                        }
-                    }
+    // Construct Result In Place
+    if (callSucceeded)
+    {
+        if (!callMustReturn) return Variant(true);
+        Variant callResult;
+        if (!jenova::UnmarshalReturnValue(callResult, methodSlot.returnTag, returnStorage)) return Variant("ERROR::CALL_FAILED");
+        if (callResult.get_type() == Variant::NIL && interpreterBackend == jenova::InterpreterBackend::AsmJIT) return Variant("RESULT::VOID");
+        return callResult;
+    }
+    if (interpreterBackend == jenova::InterpreterBackend::AsmJIT) return Variant("ERROR::CALL_FAILED");
+    if (interpreterBackend == jenova::InterpreterBackend::TinyCC) return Variant(false);
+    if (interpreterBackend == jenova::InterpreterBackend::AkiraJIT)
+    {
+        // Removed
+    }
+    if (interpreterBackend == jenova::InterpreterBackend::SecureAngel)
+    {
+        // Removed
+    }
 
-                    // System V AMD64 ABI Architecture
-                    if (QUERY_PLATFORM(Linux))
-                    {
-                        // Handle First 6 Parameters in Registers
-                        if (resolvedParametersCount > 0) assembler.mov(asmjit::x86::rdi, resolvedParameters[0]);
-                        if (resolvedParametersCount > 1) assembler.mov(asmjit::x86::rsi, resolvedParameters[1]);
-                        if (resolvedParametersCount > 2) assembler.mov(asmjit::x86::rdx, resolvedParameters[2]);
-                        if (resolvedParametersCount > 3) assembler.mov(asmjit::x86::rcx, resolvedParameters[3]);
-                        if (resolvedParametersCount > 4) assembler.mov(asmjit::x86::r8, resolvedParameters[4]);
-                        if (resolvedParametersCount > 5) assembler.mov(asmjit::x86::r9, resolvedParameters[5]);
-
-                        // Push Remaining Parameters Directly to Stack
-                        for (int i = 6; i < resolvedParametersCount; ++i)
-                        {
-                            int offset = 32 + ((i - 6) * stackAdjusterSize); // Offset starts at 32 bytes after the 6th parameter
-                            assembler.mov(asmjit::x86::qword_ptr(asmjit::x86::rsp, offset), resolvedParameters[i]);
-                        }
-                    }
-                }
+    // No Valid Backend
+    return Variant("ERROR::INVALID_INTERPRETER_BACKEND");
+}
+bool JenovaInterpreter::CallFunctionPtr(const godot::Object* objectPtr, const jenova::ScriptMethodSlot& methodSlot, const GDExtensionConstTypePtr* functionParameters, GDExtensionTypePtr returnValue)
+{
+    // Validate Module
+    if (!allowExecution || !moduleHandle || !methodSlot.nativePtrInvoker) return false;
 
-                // Push Calling Address and Call
-                assembler.mov(asmjit::x86::rax, functionAddress);
-                assembler.call(asmjit::x86::rax);
+    // Enter Execution Epoch [Retired Module Images Are Released After Their Calls Leave]
+    ExecutionEpochScope epochScope;
+    if (methodSlot.dispatchGeneration != GetDispatchGeneration()) return false;
 
-                // Pop Required Stack Size And Return
-                assembler.add(asmjit::x86::rsp, stackAlignmentSize);
-                assembler.ret();
-            }
+    // Call Native Invoker [Arguments And Result Stay In Engine Encoding]
+    methodSlot.nativePtrInvoker(objectPtr, functionParameters, returnValue);
+    return true;
+}
+jenova::FunctionPointer JenovaInterpreter::GetCallerThunk(const std::string& thunkSignature, jenova::FunctionAddress functionAddress, const jenova::ParameterTypeList& argumentTypes, const std::string& returnType)
+{
+    // Lock Caller Caches
+    std::lock_guard<std::mutex> cacheLock(callerCacheMutex);
 
-            // Execution
-            if (callMustReturn)
-            {
-                // Typedef for the Generated Function
-                typedef Variant(*CallerFunction)();
+    // Return Cached Thunk If Exists
+    auto cachedThunk = callerThunkCache.find(thunkSignature);
+    if (cachedThunk != callerThunkCache.end()) return cachedThunk->second;
 
-                // Allocate and Run Generated Code
-                CallerFunction callerFunction = nullptr;
-                jitRuntime.add(&callerFunction, &code);
+    try
+    {
+        // Create Long-Lived JIT Runtime
+        if (!thunkRuntime) thunkRuntime = new asmjit::JitRuntime();
 
-                // Call the JIT-generated Function
-                Variant result = callerFunction();
+        // Create Code Holder
+        asmjit::CodeHolder code;
+        code.init(thunkRuntime->environment());
 
-                // Release Generated Code When Done
-                jitRuntime.release(callerFunction);
+        // Assembler to Emit Code
+        asmjit::x86::Assembler assembler(&code);
 
-                // Return the Result as a Variant
-                if (result.get_type() == Variant::NIL) return Variant("RESULT::VOID");
-                return result;
-            }
-            else
-            {
-                // Void Call
-                typedef void(*CallerFunction)();
-                CallerFunction callerFunction = nullptr;
-                jitRuntime.add(&callerFunction, &code);
-                callerFunction();
-                jitRuntime.release(callerFunction);
-                return Variant(true);
-            }
-        }
-        catch (const std::exception&)
-        {
-            // If Failed, Return False
-            return Variant("ERROR::CALL_FAILED");
-        }
-    }
-    if (interpreterBackend == jenova::InterpreterBackend::TinyCC)
-    {
-        // Create Pointer List
-        jenova::PointerList ptrList;
-        
-        // Generate Caller Code
-        std::string interpreterCallerCode;
-        interpreterCallerCode += jenova::Format("struct Variant { unsigned char opaque[%d]; };\n", GODOT_CPP_VARIANT_SIZE);
-        interpreterCallerCode += "typedef struct Variant Variant;\n";
-        interpreterCallerCode += "Variant* MakeVariant(void*, char*);\n";
-        interpreterCallerCode += "void* interpreter_call()\n";
-        interpreterCallerCode += "{\n";
-        interpreterCallerCode += "typedef " + jenova::ResolveReturnTypeForJIT(functionReturnType) + "(*function_t)(";
-        if (needsPassingOwner) interpreterCallerCode  += "void*";
-        for (size_t i = 0; i < functionParametersCount; i++)
+        // Resolve Return Kind
+        bool returnsInMemory = returnType == "Variant";
+
+        // Select Calling Convention (Microsoft x64 / System V AMD64)
+        std::vector<asmjit::x86::Gp> argumentRegisters;
+        std::vector<asmjit::x86::Xmm> floatArgumentRegisters;
+        int shadowSpaceSize = 0;
+        bool positionalRegisters = QUERY_PLATFORM(Windows);
+        if (positionalRegisters)
         {
-            if (i == 0 && needsPassingOwner) interpreterCallerCode += ",";
-            interpreterCallerCode += jenova::ResolveVariantTypeAsString(functionParameters[i]);
-            if (i != functionParametersCount - 1) interpreterCallerCode += ",";
+            argumentRegisters = { asmjit::x86::rcx, asmjit::x86::rdx, asmjit::x86::r8, asmjit::x86::r9 };
+            floatArgumentRegisters = { asmjit::x86::xmm0, asmjit::x86::xmm1, asmjit::x86::xmm2, asmjit::x86::xmm3 };
+            shadowSpaceSize = 0x20;
         }
-        interpreterCallerCode += ");\n";
-        interpreterCallerCode += jenova::Format("function_t _func = (function_t)0x%llx;\n", functionAddress);
-        if (callMustReturn) interpreterCallerCode += jenova::ResolveReturnTypeForJIT(functionReturnType) + " result = ";
-        interpreterCallerCode += "_func(";
-        if (needsPassingOwner) interpreterCallerCode += jenova::Format("(void*)0x%llx", resolvedParameters[0]);
-        for (size_t i = 0; i < functionParametersCount; i++)
+        else
         {
-            if (i == 0 && needsPassingOwner) interpreterCallerCode += ",";
-            interpreterCallerCode += jenova::ResolveVariantValueAsString(functionParameters[i], ptrList);
-            if (i != functionParametersCount - 1) interpreterCallerCode += ",";
+            argumentRegisters = { asmjit::x86::rdi, asmjit::x86::rsi, asmjit::x86::rdx, asmjit::x86::rcx, asmjit::x86::r8, asmjit::x86::r9 };
+            floatArgumentRegisters = { asmjit::x86::xmm0, asmjit::x86::xmm1, asmjit::x86::xmm2, asmjit::x86::xmm3, asmjit::x86::xmm4, asmjit::x86::xmm5, asmjit::x86::xmm6, asmjit::x86::xmm7 };
+            shadowSpaceSize = 0x00;
         }
-        interpreterCallerCode += ");\n";
-        if (callMustReturn) interpreterCallerCode += "return MakeVariant(&result,\"" + functionReturnType + "\");\n";
-        else interpreterCallerCode += "return 0;\n";
-        interpreterCallerCode += "}";
-
-        // Initialize TCC Compiler
-        TCCState* tcc = tcc_new();
-        if (!tcc) 
+
+        // Assign Argument Slots [Microsoft Uses Slot Position For Both Classes, System V Counts Each Class Separately]
+        struct ThunkArgument { int parameterOffset = -1; int registerIndex = -1; int stackOffset = -1; bool isFloat = false; bool isDouble = false; };
+        std::vector<ThunkArgument> thunkArguments;
+        int hiddenArgumentCount = returnsInMemory ? 1 : 0;
+        int usedIntegerRegisters = 0, usedFloatRegisters = 0, stackArgumentCount = 0;
+        for (int i = 0; i < int(argumentTypes.size()) + hiddenArgumentCount; i++)
         {
-            jenova::Error("Interpreter Backend", "Failed to Initialize JIT Interpreter.");
-            return Variant(false);
+            ThunkArgument thunkArgument;
+            if (i >= hiddenArgumentCount)
+            {
+                thunkArgument.parameterOffset = (i - hiddenArgumentCount) * 0x08;
+                thunkArgument.isFloat = argumentTypes[i - hiddenArgumentCount] == "float";
+                thunkArgument.isDouble = argumentTypes[i - hiddenArgumentCount] == "double";
+            }
+            bool inFloatRegister = thunkArgument.isFloat || thunkArgument.isDouble;
+            int& usedRegisters = positionalRegisters ? usedIntegerRegisters : (inFloatRegister ? usedFloatRegisters : usedIntegerRegisters);
+            size_t availableRegisters = inFloatRegister ? floatArgumentRegisters.size() : argumentRegisters.size();
+            if (size_t(usedRegisters) < availableRegisters) thunkArgument.registerIndex = usedRegisters++;
+            else thunkArgument.stackOffset = shadowSpaceSize + (stackArgumentCount++ * 0x08);
+            thunkArguments.push_back(thunkArgument);
         }
 
-        // Create Error/Warning Reporter 
-        if (jenova::GlobalStorage::DeveloperModeActivated)
+        // Calculate Stack Size (Keep 16 Bytes Alignment At Call Site)
+        int stackAlignmentSize = shadowSpaceSize + (stackArgumentCount * 0x08);
+        if (stackAlignmentSize % 0x10 == 0) stackAlignmentSize += 0x08;
+
+        // Generate Assembly Thunk Code : uintptr_t thunk(const uintptr_t* parameters, void* returnBuffer)
         {
-            jenova::VerboseByID(__LINE__, "JIT Execution Code : \n%s", interpreterCallerCode.c_str());
-            auto tcc_error_handler = [](void* opaque, const char* msg) -> void
+            // Keep Parameters Array And Return Buffer In Scratch Registers
+            assembler.mov(asmjit::x86::r10, argumentRegisters[0]);
+            assembler.mov(asmjit::x86::r11, argumentRegisters[1]);
+
+            // Push Required Stack Size
+            assembler.sub(asmjit::x86::rsp, stackAlignmentSize);
+
+            // Push Remaining Parameters Directly to Stack
+            for (const ThunkArgument& thunkArgument : thunkArguments)
+            {
+                if (thunkArgument.stackOffset == -1) continue;
+                if (thunkArgument.parameterOffset == -1) assembler.mov(asmjit::x86::rax, asmjit::x86::r11);
+                else assembler.mov(asmjit::x86::rax, asmjit::x86::qword_ptr(asmjit::x86::r10, thunkArgument.parameterOffset));
+                assembler.mov(asmjit::x86::qword_ptr(asmjit::x86::rsp, thunkArgument.stackOffset), asmjit::x86::rax);
+            }
+
+            // Load Register Parameters From Array [Floating Point Values Go to XMM Registers]
+            for (const ThunkArgument& thunkArgument : thunkArguments)
             {
-                jenova::Error("Interpreter Backend", "%s", msg);
-            };
-            tcc_set_error_func(tcc, nullptr, tcc_error_handler);
+                if (thunkArgument.registerIndex == -1) continue;
+                if (thunkArgument.parameterOffset == -1) assembler.mov(argumentRegisters[thunkArgument.registerIndex], asmjit::x86::r11);
+                else if (thunkArgument.isFloat) assembler.movss(floatArgumentRegisters[thunkArgument.registerIndex], asmjit::x86::dword_ptr(asmjit::x86::r10, thunkArgument.parameterOffset));
+                else if (thunkArgument.isDouble) assembler.movsd(floatArgumentRegisters[thunkArgument.registerIndex], asmjit::x86::qword_ptr(asmjit::x86::r10, thunkArgument.parameterOffset));
+                else assembler.mov(argumentRegisters[thunkArgument.registerIndex], asmjit::x86::qword_ptr(asmjit::x86::r10, thunkArgument.parameterOffset));
+            }
+
+            // Push Calling Address and Call
+            assembler.mov(asmjit::x86::rax, functionAddress);
+            assembler.call(asmjit::x86::rax);
+
+            // Normalize Returned Value [Floating Point Results Come Back In XMM0]
+            if (returnType == "double") assembler.movq(asmjit::x86::rax, asmjit::x86::xmm0);
+            if (returnType == "float") assembler.movd(asmjit::x86::eax, asmjit::x86::xmm0);
+            if (returnType == "int") assembler.movsxd(asmjit::x86::rax, asmjit::x86::eax);
+
+            // Pop Required Stack Size And Return
+            assembler.add(asmjit::x86::rsp, stackAlignmentSize);
+            assembler.ret();
         }
 
-        // Configure TCC Compiler
-        tcc_set_output_type(tcc, TCC_OUTPUT_MEMORY);
-        tcc_set_options(tcc, "-nostdlib");
+        // Allocate Generated Thunk
+        jenova::FunctionPointer callerThunk = nullptr;
+        if (thunkRuntime->add(&callerThunk, &code) != asmjit::kErrorOk) return nullptr;
+
+        // Add Thunk to Cache
+        callerThunkCache[thunkSignature] = callerThunk;
+        return callerThunk;
+    }
+    catch (const std::exception&)
+    {
+        return nullptr;
+    }
+}
+jenova::FunctionPointer JenovaInterpreter::GetCallerStub(const std::string& returnType, const jenova::ParameterTypeList& argumentTypes)
+{
+    // Create Stub Signature
+    std::string stubSignature = returnType + "(";
+    for (size_t i = 0; i < argumentTypes.size(); i++)
+    {
+        if (i != 0) stubSignature += ",";
+        stubSignature += argumentTypes[i];
+    }
+    stubSignature += ")";
+
+    // Lock Caller Caches
+    std::lock_guard<std::mutex> cacheLock(callerCacheMutex);
+
+    // Return Cached Stub If Exists
+    auto cachedStub = callerStubCache.find(stubSignature);
+    if (cachedStub != callerStubCache.end()) return cachedStub->second;
+
+    // Generate Parameterised Caller Code
+    bool stubMustReturn = returnType != "void";
+    std::string interpreterCallerCode;
+    interpreterCallerCode += jenova::Format("struct Variant { unsigned char opaque[%d]; };\n", int(jenova::GlobalSettings::InterpreterMarshalStorageSize));
+    interpreterCallerCode += "typedef struct Variant Variant;\n";
+
+    // Declare Aggregates Passed By Value With Their Layout [Compiler Splits Members Across Registers Per ABI]
+    auto declareValueType = [&interpreterCallerCode](const std::string& typeName, const std::string& valueTypeName) -> std::string
+    {
+        if (typeName.rfind("struct{", 0) != 0) return typeName;
+        interpreterCallerCode += "struct " + valueTypeName + typeName.substr(6) + ";\n";
+        return "struct " + valueTypeName;
+    };
+    std::string callReturnType = declareValueType(returnType, "value_return");
+    jenova::ParameterTypeList callArgumentTypes;
+    for (size_t i = 0; i < argumentTypes.size(); i++) callArgumentTypes.push_back(declareValueType(argumentTypes[i], jenova::Format("value_arg_%d", int(i))));
+
+    interpreterCallerCode += "void interpreter_call(void* address, unsigned long long* args, void* returnBuffer)\n";
+    interpreterCallerCode += "{\n";
+    interpreterCallerCode += "typedef " + callReturnType + "(*function_t)(";
+    for (size_t i = 0; i < callArgumentTypes.size(); i++)
+    {
+        if (i != 0) interpreterCallerCode += ",";
+        interpreterCallerCode += callArgumentTypes[i];
+    }
+    interpreterCallerCode += ");\n";
+    if (stubMustReturn) interpreterCallerCode += "*(" + callReturnType + "*)returnBuffer = ";
+    interpreterCallerCode += "((function_t)address)(";
+    for (size_t i = 0; i < callArgumentTypes.size(); i++)
+    {
+        if (i != 0) interpreterCallerCode += ",";
+        if (callArgumentTypes[i] != argumentTypes[i]) interpreterCallerCode += jenova::Format("*(%s*)args[%d]", callArgumentTypes[i].c_str(), int(i));
+        else interpreterCallerCode += jenova::Format("*(%s*)&args[%d]", callArgumentTypes[i].c_str(), int(i));
+    }
+    interpreterCallerCode += ");\n";
+    interpreterCallerCode += "}";
 
-        // Add Symbols
-        tcc_add_symbol(tcc, "memmove", reinterpret_cast<const void*>(&jenova::RelocateMemory));
-        tcc_add_symbol(tcc, "MakeVariant", reinterpret_cast<const void*>(&jenova::MakeVariantFromReturnType));
+    // Initialize TCC Compiler
+    TCCState* tcc = tcc_new();
+    if (!tcc)
+    {
+        jenova::Error("Interpreter Backend", "Failed to Initialize JIT Interpreter.");
+        return nullptr;
+    }
 
-        // Compile Generated Code
-        if (tcc_compile_string(tcc, interpreterCallerCode.c_str()) == -1) 
+    // Create Error/Warning Reporter 
+    if (jenova::GlobalStorage::DeveloperModeActivated)
+    {
+        jenova::VerboseByID(__LINE__, "JIT Caller Stub Code [%s] : \n%s", stubSignature.c_str(), interpreterCallerCode.c_str());
+        auto tcc_error_handler = [](void* opaque, const char* msg) -> void
         {
-            jenova::Error("Interpreter Backend", "Failed to Compile Interpreter Code.");
-            for (void* ptr : ptrList) if (ptr) delete ptr;
-            tcc_delete(tcc);
-            return Variant(false);
-        }
+            jenova::Error("Interpreter Backend", "%s", msg);
+        };
+        tcc_set_error_func(tcc, nullptr, tcc_error_handler);
+    }
 
-        // Prepare For Execution
-        if (tcc_relocate(tcc, TCC_RELOCATE_AUTO) < 0) {
-            jenova::Error("Interpreter Backend", "Failed to Resolve Interpreter Code.");
-            for (void* ptr : ptrList) if (ptr) delete ptr;
-            tcc_delete(tcc);
-            return Variant(false);
-        }
+    // Configure TCC Compiler
+    tcc_set_output_type(tcc, TCC_OUTPUT_MEMORY);
+    tcc_set_options(tcc, "-nostdlib");
 
-        // Get Compiled Caller Function
-        using MetaCallerType = Variant*(*)();
-        MetaCallerType interpreterCaller = (MetaCallerType)tcc_get_symbol(tcc, "interpreter_call");
-        if (!interpreterCaller) 
-        {
-            jenova::Error("Interpreter Backend", "Failed to Get Interpreter JIT Caller.");
-            for (void* ptr : ptrList) if (ptr) delete ptr;
-            tcc_delete(tcc);
-            return Variant(false);
-        }
+    // Add Symbols
+    tcc_add_symbol(tcc, "memmove", reinterpret_cast<const void*>(&jenova::RelocateMemory));
 
-        // Execute Caller
-        Variant* result = interpreterCaller();
+    // Compile Generated Code
+    if (tcc_compile_string(tcc, interpreterCallerCode.c_str()) == -1)
+    {
+        jenova::Error("Interpreter Backend", "Failed to Compile Interpreter Code.");
+        tcc_delete(tcc);
+        return nullptr;
+    }
 
-        // Release Allocated Values
-        for (void* ptr : ptrList) if (ptr) delete ptr;
-        ptrList.clear();
+    // Prepare For Execution
+    if (tcc_relocate(tcc, TCC_RELOCATE_AUTO) < 0)
+    {
+        jenova::Error("Interpreter Backend", "Failed to Resolve Interpreter Code.");
+        tcc_delete(tcc);
+        return nullptr;
+    }
 
-        // Clean up
+    // Get Compiled Caller Function
+    jenova::FunctionPointer callerStub = tcc_get_symbol(tcc, "interpreter_call");
+    if (!callerStub)
+    {
         tcc_delete(tcc);
+        return nullptr;
+    }
+
+    // Add Stub to Cache, Compiler State Is Kept Alive Until Stubs Are Released
+    callerStubStates.push_back(tcc);
+    callerStubCache[stubSignature] = callerStub;
+    return callerStub;
+}
+jenova::FunctionPointer JenovaInterpreter::GetSlotCallerThunk(const jenova::ScriptMethodSlot& methodSlot)
+{
+    // Validate Function Address
+    if (!methodSlot.functionAddress) return nullptr;
 
-        // Process Result
-        if (callMustReturn)
+    // Aggregates Passed By Value Are Split Across Registers By Layout, Leave Them to Caller Stub
+    if (jenova::GetMarshalTypeOperations(methodSlot.returnTag).valueLayout) return nullptr;
+
+    // Thunk Passes Every Declared Parameter Including Caller
+    jenova::ParameterTypeList argumentTypes;
+    if (methodSlot.hasParameters)
+    {
+        if (methodSlot.passesCaller) argumentTypes.push_back("void*");
+        for (const jenova::ParameterMarshal& parameterMarshal : methodSlot.parameterMarshals)
         {
-            if (result)
-            {
-                Variant finalResult(*result);
-                delete result;
-                return finalResult;
-            }
+            const jenova::MarshalTypeOperations& typeOperations = jenova::GetMarshalTypeOperations(parameterMarshal.typeTag);
+            if (!parameterMarshal.passByReference && typeOperations.valueLayout) return nullptr;
+            argumentTypes.push_back(typeOperations.callerType);
         }
-        return Variant(true);
     }
-    if (interpreterBackend == jenova::InterpreterBackend::AkiraJIT)
+    size_t parametersCount = argumentTypes.size();
+
+    // Thunk Embeds Function Address So It's Keyed And Owned Per Module Image
+    jenova::ModuleAddress ownerModuleAddress = methodSlot.functionAddress - methodSlot.functionOffset;
+    std::string thunkSignature = methodSlot.thunkSignature + jenova::Format("#%d@%llx", int(parametersCount), (unsigned long long)ownerModuleAddress);
+    jenova::FunctionPointer callerThunk = JenovaInterpreter::GetCallerThunk(thunkSignature, methodSlot.functionAddress, argumentTypes, jenova::ResolveReturnTypeForJIT(methodSlot.returnTypeName));
+    if (callerThunk)
     {
-        // Removed
+        std::lock_guard<std::mutex> cacheLock(callerCacheMutex);
+        callerThunkOwners[thunkSignature] = (void*)ownerModuleAddress;
     }
-    if (interpreterBackend == jenova::InterpreterBackend::SecureAngel)
+    return callerThunk;
+}
+jenova::FunctionPointer JenovaInterpreter::GetSlotCallerStub(const jenova::ScriptMethodSlot& methodSlot)
+{
+    // Stub Signature Uses Marshalled Caller Types [Aggregates Passed By Value Carry Their Layout]
+    jenova::ParameterTypeList argumentTypes;
+    if (methodSlot.passesCaller) argumentTypes.push_back("void*");
+    for (const jenova::ParameterMarshal& parameterMarshal : methodSlot.parameterMarshals)
     {
-        // Removed
+        const jenova::MarshalTypeOperations& typeOperations = jenova::GetMarshalTypeOperations(parameterMarshal.typeTag);
+        if (!parameterMarshal.passByReference && typeOperations.valueLayout) argumentTypes.push_back(std::string("struct{") + typeOperations.valueLayout + "}");
+        else argumentTypes.push_back(typeOperations.callerType);
     }
+    const char* returnLayout = jenova::GetMarshalTypeOperations(methodSlot.returnTag).valueLayout;
+    return JenovaInterpreter::GetCallerStub(returnLayout ? std::string("struct{") + returnLayout + "}" : jenova::ResolveReturnTypeForJIT(methodSlot.returnTypeName), argumentTypes);
+}
+bool JenovaInterpreter::ReleaseCallerThunks()
+{
+    // Lock Caller Caches
+    std::lock_guard<std::mutex> cacheLock(callerCacheMutex);
 
-    // No Valid Backend
-    return Variant("ERROR::INVALID_INTERPRETER_BACKEND");
+    // Release Generated Thunks
+    if (thunkRuntime) for (const auto& callerThunk : callerThunkCache) thunkRuntime->release(callerThunk.second);
+    callerThunkCache.clear();
+    callerThunkOwners.clear();
+
+    // Release Compiled Stubs
+    for (void* stubState : callerStubStates) if (stubState) tcc_delete((TCCState*)stubState);
+    callerStubStates.clear();
+    callerStubCache.clear();
+
+    // All Good
+    return true;
+}
+void JenovaInterpreter::ReleaseModuleCallerThunks(jenova::ModuleAddress moduleBaseAddress)
+{
+    // Lock Caller Caches
+    std::lock_guard<std::mutex> cacheLock(callerCacheMutex);
+
+    // Release Thunks Calling Into Module Image [Stubs Take Address Per Call And Stay Shared]
+    for (auto callerThunkOwner = callerThunkOwners.begin(); callerThunkOwner != callerThunkOwners.end();)
+    {
+        if (callerThunkOwner->second != (void*)moduleBaseAddress)
+        {
+            callerThunkOwner++;
+            continue;
+        }
+        auto cachedThunk = callerThunkCache.find(callerThunkOwner->first);
+        if (cachedThunk != callerThunkCache.end())
+        {
+            if (thunkRuntime) thunkRuntime->release(cachedThunk->second);
+            callerThunkCache.erase(cachedThunk);
+        }
+        callerThunkOwner = callerThunkOwners.erase(callerThunkOwner);
+    }
 }
 void JenovaInterpreter::SetExecutionState(bool executionState)
 {
@@ -1113,6 +1864,9 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                 }
             }
 
+            // Add Native Class Definitions
+            AddNativeClassMetadata(serializer, scriptModules);
+
             // Add Extra Info
             if (buildResult.hasDebugInformation)
             {
@@ -1125,6 +1879,7 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
             }
             serializer["ModuleBinarySize"] = buildResult.builtModuleData.size();
             serializer["InterpreterBackend"] = JenovaInterpreter::GetInterpreterBackend();
+            serializer["CompilerModel"] = buildResult.compilerModel;
             serializer["DeveloperMode"] = jenova::GlobalStorage::DeveloperModeActivated;
             serializer["ManagedSafeExecution"] = jenova::GlobalStorage::UseManagedSafeExecution;
 
@@ -1291,6 +2046,9 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                 }
             }
 
+            // Add Native Class Definitions
+            AddNativeClassMetadata(serializer, scriptModules);
+
             // Add Extra Info
             if (buildResult.hasDebugInformation)
             {
@@ -1303,6 +2061,7 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
             }
             serializer["ModuleBinarySize"] = buildResult.builtModuleData.size();
             serializer["InterpreterBackend"] = JenovaInterpreter::GetInterpreterBackend();
+            serializer["CompilerModel"] = buildResult.compilerModel;
             serializer["DeveloperMode"] = jenova::GlobalStorage::DeveloperModeActivated;
             serializer["ManagedSafeExecution"] = jenova::GlobalStorage::UseManagedSafeExecution;
 
@@ -1474,6 +2233,9 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                 }
             }
 
+            // Add Native Class Definitions
+            AddNativeClassMetadata(serializer, scriptModules);
+
             // Add Extra Info
             if (buildResult.hasDebugInformation)
             {
@@ -1486,6 +2248,7 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
             }
             serializer["ModuleBinarySize"] = buildResult.builtModuleData.size();
             serializer["InterpreterBackend"] = JenovaInterpreter::GetInterpreterBackend();
+            serializer["CompilerModel"] = buildResult.compilerModel;
             serializer["DeveloperMode"] = jenova::GlobalStorage::DeveloperModeActivated;
 
             // Dump Metadata If Developer Mode Activated
@@ -1508,44 +2271,52 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
 	// Generation Failed, Return Empty Data
 	return jenova::SerializedData();
 }
-bool JenovaInterpreter::UpdateConfigurationsFromMetaData(const jenova::SerializedData& metaData)
+bool JenovaInterpreter::UpdateConfigurationsFromMetaData(jenova::ModuleImage& moduleImage, const jenova::SerializedData& metaData)
 {
     try
     {
-        // Parse and Set Interpreter Metadata
-        moduleMetaData = jenova::json_t::parse(metaData);
+        // Parse and Set Module Metadata
+        moduleImage.moduleMetaData = jenova::json_t::parse(metaData);
+        const jenova::json_t& imageMetaData = moduleImage.moduleMetaData;
 
         // Set Interpreter Backend
-        if (moduleMetaData.contains("InterpreterBackend"))
+        moduleImage.interpreterBackend = interpreterBackend;
+        if (imageMetaData.contains("InterpreterBackend"))
         {
-            SetInterpreterBackend(moduleMetaData["InterpreterBackend"].get<jenova::InterpreterBackend>());
+            moduleImage.interpreterBackend = imageMetaData["InterpreterBackend"].get<jenova::InterpreterBackend>();
         }
 
         // Set Has Debug Information If Present
-        if (moduleMetaData["HasDebugInformation"].get<bool>() == true)
+        if (imageMetaData["HasDebugInformation"].get<bool>() == true)
         {
-            hasDebugInformation = true;
-            moduleDiskPath = std::filesystem::absolute(moduleMetaData["BuildPath"].get<std::string>()).string();
+            moduleImage.hasDebugInformation = true;
+            moduleImage.moduleDiskPath = std::filesystem::absolute(imageMetaData["BuildPath"].get<std::string>()).string();
         }
 
-        // Set Debug Mode If Present
-        if (moduleMetaData.contains("DebugMode"))
+        // Set Argument Ownership From Compiler ABI
+        moduleImage.calleeDestroysArguments = false;
+        if (imageMetaData.contains("CompilerModel"))
         {
-            if (moduleMetaData["DebugMode"].get<bool>() == true)
-            {
-                executeInDebugMode = true;
-            }
+            #ifdef TARGET_PLATFORM_WINDOWS
+            jenova::CompilerModel compilerModel = imageMetaData["CompilerModel"].get<jenova::CompilerModel>();
+            moduleImage.calleeDestroysArguments = compilerModel == jenova::CompilerModel::MicrosoftCompiler || compilerModel == jenova::CompilerModel::ClangLLVMCompiler;
+            #endif
         }
 
-        // Update Global Storage From Metadata
-        if (!QUERY_ENGINE_MODE(Editor))
+        // Set Debug Mode If Present
+        if (imageMetaData.contains("DebugMode"))
         {
-            if (moduleMetaData.contains("DeveloperMode")) jenova::GlobalStorage::DeveloperModeActivated = moduleMetaData["DeveloperMode"].get<bool>();
-            if (moduleMetaData.contains("ManagedSafeExecution")) jenova::GlobalStorage::UseManagedSafeExecution = moduleMetaData["ManagedSafeExecution"].get<bool>();
+            if (imageMetaData["DebugMode"].get<bool>() == true)
+            {
+                moduleImage.executeInDebugMode = true;
+            }
         }
 
         // Update Module Binary Size
-        moduleBinarySize = moduleMetaData["ModuleBinarySize"].get<size_t>();
+        moduleImage.moduleBinarySize = imageMetaData["ModuleBinarySize"].get<size_t>();
+
+        // Build Dispatch Table
+        if (!JenovaInterpreter::UpdateDispatchTableFromMetaData(moduleImage)) return false;
 
         // All Good
         return true;
@@ -1556,70 +2327,491 @@ bool JenovaInterpreter::UpdateConfigurationsFromMetaData(const jenova::Serialize
         return false;
     }
 }
-bool JenovaInterpreter::UpdatePropertyStorageFromMetaData()
+bool JenovaInterpreter::UpdatePropertyStorageFromMetaData(jenova::ModuleImage& moduleImage)
 {
     // Clean Storage
-    propertyStorage.clear();
+    jenova::PropertyLayoutStorage& imageLayouts = moduleImage.propertyLayouts;
+    imageLayouts.clear();
 
     // Update Property Storage
     try
     {
         // Get Scripts
-        jenova::json_t moduleScripts = moduleMetaData["Scripts"];
+        jenova::json_t moduleScripts = moduleImage.moduleMetaData["Scripts"];
 
         // Extract Properties from Metadata
         for (const auto& moduleScript : moduleScripts.items())
         {
             std::string scriptUID = moduleScript.key();
+            if (!moduleScript.value().contains("database")) continue;
+            if (!moduleScript.value()["database"].contains("properties")) continue;
+
+            // Create Script Property Layout
+            std::shared_ptr<jenova::ScriptPropertyLayout> propertyLayout = std::make_shared<jenova::ScriptPropertyLayout>();
+            propertyLayout->scriptUID = scriptUID;
+            propertyLayout->moduleBaseAddress = moduleImage.moduleBaseAddress;
+
+            // Materialize Property Container Once Per Module Load
+            const jenova::json_t& propertyDatabase = moduleScript.value()["database"]["properties"];
+            jenova::ScriptPropertyContainer& propertyContainer = propertyLayout->propertyContainer;
+            propertyContainer = jenova::CreatePropertyContainerFromMetadata(propertyDatabase.dump(), scriptUID);
+            if (propertyContainer.scriptProperties.size() != int64_t(propertyDatabase.size()))
+            {
+                jenova::Error("Jenova Interpreter", "Failed to Create Property Container From Script %s", scriptUID.c_str());
+                return false;
+            }
 
-            if (moduleScript.value().contains("database"))
+            for (uint32_t pid = 0; pid < uint32_t(propertyDatabase.size()); pid++)
             {
-                if (moduleScript.value()["database"].contains("properties"))
+                // Get Property Metadata
+                const jenova::json_t& scriptProperty = propertyDatabase[pid];
+                const jenova::ScriptProperty& containerProperty = propertyContainer.scriptProperties[pid];
+                std::string propertyName = scriptProperty["PropertyName"].get<std::string>();
+
+                // Create Property Slot
+                jenova::ScriptPropertySlot propertySlot;
+                propertySlot.propertyName = containerProperty.propertyInfo.name;
+                propertySlot.propertyTypeName = scriptProperty["PropertyType"].get<std::string>();
+                propertySlot.propertyType = containerProperty.propertyInfo.type;
+                propertySlot.typeOperations = jenova::GetVariantBasedPropertyOperations(propertySlot.propertyTypeName);
+                propertySlot.defaultValue = containerProperty.defaultValue;
+
+                // Convert Parsed Default To Declared Type Once [Writes Reject Mismatching Variant Types]
+                Variant::Type slotVariantType = propertySlot.typeOperations->variantType;
+                if (slotVariantType != Variant::OBJECT && propertySlot.defaultValue.get_type() != Variant::NIL && propertySlot.defaultValue.get_type() != slotVariantType)
                 {
-                    for (const auto& scriptProperty : moduleScript.value()["database"]["properties"])
-                    {
-                        // Get Property Name
-                        std::string propertyName = scriptProperty["PropertyName"].get<std::string>();
+                    propertySlot.defaultValue = UtilityFunctions::type_convert(propertySlot.defaultValue, slotVariantType);
+                }
+
+                // Resolve Property Address
+                const jenova::json_t& scriptProperties = moduleScript.value()["properties"];
+                if (!scriptProperties.contains(propertyName) || !scriptProperties[propertyName].contains("Offset"))
+                {
+                    jenova::Error("Jenova Interpreter", "Failed to Resolve Property %s Address From Script %s", propertyName.c_str(), scriptUID.c_str());
+                    return false;
+                }
+                propertySlot.propertyOffset = scriptProperties[propertyName]["Offset"].get<jenova::PropertyAddress>();
+
+                // Reserve Property Storage Inside Instance Block
+                size_t propertyAlignment = alignof(std::max_align_t);
+                propertySlot.storageOffset = (propertyLayout->blockSize + propertyAlignment - 1) & ~(propertyAlignment - 1);
+                propertyLayout->blockSize = propertySlot.storageOffset + propertySlot.typeOperations->typeSize;
+
+                // Add Property Slot
+                propertyContainer.propertyIndices.insert(propertySlot.propertyName, pid);
+                propertyLayout->propertySlots.push_back(propertySlot);
+
+                // Prebuild Property Information [Points to Container Owned Names]
+                GDExtensionPropertyInfo propertyInfo = {};
+                propertyInfo.type = GDExtensionVariantType(containerProperty.propertyInfo.type);
+                propertyInfo.name = (GDExtensionStringNamePtr)&containerProperty.propertyInfo.name;
+                propertyInfo.class_name = (GDExtensionStringNamePtr)&containerProperty.propertyInfo.class_name;
+                propertyInfo.hint_string = (GDExtensionStringPtr)&containerProperty.propertyInfo.hint_string;
+                propertyInfo.hint = containerProperty.propertyInfo.hint;
+                propertyInfo.usage = containerProperty.propertyInfo.usage;
+                propertyContainer.propertyListInfo.push_back(propertyInfo);
+
+                // Verbose
+                jenova::VerboseByID(__LINE__, "Allocating Script [%s] Property [%s]", scriptUID.c_str(), propertyName.c_str());
+            }
+
+            // Align Block Size So Arena Blocks Stay Aligned
+            propertyLayout->blockSize = (propertyLayout->blockSize + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+            // Prebuild Default Property Image [New Blocks Are Copied From It]
+            if (propertyLayout->blockSize != 0)
+            {
+                propertyLayout->defaultImage = static_cast<uint8_t*>(std::malloc(propertyLayout->blockSize));
+                if (!propertyLayout->defaultImage)
+                {
+                    jenova::Error("Jenova Interpreter", "Failed to Allocate Default Property Image For Script %s", scriptUID.c_str());
+                    return false;
+                }
+                std::memset(propertyLayout->defaultImage, 0, propertyLayout->blockSize);
+                for (const jenova::ScriptPropertySlot& propertySlot : propertyLayout->propertySlots)
+                {
+                    void* propertyStorage = propertyLayout->defaultImage + propertySlot.storageOffset;
+                    propertySlot.typeOperations->constructor(propertyStorage);
+                    WritePropertySlotValue(propertySlot, propertyStorage, propertySlot.defaultValue);
+                }
+            }
+
+            // Add Property Layout
+            imageLayouts[scriptUID] = propertyLayout;
+        }
+
+        // All Good
+        return true;
+    }
+    catch (const std::exception& err)
+    {
+        imageLayouts.clear();
+        jenova::Error("Jenova Interpreter", "Failed to Parse Metadata, Parser Error : %s", err.what());
+        return false;
+    }
+}
+bool JenovaInterpreter::UpdateDispatchTableFromMetaData(jenova::ModuleImage& moduleImage)
+{
+    // Build New Snapshot Aside [Readers Keep Using Previous Snapshot Until Image Is Activated]
+    std::shared_ptr<jenova::DispatchSnapshot> newSnapshot = std::make_shared<jenova::DispatchSnapshot>();
+    moduleImage.dispatchSnapshot = newSnapshot;
+
+    try
+    {
+        // Check If Module Has Scripts
+        if (!moduleImage.moduleMetaData.contains("Scripts")) return true;
+
+        // Create Dispatch Entry For Each Script
+        for (const auto& moduleScript : moduleImage.moduleMetaData["Scripts"].items())
+        {
+            jenova::ScriptDispatchEntry dispatchEntry;
+            dispatchEntry.scriptUID = moduleScript.key();
 
-                        // Allocate Property
-                        void* propertyPtr = jenova::AllocateVariantBasedProperty(scriptProperty["PropertyType"].get<std::string>());
+            // Create Method Slots
+            if (moduleScript.value().contains("methods"))
+            {
+                for (const auto& scriptMethod : moduleScript.value()["methods"].items())
+                {
+                    jenova::ScriptMethodSlot methodSlot;
+                    methodSlot.functionName = scriptMethod.key();
+                    methodSlot.methodName = StringName(methodSlot.functionName.c_str());
+                    methodSlot.ownerScriptUID = dispatchEntry.scriptUID;
+                    methodSlot.functionOffset = scriptMethod.value()["Offset"].get<jenova::FunctionAddress>();
+
+                    // Resolve Return Type
+                    methodSlot.returnTypeName = scriptMethod.value()["ReturnType"].get<std::string>();
+                    methodSlot.returnType = jenova::GetVariantTypeFromStdString(methodSlot.returnTypeName);
+                    methodSlot.mustReturn = JenovaInterpreter::IsFunctionReturnable(methodSlot.returnTypeName);
+
+                    // Resolve Parameter Types
+                    int paramCount = scriptMethod.value()["ParamCount"].get<int>();
+                    for (int i = 1; i <= paramCount; ++i) methodSlot.parameterTypeNames.push_back(scriptMethod.value()[jenova::Format("Param%02d", i)].get<std::string>());
+                    methodSlot.hasParameters = !methodSlot.parameterTypeNames.empty() && !(methodSlot.parameterTypeNames.size() == 1 && methodSlot.parameterTypeNames[0] == "void");
+                    methodSlot.passesCaller = !methodSlot.parameterTypeNames.empty() && methodSlot.parameterTypeNames[0] == "jenova::sdk::Caller*";
+                    for (size_t pid = methodSlot.passesCaller ? 1 : 0; pid < methodSlot.parameterTypeNames.size(); pid++)
+                    {
+                        Variant::Type paramType = jenova::GetVariantTypeFromStdString(methodSlot.parameterTypeNames[pid]);
+                        if (paramType != Variant::NIL) methodSlot.parameterTypes.push_back(paramType);
+                    }
 
-                        // Validate Property Pointer
-                        if (!propertyPtr)
+                    // Precompute Marshal Type Tags
+                    methodSlot.returnTag = jenova::GetMarshalTypeTagFromStdString(methodSlot.returnTypeName);
+                    bool hasUnsupportedParameter = false;
+                    if (methodSlot.hasParameters)
+                    {
+                        for (size_t pid = methodSlot.passesCaller ? 1 : 0; pid < methodSlot.parameterTypeNames.size(); pid++)
                         {
-                            jenova::Error("Jenova Interpreter", "Failed to Allocate Property %s From Script %s", propertyName.c_str(), scriptUID.c_str());
-                            return false;
+                            const std::string& parameterTypeName = methodSlot.parameterTypeNames[pid];
+                            jenova::ParameterMarshal parameterMarshal;
+                            parameterMarshal.typeTag = jenova::GetMarshalTypeTagFromStdString(parameterTypeName);
+                            parameterMarshal.passByReference = parameterTypeName.find('&') != std::string::npos && parameterTypeName.find("const") != std::string::npos;
+                            methodSlot.parameterMarshals.push_back(parameterMarshal);
+                            if (parameterMarshal.typeTag != jenova::MarshalTypeTag::Variant || !jenova::IsSpanTypeName(parameterTypeName)) continue;
+                            jenova::Error("Jenova Interpreter", "Method [%s] From Script [%s] Takes Span With Unsupported Element Type [%s], Method Is Not Bound.", methodSlot.functionName.c_str(), dispatchEntry.scriptUID.c_str(), parameterTypeName.c_str());
+                            hasUnsupportedParameter = true;
                         }
+                    }
+                    if (hasUnsupportedParameter) continue;
+
+                    // Create Thunk Signature
+                    methodSlot.thunkSignature = dispatchEntry.scriptUID + "::" + methodSlot.functionName + "::" + methodSlot.returnTypeName + "(";
+                    for (size_t pid = 0; pid < methodSlot.parameterTypeNames.size(); pid++)
+                    {
+                        if (pid != 0) methodSlot.thunkSignature += ",";
+                        methodSlot.thunkSignature += methodSlot.parameterTypeNames[pid];
+                    }
+                    methodSlot.thunkSignature += ")";
 
-                        // Create Property Key
-                        std::string propertyKey = scriptUID + "_" + propertyName;
+                    // Add Method Slot
+                    dispatchEntry.methodIndices.insert(methodSlot.methodName, uint32_t(dispatchEntry.methodSlots.size()));
+                    dispatchEntry.methodSlots.push_back(methodSlot);
+                }
+            }
 
-                        // Add Allocated Property
-                        propertyStorage.insert(std::make_pair(propertyKey, propertyPtr));
+            // Add Dispatch Entry
+            newSnapshot->dispatchIndices[dispatchEntry.scriptUID] = int(newSnapshot->dispatchTable.size());
+            newSnapshot->dispatchTable.push_back(std::move(dispatchEntry));
+        }
 
-                        // Verbose
-                        jenova::VerboseByID(__LINE__, "Allocating Script [%s] Property [%s]", scriptUID.c_str(), propertyName.c_str());
-                    }
+        // All Good
+        return true;
+    }
+    catch (const std::exception& err)
+    {
+        moduleImage.dispatchSnapshot = std::make_shared<jenova::DispatchSnapshot>();
+        jenova::Error("Jenova Interpreter", "Failed to Build Dispatch Table, Parser Error : %s", err.what());
+        return false;
+    }
+}
+void JenovaInterpreter::PublishDispatchSnapshot(const std::shared_ptr<jenova::DispatchSnapshot>& newSnapshot)
+{
+    // Stamp Slots So Calls Can Detect They Belong to A Retired Module
+    newSnapshot->generation = dispatchGeneration.load(std::memory_order_relaxed) + 1;
+    for (auto& dispatchEntry : newSnapshot->dispatchTable)
+    {
+        for (jenova::ScriptMethodSlot& methodSlot : dispatchEntry.methodSlots) methodSlot.dispatchGeneration = newSnapshot->generation;
+    }
+
+    // Swap Snapshot Before Generation So Readers Seeing New Generation Also See New Table
+    std::atomic_store(&dispatchSnapshot, newSnapshot);
+    dispatchGeneration.store(newSnapshot->generation, std::memory_order_release);
+}
+jenova::DispatchSnapshotPtr JenovaInterpreter::GetDispatchSnapshot()
+{
+    return std::atomic_load(&dispatchSnapshot);
+}
+const jenova::ScriptDispatchEntry* JenovaInterpreter::GetScriptDispatchEntry(const jenova::DispatchSnapshot& dispatchSnapshot, const std::string& scriptUID)
+{
+    auto dispatchIndex = dispatchSnapshot.dispatchIndices.find(scriptUID);
+    if (dispatchIndex == dispatchSnapshot.dispatchIndices.end()) return nullptr;
+    return &dispatchSnapshot.dispatchTable[dispatchIndex->second];
+}
+uint64_t JenovaInterpreter::GetDispatchGeneration()
+{
+    return dispatchGeneration.load(std::memory_order_acquire);
+}
+jenova::FunctionAddress JenovaInterpreter::GetMethodSlotAddress(const jenova::ScriptMethodSlot& methodSlot)
+{
+    if (!allowExecution || methodSlot.dispatchGeneration != GetDispatchGeneration()) return 0;
+    return methodSlot.functionAddress;
+}
+const jenova::ScriptMethodSlot* JenovaInterpreter::GetMethodSlot(const std::string& scriptUID, const StringName& methodName)
+{
+    // Slot Stays Valid Until Next Module Load, Hold Snapshot For Longer Use
+    jenova::DispatchSnapshotPtr currentSnapshot = GetDispatchSnapshot();
+    const jenova::ScriptDispatchEntry* dispatchEntry = GetScriptDispatchEntry(*currentSnapshot, scriptUID);
+    if (!dispatchEntry) return nullptr;
+    const uint32_t* methodIndex = dispatchEntry->methodIndices.getptr(methodName);
+    if (!methodIndex) return nullptr;
+    return &dispatchEntry->methodSlots[*methodIndex];
+}
+bool JenovaInterpreter::UpdateNativeInvokersFromModule(jenova::ModuleImage& moduleImage)
+{
+    // Validate Module
+    if (!moduleImage.moduleHandle || !moduleImage.dispatchSnapshot) return false;
+
+    // Resolve Invoker Table For Each Script [Slots Are Finalized Before Execution Is Allowed]
+    int invokersCount = 0;
+    for (auto& dispatchEntry : moduleImage.dispatchSnapshot->dispatchTable)
+    {
+        typedef const jenova::NativeInvokerEntry*(*InvokerTableGetter)();
+        std::string tableGetterName = jenova::GlobalSettings::ScriptNativeInvokerTablePrefix + dispatchEntry.scriptUID;
+        InvokerTableGetter tableGetter = (InvokerTableGetter)JenovaInterpreter::SolveVirtualFunction(moduleImage.moduleHandle, tableGetterName.c_str());
+        if (!tableGetter) continue;
+
+        // Assign Invokers to Method Slots
+        for (const jenova::NativeInvokerEntry* invokerEntry = tableGetter(); invokerEntry && invokerEntry->functionName; invokerEntry++)
+        {
+            const uint32_t* methodIndex = dispatchEntry.methodIndices.getptr(StringName(invokerEntry->functionName));
+            if (!methodIndex) continue;
+            dispatchEntry.methodSlots[*methodIndex].nativeInvoker = invokerEntry->invoker;
+            dispatchEntry.methodSlots[*methodIndex].nativePtrInvoker = invokerEntry->ptrInvoker;
+            invokersCount++;
+        }
+    }
+
+    // Verbose
+    jenova::VerboseByID(__LINE__, "Interpreter Collected %d Native Invokers From Module.", invokersCount);
+
+    // All Good
+    return true;
+}
+bool JenovaInterpreter::PrepareDispatchCallers(jenova::ModuleImage& moduleImage)
+{
+    // Validate Module
+    if (!moduleImage.moduleBaseAddress || !moduleImage.dispatchSnapshot) return false;
+
+    // Resolve Addresses And Create Backend Callers For Slots Without Native Invoker [Slots Are Finalized Before Image Is Activated]
+    int callersCount = 0;
+    for (auto& dispatchEntry : moduleImage.dispatchSnapshot->dispatchTable)
+    {
+        dispatchEntry.moduleBaseAddress = moduleImage.moduleBaseAddress;
+        for (jenova::ScriptMethodSlot& methodSlot : dispatchEntry.methodSlots)
+        {
+            if (!methodSlot.functionOffset) continue;
+            methodSlot.functionAddress = moduleImage.moduleBaseAddress + methodSlot.functionOffset;
+            if (methodSlot.nativeInvoker) continue;
+            if (moduleImage.interpreterBackend == jenova::InterpreterBackend::AsmJIT) methodSlot.callerThunk = GetSlotCallerThunk(methodSlot);
+            if (moduleImage.interpreterBackend == jenova::InterpreterBackend::TinyCC || !methodSlot.callerThunk) methodSlot.callerStub = GetSlotCallerStub(methodSlot);
+            callersCount++;
+        }
+    }
+
+    // Verbose
+    jenova::VerboseByID(__LINE__, "Interpreter Prepared %d Backend Callers.", callersCount);
+
+    // All Good
+    return true;
+}
+bool JenovaInterpreter::RegisterNativeClasses()
+{
+    // Native Class Binding Is Opt-In At Build Time [Metadata Only Carries Classes When Enabled]
+    jenova::DispatchSnapshotPtr currentSnapshot = GetDispatchSnapshot();
+    const jenova::json_t& moduleMetaData = currentSnapshot->moduleMetaData;
+    if (!moduleMetaData.contains("Scripts")) return true;
+
+    try
+    {
+        // Register Classes And Method Binds From Published Snapshot
+        int methodsCount = 0;
+        for (const auto& moduleScript : moduleMetaData["Scripts"].items())
+        {
+            // Get Script Native Class
+            if (!moduleScript.value().contains("NativeClass")) continue;
+            const jenova::ScriptDispatchEntry* dispatchEntry = GetScriptDispatchEntry(*currentSnapshot, moduleScript.key());
+            if (!dispatchEntry) continue;
+            const jenova::json_t& nativeClassData = moduleScript.value().at("NativeClass");
+            StringName className(nativeClassData.at("ClassName").get<std::string>().c_str());
+            StringName parentClassName(nativeClassData.value("BaseType", std::string(jenova::GlobalSettings::DefaultNativeClassBaseType)).c_str());
+
+            // Find Registered Class [Classes Stay Registered Across Reloads]
+            jenova::NativeClass* nativeClass = nullptr;
+            for (const auto& registeredClass : nativeClasses) if (registeredClass->className == className) nativeClass = registeredClass.get();
+            if (nativeClass && nativeClass->scriptUID != moduleScript.key())
+            {
+                jenova::Warning("Jenova Interpreter", "Native Class [%s] Is Already Bound to Another Script.", AS_C_STRING(String(className)));
+                continue;
+            }
+            if (nativeClass && nativeClass->parentClassName != parentClassName)
+            {
+                jenova::Warning("Jenova Interpreter", "Native Class [%s] Base Type Changed, New Base Type Is Used After Engine Restarts.", AS_C_STRING(String(className)));
+            }
+
+            // Register New Class
+            if (!nativeClass)
+            {
+                if (ClassDBSingleton::get_singleton()->class_exists(className))
+                {
+                    jenova::Warning("Jenova Interpreter", "Native Class [%s] Already Exists in ClassDB.", AS_C_STRING(String(className)));
+                    continue;
+                }
+                if (!ClassDBSingleton::get_singleton()->class_exists(parentClassName) || !ClassDBSingleton::get_singleton()->is_parent_class(parentClassName, "Node"))
+                {
+                    jenova::Warning("Jenova Interpreter", "Native Class [%s] Base Type [%s] Is Not A Node Class.", AS_C_STRING(String(className)), AS_C_STRING(String(parentClassName)));
+                    continue;
+                }
+
+                // Resolve Script Once [Every Instance Attaches Same Resource]
+                String scriptPath = String(nativeClassData.at("ScriptPath").get<std::string>().c_str());
+                Ref<Resource> scriptResource = ResourceLoader::get_singleton()->load(scriptPath);
+                if (scriptResource.is_null())
+                {
+                    jenova::Warning("Jenova Interpreter", "Native Class [%s] Script [%s] Cannot Be Loaded.", AS_C_STRING(String(className)), AS_C_STRING(scriptPath));
+                    continue;
+                }
+                std::unique_ptr<jenova::NativeClass> newClass = std::make_unique<jenova::NativeClass>();
+                newClass->className = className;
+                newClass->parentClassName = parentClassName;
+                newClass->scriptUID = moduleScript.key();
+                newClass->scriptPath = scriptPath;
+                newClass->scriptResource = scriptResource;
+                GDExtensionClassCreationInfo3 classInfo = {};
+                classInfo.is_exposed = true;
+                classInfo.create_instance_func = &CreateNativeClassInstance;
+                classInfo.free_instance_func = &FreeNativeClassInstance;
+                classInfo.get_virtual_func = &GetNativeClassVirtual;
+                classInfo.class_userdata = newClass.get();
+                godot::internal::gdextension_interface_classdb_register_extension_class3(godot::internal::library, newClass->className._native_ptr(), newClass->parentClassName._native_ptr(), &classInfo);
+                nativeClass = newClass.get();
+                nativeClasses.push_back(std::move(newClass));
+            }
+
+            // Register Method Binds For Slots With Pointer Invokers [Other Methods Keep Script Instance Path]
+            for (const jenova::ScriptMethodSlot& methodSlot : dispatchEntry->methodSlots)
+            {
+                if (!methodSlot.nativePtrInvoker) continue;
+
+                // Update Registered Bind [Engine Keeps Original Signature, Changed Ones Are Decoded Through Variant Path]
+                uint64_t signatureHash = GetNativeMethodSignatureHash(methodSlot);
+                auto registeredMethod = nativeClass->classMethods.find(methodSlot.functionName);
+                if (registeredMethod != nativeClass->classMethods.end())
+                {
+                    if (registeredMethod->second->signatureHash == signatureHash) continue;
+                    registeredMethod->second->signatureHash = signatureHash;
+                    jenova::Warning("Jenova Interpreter", "Native Class Method [%s::%s] Signature Changed, Calls Use Variant Path Until Engine Restarts.", AS_C_STRING(String(className)), methodSlot.functionName.c_str());
+                    continue;
+                }
+                std::unique_ptr<jenova::NativeClassMethod> classMethod = std::make_unique<jenova::NativeClassMethod>();
+                classMethod->methodName = methodSlot.methodName;
+                classMethod->mustReturn = methodSlot.mustReturn;
+                classMethod->signatureHash = signatureHash;
+                classMethod->registeredSignatureHash = signatureHash;
+                classMethod->returnType = jenova::GetMarshalTypeOperations(methodSlot.returnTag).variantType;
+                for (const jenova::ParameterMarshal& parameterMarshal : methodSlot.parameterMarshals) classMethod->argumentTypes.push_back(jenova::GetMarshalTypeOperations(parameterMarshal.typeTag).variantType);
+
+                // Create Argument Infos
+                size_t argumentsCount = methodSlot.parameterMarshals.size();
+                std::vector<StringName> argumentNames(argumentsCount);
+                std::vector<GDExtensionPropertyInfo> argumentsInfo(argumentsCount);
+                std::vector<GDExtensionClassMethodArgumentMetadata> argumentsMetadata(argumentsCount);
+                StringName objectClassName("Object"), emptyClassName;
+                String emptyHint;
+                auto createPropertyInfo = [&](jenova::MarshalTypeTag typeTag, StringName& propertyName)
+                {
+                    Variant::Type variantType = jenova::GetMarshalTypeOperations(typeTag).variantType;
+                    GDExtensionPropertyInfo propertyInfo = {};
+                    propertyInfo.type = GDExtensionVariantType(variantType);
+                    propertyInfo.name = propertyName._native_ptr();
+                    propertyInfo.class_name = variantType == Variant::OBJECT ? objectClassName._native_ptr() : emptyClassName._native_ptr();
+                    propertyInfo.hint_string = emptyHint._native_ptr();
+                    propertyInfo.usage = variantType == Variant::NIL ? PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_NIL_IS_VARIANT : PROPERTY_USAGE_DEFAULT;
+                    return propertyInfo;
+                };
+                for (size_t i = 0; i < argumentsCount; i++)
+                {
+                    argumentNames[i] = StringName(jenova::Format("arg%d", int(i + 1)).c_str());
+                    argumentsInfo[i] = createPropertyInfo(methodSlot.parameterMarshals[i].typeTag, argumentNames[i]);
+                    argumentsMetadata[i] = GetNativeArgumentMetadata(methodSlot.parameterMarshals[i].typeTag);
                 }
+                StringName returnName;
+                GDExtensionPropertyInfo returnInfo = createPropertyInfo(methodSlot.returnTag, returnName);
+
+                // Register Method Bind
+                GDExtensionClassMethodInfo methodInfo = {};
+                methodInfo.name = classMethod->methodName._native_ptr();
+                methodInfo.method_userdata = classMethod.get();
+                methodInfo.call_func = &CallNativeClassMethod;
+                methodInfo.ptrcall_func = &PtrCallNativeClassMethod;
+                methodInfo.method_flags = GDEXTENSION_METHOD_FLAGS_DEFAULT;
+                methodInfo.has_return_value = methodSlot.mustReturn;
+                methodInfo.return_value_info = &returnInfo;
+                methodInfo.return_value_metadata = GetNativeArgumentMetadata(methodSlot.returnTag);
+                methodInfo.argument_count = uint32_t(argumentsCount);
+                methodInfo.arguments_info = argumentsInfo.data();
+                methodInfo.arguments_metadata = argumentsMetadata.data();
+                godot::internal::gdextension_interface_classdb_register_extension_class_method(godot::internal::library, nativeClass->className._native_ptr(), &methodInfo);
+                nativeClass->classMethods[methodSlot.functionName] = std::move(classMethod);
+                methodsCount++;
             }
         }
 
+        // Verbose
+        jenova::VerboseByID(__LINE__, "Interpreter Registered %d Native Class Methods.", methodsCount);
+
         // All Good
         return true;
     }
     catch (const std::exception& err)
     {
-        jenova::Error("Jenova Interpreter", "Failed to Parse Metadata, Parser Error : %s", err.what());
+        jenova::Error("Jenova Interpreter", "Failed to Register Native Classes, Parser Error : %s", err.what());
         return false;
     }
 }
-bool JenovaInterpreter::FlushPropertyStorage()
+void JenovaInterpreter::ReleaseNativeClasses()
 {
-    for (auto scriptProperty : propertyStorage)
+    // Unregister Classes In Reverse Registration Order
+    for (auto nativeClass = nativeClasses.rbegin(); nativeClass != nativeClasses.rend(); ++nativeClass)
     {
-        if (scriptProperty.second) delete scriptProperty.second;
+        godot::internal::gdextension_interface_classdb_unregister_extension_class(godot::internal::library, (*nativeClass)->className._native_ptr());
     }
-    propertyStorage.clear();
+    nativeClasses.clear();
+}
+bool JenovaInterpreter::FlushPropertyStorage()
+{
+    // Drop Bindings Into Retiring Module [Layouts Are Released With Their Snapshot, Instance Blocks Keep Them Alive Until They Migrate]
+    std::unique_lock<std::recursive_mutex> bindingLock = JenovaInterpreter::LockPropertyBinding();
+    jenova::DispatchSnapshotPtr currentSnapshot = GetDispatchSnapshot();
+    for (const auto& propertyLayout : currentSnapshot->propertyLayouts) propertyLayout.second->boundBlock = nullptr;
     return true;
 }
 jenova::PropertyList JenovaInterpreter::GetPropertiesList(std::string& scriptUID)
@@ -1630,7 +2822,8 @@ jenova::PropertyList JenovaInterpreter::GetPropertiesList(std::string& scriptUID
         jenova::PropertyList propertyNames;
 
         // Get Script Metadata by UID
-        jenova::json_t scriptMetadata = moduleMetaData["Scripts"][scriptUID]["properties"];
+        jenova::DispatchSnapshotPtr currentSnapshot = GetDispatchSnapshot();
+        const jenova::json_t& scriptMetadata = currentSnapshot->moduleMetaData.at("Scripts").at(scriptUID).at("properties");
 
         // Add Property to List
         for (const auto& propertyName : scriptMetadata.items()) propertyNames.push_back(propertyName.key());
@@ -1648,15 +2841,17 @@ std::string JenovaInterpreter::GetPropertyType(const std::string& propertyName,
     try
     {
         // Validate Script UID
-        if (!moduleMetaData["Scripts"].contains(scriptUID)) return std::string();
+        jenova::DispatchSnapshotPtr currentSnapshot = GetDispatchSnapshot();
+        const jenova::json_t& moduleScripts = currentSnapshot->moduleMetaData.at("Scripts");
+        if (!moduleScripts.contains(scriptUID)) return std::string();
 
         // Get Script Metadata by UID
-        jenova::json_t scriptMetadata = moduleMetaData["Scripts"][scriptUID]["properties"];
+        const jenova::json_t& scriptMetadata = moduleScripts.at(scriptUID).at("properties");
 
         // Find and Return Property Type
         for (const auto& prop : scriptMetadata.items())
         {
-            if (prop.key() == propertyName) return prop.value()["Type"].get<std::string>();
+            if (prop.key() == propertyName) return prop.value().at("Type").get<std::string>();
         }
     }
     catch (const std::exception&)
@@ -1672,10 +2867,16 @@ jenova::PropertyAddress JenovaInterpreter::GetPropertyAddress(const std::string&
     try
     {
         // Validate Script UID
-        if (!moduleMetaData["Scripts"].contains(scriptUID)) return 0;
+        jenova::DispatchSnapshotPtr currentSnapshot = GetDispatchSnapshot();
+        const jenova::json_t& moduleScripts = currentSnapshot->moduleMetaData.at("Scripts");
+        if (!moduleScripts.contains(scriptUID)) return 0;
 
         // Get Script Metadata by UID
-        jenova::json_t scriptMetadata = moduleMetaData["Scripts"][scriptUID]["properties"];
+        const jenova::json_t& scriptMetadata = moduleScripts.at(scriptUID).at("properties");
+
+        // Resolve Module Image Owning Script
+        const jenova::ScriptDispatchEntry* dispatchEntry = GetScriptDispatchEntry(*currentSnapshot, scriptUID);
+        jenova::ModuleAddress scriptBaseAddress = dispatchEntry && dispatchEntry->moduleBaseAddress ? dispatchEntry->moduleBaseAddress : moduleBaseAddress;
 
         // Find and return Property Address
         for (const auto& prop : scriptMetadata.items())
@@ -1683,8 +2884,8 @@ jenova::PropertyAddress JenovaInterpreter::GetPropertyAddress(const std::string&
             if (prop.key() == propertyName)
             {
                 // Calculate Offset + BaseAddress and Return the Address
-                jenova::PropertyAddress propertyOffset = prop.value()["Offset"].get<jenova::PropertyAddress>();
-                return moduleBaseAddress + propertyOffset;
+                jenova::PropertyAddress propertyOffset = prop.value().at("Offset").get<jenova::PropertyAddress>();
+                return scriptBaseAddress + propertyOffset;
             }
         }
     }
@@ -1696,42 +2897,187 @@ jenova::PropertyAddress JenovaInterpreter::GetPropertyAddress(const std::string&
     // Property was not found
     return 0;
 }
-jenova::PropertyPointer JenovaInterpreter::GetPropertyPointer(const String& propertyName, const String& scriptUID)
+std::shared_ptr<jenova::ScriptPropertyLayout> JenovaInterpreter::GetPropertyLayout(const std::string& scriptUID)
+{
+    // Read Layout From Published Snapshot [Returned Reference Keeps It Alive Across Reloads]
+    jenova::DispatchSnapshotPtr currentSnapshot = GetDispatchSnapshot();
+    auto propertyLayout = currentSnapshot->propertyLayouts.find(scriptUID);
+    if (propertyLayout == currentSnapshot->propertyLayouts.end()) return nullptr;
+    return propertyLayout->second;
+}
+jenova::ScriptPropertyBlock* JenovaInterpreter::CreatePropertyBlock(const std::string& scriptUID)
+{
+    // Get Script Property Layout
+    std::shared_ptr<jenova::ScriptPropertyLayout> propertyLayout = GetPropertyLayout(scriptUID);
+    if (!propertyLayout) return nullptr;
+
+    // Take Block Header And Storage From Script Arena
+    jenova::ScriptPropertyBlock* propertyBlock = nullptr;
+    {
+        std::lock_guard<std::mutex> arenaLock(propertyLayout->arenaMutex);
+        if (!propertyLayout->freeBlockHeaders.empty())
+        {
+            propertyBlock = propertyLayout->freeBlockHeaders.back();
+            propertyLayout->freeBlockHeaders.pop_back();
+        }
+        else
+        {
+            propertyBlock = new jenova::ScriptPropertyBlock();
+        }
+        propertyBlock->propertyLayout = propertyLayout;
+        propertyBlock->dirtyProperties.assign(propertyLayout->propertySlots.size(), false);
+        if (propertyLayout->blockSize == 0) return propertyBlock;
+        if (propertyLayout->freeBlocks.empty())
+        {
+            uint8_t* arenaChunk = static_cast<uint8_t*>(std::malloc(propertyLayout->blockSize * jenova::GlobalSettings::PropertyArenaBlocksPerChunk));
+            if (!arenaChunk)
+            {
+                propertyBlock->propertyLayout.reset();
+                propertyLayout->freeBlockHeaders.push_back(propertyBlock);
+                jenova::Error("Jenova Interpreter", "Failed to Allocate Property Arena For Script %s", scriptUID.c_str());
+                return nullptr;
+            }
+            propertyLayout->arenaChunks.push_back(arenaChunk);
+            for (size_t i = jenova::GlobalSettings::PropertyArenaBlocksPerChunk; i > 0; i--) propertyLayout->freeBlocks.push_back(arenaChunk + (i - 1) * propertyLayout->blockSize);
+        }
+        propertyBlock->blockStorage = static_cast<uint8_t*>(propertyLayout->freeBlocks.back());
+        propertyLayout->freeBlocks.pop_back();
+    }
+
+    // Copy Default Property Image And Copy Construct Non-Trivial Properties Over It
+    std::memcpy(propertyBlock->blockStorage, propertyLayout->defaultImage, propertyLayout->blockSize);
+    for (const jenova::ScriptPropertySlot& propertySlot : propertyLayout->propertySlots)
+    {
+        if (propertySlot.typeOperations->isTriviallyCopyable) continue;
+        size_t storageOffset = propertySlot.storageOffset;
+        propertySlot.typeOperations->copyConstructor(propertyBlock->blockStorage + storageOffset, propertyLayout->defaultImage + storageOffset);
+    }
+
+    // Return Property Block
+    return propertyBlock;
+}
+bool JenovaInterpreter::UpdatePropertyBlock(jenova::ScriptPropertyBlock*& propertyBlock, const std::string& scriptUID)
 {
-    // Create Property Key
-    std::string propertyKey = AS_STD_STRING(scriptUID + String("_") + propertyName.get_file());
+    // Check If Block Layout Is Current
+    if (propertyBlock && propertyBlock->propertyLayout->layoutGeneration == GetDispatchGeneration()) return true;
 
-    // Validate Property
-    if (!propertyStorage.contains(propertyKey)) return nullptr;
+    // Keep Stale Block Until A New Layout Is Available
+    std::shared_ptr<jenova::ScriptPropertyLayout> propertyLayout = GetPropertyLayout(scriptUID);
+    if (!propertyLayout) return propertyBlock != nullptr;
 
-    // Get Property Pointer from Storage
-    jenova::PropertyPointer propertyPtr = propertyStorage[propertyKey];
+    // Create Block From New Layout
+    jenova::ScriptPropertyBlock* newPropertyBlock = CreatePropertyBlock(scriptUID);
+    if (!newPropertyBlock) return propertyBlock != nullptr;
+
+    // Migrate Values From Previous Layout
+    if (propertyBlock)
+    {
+        const jenova::ScriptPropertyLayout* oldPropertyLayout = propertyBlock->propertyLayout.get();
+        for (size_t i = 0; i < oldPropertyLayout->propertySlots.size(); i++)
+        {
+            const jenova::ScriptPropertySlot& oldPropertySlot = oldPropertyLayout->propertySlots[i];
+            const uint32_t* newPropertyIndex = propertyLayout->propertyContainer.propertyIndices.getptr(oldPropertySlot.propertyName);
+            if (!newPropertyIndex) continue;
+            const jenova::ScriptPropertySlot& newPropertySlot = propertyLayout->propertySlots[*newPropertyIndex];
+            if (newPropertySlot.propertyTypeName != oldPropertySlot.propertyTypeName) continue;
+            Variant propertyValue;
+            oldPropertySlot.typeOperations->readToVariant(propertyBlock->blockStorage + oldPropertySlot.storageOffset, propertyValue);
+            WritePropertySlotValue(newPropertySlot, newPropertyBlock->blockStorage + newPropertySlot.storageOffset, propertyValue);
+            newPropertyBlock->dirtyProperties[*newPropertyIndex] = propertyBlock->dirtyProperties[i];
+        }
+        ReleasePropertyBlock(propertyBlock);
+    }
 
-    // Return Property Pointer
-    return propertyPtr;
+    // Swap Block
+    propertyBlock = newPropertyBlock;
+    return true;
 }
-bool JenovaInterpreter::SetPropertyValueFromVariant(const String& propertyName, const Variant& propertyValue, const String& scriptUID)
+void JenovaInterpreter::ReleasePropertyBlock(jenova::ScriptPropertyBlock* propertyBlock)
 {
-    // Get Property Pointer from Storage
-    jenova::PropertyPointer propertyPtr = GetPropertyPointer(propertyName, scriptUID);
+    // Validate Block [Take Layout Reference So Header Can Be Pooled Without Cycle]
+    if (!propertyBlock) return;
+    std::shared_ptr<jenova::ScriptPropertyLayout> propertyLayout = std::move(propertyBlock->propertyLayout);
+
+    // Destruct Properties
+    if (propertyBlock->blockStorage)
+    {
+        for (const jenova::ScriptPropertySlot& propertySlot : propertyLayout->propertySlots)
+        {
+            propertySlot.typeOperations->destructor(propertyBlock->blockStorage + propertySlot.storageOffset);
+        }
+    }
 
-    // Validate Property Pointer
-    if (propertyPtr == nullptr) return false;
+    // Unbind Block
+    {
+        std::unique_lock<std::recursive_mutex> bindingLock = JenovaInterpreter::LockPropertyBinding();
+        if (propertyLayout->boundBlock == propertyBlock) propertyLayout->boundBlock = nullptr;
+    }
 
-    // Set Property Value from Variant
-    if (!jenova::SetPropertyPointerValueFromVariant(propertyPtr, propertyValue)) return false;
+    // Return Block Storage And Header To Script Arena
+    std::lock_guard<std::mutex> arenaLock(propertyLayout->arenaMutex);
+    if (propertyBlock->blockStorage) propertyLayout->freeBlocks.push_back(propertyBlock->blockStorage);
+    propertyBlock->blockStorage = nullptr;
+    propertyLayout->freeBlockHeaders.push_back(propertyBlock);
+}
+bool JenovaInterpreter::BindPropertyBlock(jenova::ScriptPropertyBlock* propertyBlock, jenova::ScriptPropertyBlock** previousPropertyBlock)
+{
+    // Validate Block Against Loaded Module [Lock Covers Binding Only, Never The Call Using It]
+    if (!propertyBlock) return false;
+    jenova::ScriptPropertyLayout* propertyLayout = propertyBlock->propertyLayout.get();
+    std::unique_lock<std::recursive_mutex> bindingLock = JenovaInterpreter::LockPropertyBinding();
+    if (previousPropertyBlock) *previousPropertyBlock = propertyLayout->boundBlock;
+    if (propertyLayout->layoutGeneration != GetDispatchGeneration()) return false;
+
+    // Skip If Block Is Already Bound
+    if (propertyLayout->boundBlock == propertyBlock) return true;
+
+    // Point Script Property Globals to Instance Block
+    for (const jenova::ScriptPropertySlot& propertySlot : propertyLayout->propertySlots)
+    {
+        void* propertyPtr = propertyBlock->blockStorage + propertySlot.storageOffset;
+        jenova::PropertyAddress propertyAddress = propertyLayout->moduleBaseAddress + propertySlot.propertyOffset;
+        if (propertySetMethod == jenova::PropertySetMethod::DirectAssign) *(void**)propertyAddress = propertyPtr;
+        if (propertySetMethod == jenova::PropertySetMethod::MemoryCopy) memcpy((void*)propertyAddress, &propertyPtr, sizeof(propertyPtr));
+    }
+    propertyLayout->boundBlock = propertyBlock;
 
-    // Get Property Address
-    jenova::PropertyAddress propertyAddress = JenovaInterpreter::GetPropertyAddress(AS_STD_STRING(propertyName.get_file()), AS_STD_STRING(scriptUID));
-    if (!propertyAddress) return false;
+    // All Good
+    return true;
+}
+std::unique_lock<std::recursive_mutex> JenovaInterpreter::LockPropertyBinding()
+{
+    // Property Globals Are Shared Per Module, Binding Them And Swapping Modules Are Serialized
+    return std::unique_lock<std::recursive_mutex>(propertyBindingMutex);
+}
+bool JenovaInterpreter::SetPropertyBlockValue(jenova::ScriptPropertyBlock* propertyBlock, const StringName& propertyName, const Variant& propertyValue)
+{
+    // Resolve Property Slot
+    if (!propertyBlock) return false;
+    const jenova::ScriptPropertyLayout* propertyLayout = propertyBlock->propertyLayout.get();
+    const uint32_t* propertyIndex = propertyLayout->propertyContainer.propertyIndices.getptr(propertyName);
+    if (!propertyIndex) return false;
+    const jenova::ScriptPropertySlot& propertySlot = propertyLayout->propertySlots[*propertyIndex];
 
-    // Set Property Pointer
-    if (propertySetMethod == jenova::PropertySetMethod::DirectAssign) *(void**)propertyAddress = propertyPtr;
-    if (propertySetMethod == jenova::PropertySetMethod::MemoryCopy) memcpy((void*)propertyAddress, &propertyPtr, sizeof(propertyPtr));
+    // Write Value Into Instance Block
+    if (!WritePropertySlotValue(propertySlot, propertyBlock->blockStorage + propertySlot.storageOffset, propertyValue)) return false;
+    propertyBlock->dirtyProperties[*propertyIndex] = true;
 
     // All Good
     return true;
 }
+bool JenovaInterpreter::GetPropertyBlockValue(const jenova::ScriptPropertyBlock* propertyBlock, const StringName& propertyName, Variant& propertyValue)
+{
+    // Resolve Property Slot
+    if (!propertyBlock) return false;
+    const jenova::ScriptPropertyLayout* propertyLayout = propertyBlock->propertyLayout.get();
+    const uint32_t* propertyIndex = propertyLayout->propertyContainer.propertyIndices.getptr(propertyName);
+    if (!propertyIndex) return false;
+    const jenova::ScriptPropertySlot& propertySlot = propertyLayout->propertySlots[*propertyIndex];
+
+    // Read Value From Instance Block
+    propertySlot.typeOperations->readToVariant(propertyBlock->blockStorage + propertySlot.storageOffset, propertyValue);
+    return true;
+}
 jenova::InterpreterBackend JenovaInterpreter::GetInterpreterBackend()
 {
     return interpreterBackend;
@@ -1754,7 +3100,7 @@ jenova::ModuleHandle JenovaInterpreter::LoadShellModule(const uint8_t* moduleDat
 }
 
 // Jenova Interpreter Implementation :: Module Database
-bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData)
+bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const jenova::ModulePartList& moduleParts)
 {
     // Verbose
     jenova::VerboseByID(__LINE__, "Caching Jenova Compiled Module In Database...");
@@ -1763,11 +3109,20 @@ bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseNa
     if (moduleDatabaseName.empty()) return false;
     if (!moduleDataPtr || moduleSize == 0 || metaData.empty()) return false;
 
+    // Validate Part Identities Fit Fixed Size Part Headers [Truncated Names Would Never Match Loaded Parts]
+    for (const jenova::ModulePart& modulePart : moduleParts)
+    {
+        if (modulePart.partName.size() < sizeof(jenova::ModuleDatabasePartHeader::partName) && modulePart.partHash.size() < sizeof(jenova::ModuleDatabasePartHeader::partHash)) continue;
+        jenova::Error("Jenova Interpreter", "Module Part [%s] Name or Hash Exceeds Database Header Size.", modulePart.partName.c_str());
+        return false;
+    }
+
     // Create Header
     jenova::ModuleDatabaseHeader moduleDatabaseHeader;
     moduleDatabaseHeader.moduleSize = moduleSize;
     moduleDatabaseHeader.metaDataSize = metaData.size();
     moduleDatabaseHeader.databaseType = jenova::ModuleCacheType::OpenSource;
+    moduleDatabaseHeader.partsCount = uint16_t(moduleParts.size());
 
     // Set Database Version
     const unsigned char appVersionData[4] = { APP_VERSION_DATA };
@@ -1791,6 +3146,22 @@ bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseNa
     databaseWriter.open(defaultModuleDatabasePath, std::ios::binary | std::ios::out);
     databaseWriter.write((char*)&moduleDatabaseHeader, sizeof(jenova::ModuleDatabaseHeader));
     databaseWriter.write((char*)compressedData.data(), compressedData.size());
+
+    // Write Script Module Parts [Each Part Is Compressed Separately]
+    for (const jenova::ModulePart& modulePart : moduleParts)
+    {
+        jenova::ModuleDatabasePartHeader partHeader;
+        strncpy(partHeader.partName, modulePart.partName.c_str(), sizeof(partHeader.partName) - 1);
+        strncpy(partHeader.partHash, modulePart.partHash.c_str(), sizeof(partHeader.partHash) - 1);
+        partHeader.moduleSize = modulePart.partData.size();
+        partHeader.metaDataSize = modulePart.partMetaData.size();
+        jenova::MemoryBuffer partRawBuffer(modulePart.partData.begin(), modulePart.partData.end());
+        partRawBuffer.insert(partRawBuffer.end(), modulePart.partMetaData.begin(), modulePart.partMetaData.end());
+        jenova::MemoryBuffer partCompressedData = jenova::CompressBuffer(partRawBuffer.data(), partRawBuffer.size());
+        partHeader.encodedDataSize = partCompressedData.size();
+        databaseWriter.write((char*)&partHeader, sizeof(jenova::ModuleDatabasePartHeader));
+        databaseWriter.write((char*)partCompressedData.data(), partCompressedData.size());
+    }
     databaseWriter.close();
 
     // Release Buffers
@@ -1806,9 +3177,9 @@ bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseNa
 }
 bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseName, const jenova::BuildResult& buildResult)
 {
-    return CreateModuleDatabase(moduleDatabaseName, buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData);
+    return CreateModuleDatabase(moduleDatabaseName, buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData, buildResult.moduleParts);
 }
-bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName)
+bool JenovaInterpreter::ReadModuleDatabase(const std::string& moduleDatabaseName, jenova::MemoryBuffer& moduleData, jenova::SerializedData& metaData, jenova::ModulePartList& moduleParts)
 {
     // Verbose
     jenova::VerboseByID(__LINE__, "Loading Jenova Compiled Module Database...");
@@ -1878,27 +3249,67 @@ bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName
     jenova::MemoryBuffer decompressedData = jenova::DecompressBuffer(encodedRawBuffer.data(), encodedRawBuffer.size());
     if (decompressedData.size() == 0) return false;
 
+    // Extract Metadata And Keep Module Bytes Without Extra Copy
+    if (decompressedData.size() < size_t(databaseHeader->moduleSize) + size_t(databaseHeader->metaDataSize)) return false;
+    metaData.assign((const char*)&decompressedData[databaseHeader->moduleSize], databaseHeader->metaDataSize);
+    decompressedData.resize(databaseHeader->moduleSize);
+    moduleData.swap(decompressedData);
+
+    // Extract Script Module Parts
+    size_t partOffset = sizeof(jenova::ModuleDatabaseHeader) + databaseHeader->encodedDataSize;
+    for (uint16_t pid = 0; pid < databaseHeader->partsCount; pid++)
+    {
+        // Read Part Header
+        jenova::ModuleDatabasePartHeader partHeader;
+        if (partOffset + sizeof(jenova::ModuleDatabasePartHeader) > databaseRawData.size()) return false;
+        std::memcpy(&partHeader, &databaseRawData[partOffset], sizeof(jenova::ModuleDatabasePartHeader));
+        partOffset += sizeof(jenova::ModuleDatabasePartHeader);
+        if (partOffset + partHeader.encodedDataSize > databaseRawData.size()) return false;
+
+        // Decompress Part Data
+        jenova::MemoryBuffer partData = jenova::DecompressBuffer(&databaseRawData[partOffset], partHeader.encodedDataSize);
+        partOffset += partHeader.encodedDataSize;
+        if (partData.size() < partHeader.moduleSize + partHeader.metaDataSize) return false;
+
+        // Add Module Part
+        jenova::ModulePart modulePart;
+        modulePart.partName.assign(partHeader.partName, strnlen(partHeader.partName, sizeof(partHeader.partName)));
+        modulePart.partHash.assign(partHeader.partHash, strnlen(partHeader.partHash, sizeof(partHeader.partHash)));
+        modulePart.partMetaData.assign((const char*)&partData[partHeader.moduleSize], partHeader.metaDataSize);
+        partData.resize(partHeader.moduleSize);
+        modulePart.partData.swap(partData);
+        moduleParts.push_back(std::move(modulePart));
+    }
+
+    // All Good
+    return true;
+}
+bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName)
+{
+    // Read Module And Metadata From Database
+    jenova::MemoryBuffer moduleData;
+    jenova::SerializedData metaData;
+    jenova::ModulePartList moduleParts;
+    if (!JenovaInterpreter::ReadModuleDatabase(moduleDatabaseName, moduleData, metaData, moduleParts)) return false;
+
     // Get Data Pointers
-    const uint8_t* moduleDataPtr = decompressedData.data();
-    const size_t moduleSize = databaseHeader->moduleSize;
-    const char* metaDataDataPtr = (const char*)&decompressedData[databaseHeader->moduleSize];
-    const jenova::SerializedData metaData(metaDataDataPtr, databaseHeader->metaDataSize);
+    const uint8_t* moduleDataPtr = moduleData.data();
+    const size_t moduleSize = moduleData.size();
 
     // Check If Module Is Already Loaded
     if (GetModuleBaseAddress() == 0)
     {
         // Load Module
-        if (!LoadModule(moduleDataPtr, moduleSize, metaData))
+        if (!LoadModule(moduleDataPtr, moduleSize, metaData, moduleParts))
         {
             jenova::Error("Jenova Interpreter", "Unable to Deploy and Load Compiled Jenova Module From Database.");
-            std::vector<uint8_t>().swap(databaseRawData);
             return false;
         }
     }
     else
     {
         // Reload Module
-        if (!JenovaInterpreter::ReloadModule(moduleDataPtr, moduleSize, metaData))
+        if (!JenovaInterpreter::ReloadModule(moduleDataPtr, moduleSize, metaData, moduleParts))
         {
             jenova::Error("Jenova Interpreter", "Unable to Deploy and Reload Compiled Jenova Module From Database.");
             return false;
@@ -1906,9 +3317,7 @@ bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName
     }
 
     // Release Buffers
-    jenova::MemoryBuffer().swap(databaseRawData);
-    jenova::MemoryBuffer().swap(encodedRawBuffer);
-    jenova::MemoryBuffer().swap(decompressedData);
+    jenova::MemoryBuffer().swap(moduleData);
 
     // Verbose
     jenova::VerboseByID(__LINE__, "Jenova Compiled Module Deployed and Loaded from Database Cache.");
@@ -25,32 +25,64 @@ public:
     static bool InitializeInterpreter();
     static bool IsInterpreterInitialized();
     static bool ReleaseInterpreter();
-    static bool LoadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData);
+    static bool LoadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const jenova::ModulePartList& moduleParts = jenova::ModulePartList());
     static bool LoadModule(const jenova::BuildResult& buildResult);
-    static bool ReloadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData);
+    static bool ReloadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const jenova::ModulePartList& moduleParts = jenova::ModulePartList());
     static bool ReloadModule(const jenova::BuildResult& buildResult);
     static bool UnloadModule(const jenova::ModuleUnloadStage& unloadStage);
+    static bool StageModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const jenova::ModulePartList& moduleParts = jenova::ModulePartList());
+    static bool StageModuleFromDatabase(const std::string& moduleDatabaseName);
+    static bool StageModuleFromBuild(const jenova::BuildResult& buildResult);
+    static bool IsModuleStaging();
+    static bool UpdateModuleStaging();
+    static bool ReleaseRetiredModules();
+    static uint64_t EnterExecutionEpoch();
+    static void LeaveExecutionEpoch(uint64_t executionEpoch);
+    static bool AdvanceExecutionEpoch();
+    static bool IsExecutionEpochDrained(uint64_t executionEpoch);
     static bool LoadDebugSymbol(const std::string symbolFilePath);
     static intptr_t GetModuleBaseAddress();
     static jenova::FunctionList GetFunctionsList(const std::string& scriptUID);
     static jenova::FunctionAddress GetFunctionAddress(const std::string& functionName, const std::string& scriptUID);
     static jenova::ParameterTypeList GetFunctionParameters(const std::string& functionName, const std::string& scriptUID);
     static std::string GetFunctionReturn(const std::string& functionName, const std::string& scriptUID);
-    static uintptr_t GetResolvedParameterPointer(const godot::Object* objectPtr, const godot::Variant* functionParameter, const std::string& parameterType);
     static bool IsFunctionReturnable(const std::string& returnType);
     static jenova::ScriptFunctionContainer GetFunctionContainer(const std::string& scriptUID);
-    static jenova::ScriptPropertyContainer GetPropertyContainer(const std::string& scriptUID);
+    static std::shared_ptr<const jenova::ScriptPropertyContainer> GetPropertyContainer(const std::string& scriptUID);
     static Variant CallFunction(const godot::Object* objectPtr, const std::string& functionName, std::string& scriptUID, const Variant** functionParameters, const int functionParametersCount);
+    static Variant CallFunction(const godot::Object* objectPtr, const jenova::ScriptMethodSlot& methodSlot, const Variant** functionParameters, const int functionParametersCount);
+    static bool CallFunctionPtr(const godot::Object* objectPtr, const jenova::ScriptMethodSlot& methodSlot, const GDExtensionConstTypePtr* functionParameters, GDExtensionTypePtr returnValue);
+    static jenova::FunctionPointer GetCallerThunk(const std::string& thunkSignature, jenova::FunctionAddress functionAddress, const jenova::ParameterTypeList& argumentTypes, const std::string& returnType);
+    static jenova::FunctionPointer GetCallerStub(const std::string& returnType, const jenova::ParameterTypeList& argumentTypes);
+    static jenova::FunctionPointer GetSlotCallerThunk(const jenova::ScriptMethodSlot& methodSlot);
+    static jenova::FunctionPointer GetSlotCallerStub(const jenova::ScriptMethodSlot& methodSlot);
+    static bool ReleaseCallerThunks();
     static void SetExecutionState(bool executionState);
     static jenova::SerializedData GenerateModuleMetadata(const std::string& mapFilePath, const jenova::ModuleList& scriptModules, const jenova::BuildResult& buildResult);
-    static bool UpdateConfigurationsFromMetaData(const jenova::SerializedData& metaData);
-    static bool UpdatePropertyStorageFromMetaData();
+    static bool UpdateConfigurationsFromMetaData(jenova::ModuleImage& moduleImage, const jenova::SerializedData& metaData);
+    static bool UpdateDispatchTableFromMetaData(jenova::ModuleImage& moduleImage);
+    static bool PrepareDispatchCallers(jenova::ModuleImage& moduleImage);
+    static jenova::DispatchSnapshotPtr GetDispatchSnapshot();
+    static const jenova::ScriptDispatchEntry* GetScriptDispatchEntry(const jenova::DispatchSnapshot& dispatchSnapshot, const std::string& scriptUID);
+    static uint64_t GetDispatchGeneration();
+    static jenova::FunctionAddress GetMethodSlotAddress(const jenova::ScriptMethodSlot& methodSlot);
+    static const jenova::ScriptMethodSlot* GetMethodSlot(const std::string& scriptUID, const StringName& methodName);
+    static bool UpdatePropertyStorageFromMetaData(jenova::ModuleImage& moduleImage);
+    static bool UpdateNativeInvokersFromModule(jenova::ModuleImage& moduleImage);
+    static bool RegisterNativeClasses();
+    static void ReleaseNativeClasses();
     static bool FlushPropertyStorage();
     static jenova::PropertyList GetPropertiesList(std::string& scriptUID);
     static std::string GetPropertyType(const std::string& propertyName, std::string& scriptUID);
     static jenova::PropertyAddress GetPropertyAddress(const std::string& propertyName, std::string& scriptUID);
-    static jenova::PropertyPointer GetPropertyPointer(const String& propertyName, const String& scriptUID);
-    static bool SetPropertyValueFromVariant(const String& propertyName, const Variant& propertyValue, const String& scriptUID);
+    static std::shared_ptr<jenova::ScriptPropertyLayout> GetPropertyLayout(const std::string& scriptUID);
+    static jenova::ScriptPropertyBlock* CreatePropertyBlock(const std::string& scriptUID);
+    static bool UpdatePropertyBlock(jenova::ScriptPropertyBlock*& propertyBlock, const std::string& scriptUID);
+    static void ReleasePropertyBlock(jenova::ScriptPropertyBlock* propertyBlock);
+    static bool BindPropertyBlock(jenova::ScriptPropertyBlock* propertyBlock, jenova::ScriptPropertyBlock** previousPropertyBlock = nullptr);
+    static std::unique_lock<std::recursive_mutex> LockPropertyBinding();
+    static bool SetPropertyBlockValue(jenova::ScriptPropertyBlock* propertyBlock, const StringName& propertyName, const Variant& propertyValue);
+    static bool GetPropertyBlockValue(const jenova::ScriptPropertyBlock* propertyBlock, const StringName& propertyName, Variant& propertyValue);
     static jenova::InterpreterBackend GetInterpreterBackend();
     static void SetInterpreterBackend(jenova::InterpreterBackend newBackend);
     static jenova::FunctionPointer SolveVirtualFunction(jenova::ModuleHandle moduleHandle, const char* functionName);
@@ -59,24 +91,60 @@ public:
 
 // Module Database API
 public:
-    static bool CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData);
+    static bool CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const jenova::ModulePartList& moduleParts = jenova::ModulePartList());
     static bool CreateModuleDatabase(const std::string& moduleDatabaseName, const jenova::BuildResult& buildResult);
     static bool DeployFromDatabase(const std::string& moduleDatabaseName);
+    static bool ReadModuleDatabase(const std::string& moduleDatabaseName, jenova::MemoryBuffer& moduleData, jenova::SerializedData& metaData, jenova::ModulePartList& moduleParts);
     static bool IsDatabaseAvailable(const std::string& moduleDatabaseName);
 
+private:
+    static bool PrepareModuleImage(jenova::ModuleImage& moduleImage, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData, const jenova::ModulePartList& moduleParts = jenova::ModulePartList());
+    static bool PrepareModuleParts(jenova::ModuleImage& moduleImage, const jenova::ModulePartList& moduleParts);
+    static bool CommitModuleImage(jenova::ModuleImage& moduleImage);
+    static bool RetireLoadedModule(const jenova::ModuleImage& nextModuleImage);
+    static void ReleaseModuleImage(jenova::ModuleImage& moduleImage);
+    static void ReleaseModuleCallerThunks(jenova::ModuleAddress moduleBaseAddress);
+    static void PublishDispatchSnapshot(const std::shared_ptr<jenova::DispatchSnapshot>& newSnapshot);
+
 private:
     static inline bool                          isInitialized           = false;
-    static inline bool                          allowExecution          = false;
+    static inline std::atomic<bool>             allowExecution          = false;
     static inline bool                          isExecuting             = false;
     static inline jenova::ModuleHandle          moduleHandle            = nullptr;
     static inline jenova::ModuleAddress         moduleBaseAddress       = 0;
-    static inline jenova::json_t                moduleMetaData          = "{}";
     static inline size_t                        moduleBinarySize        = 0;
     static inline bool                          hasDebugInformation     = false;
     static inline bool                          executeInDebugMode      = false;
+    static inline bool                          calleeDestroysArguments = false;
     static inline std::string                   moduleDiskPath          = "";
     static inline jenova::InterpreterBackend    interpreterBackend      = jenova::InterpreterBackend::TinyCC;
-    static inline jenova::PointerStorage        propertyStorage         = jenova::PointerStorage();
+    static inline std::shared_ptr<jenova::DispatchSnapshot> dispatchSnapshot = std::make_shared<jenova::DispatchSnapshot>();
+    static inline std::atomic<uint64_t>         dispatchGeneration      = 1;
+    static inline std::mutex                    callerCacheMutex;
+    static inline std::recursive_mutex          propertyBindingMutex;
+    static inline jenova::PointerStorage        callerThunkCache        = jenova::PointerStorage();
+    static inline jenova::PointerStorage        callerThunkOwners       = jenova::PointerStorage();
+    static inline jenova::PointerStorage        callerStubCache         = jenova::PointerStorage();
+    static inline jenova::PointerList           callerStubStates        = jenova::PointerList();
     static inline jenova::PropertySetMethod     propertySetMethod       = jenova::PropertySetMethod::DirectAssign;
+    static inline std::mutex                    moduleLoaderMutex;
+    static inline std::mutex                    moduleStagingMutex;
+    static inline std::unique_ptr<jenova::ModuleImage> stagedModule = nullptr;
+    static inline jenova::TaskID                stagingTaskID           = 0;
+    static inline bool                          isStaging               = false;
+    static inline std::vector<jenova::RetiredModule> retiredModules;
+    static inline jenova::ModuleImageList       loadedModuleParts       = jenova::ModuleImageList();
+    static inline jenova::NativeClassList       nativeClasses           = jenova::NativeClassList();
+    static inline std::atomic<uint64_t>         executionEpoch          = 1;
+    static inline std::atomic<uint32_t>         epochActiveCalls[2]     = { 0, 0 };
+    static inline thread_local uint32_t         threadActiveCalls       = 0;
 
+};
+
+// Jenova Interpreter Helper Structures
+struct ExecutionEpochScope
+{
+    // Call Is Counted In Its Epoch Until Scope Leaves
+    uint64_t executionEpoch = JenovaInterpreter::EnterExecutionEpoch();
+    ~ExecutionEpochScope() { JenovaInterpreter::LeaveExecutionEpoch(executionEpoch); }
 };
\ No newline at end of file
@@ -36,7 +36,12 @@ String CPPScriptLanguage::_get_name() const
 	return "C++ Script";
 }
 void CPPScriptLanguage::_init() {}
-void CPPScriptLanguage::_finish() {}
+void CPPScriptLanguage::_finish()
+{
+	// Persist Class Name Index
+	std::lock_guard<std::mutex> indexLock(classNameIndexMutex);
+	if (isClassNameIndexDirty) SaveClassNameIndex();
+}
 String CPPScriptLanguage::_get_type() const
 {
 	return jenova::GlobalSettings::JenovaScriptType;
@@ -311,7 +316,10 @@ int32_t CPPScriptLanguage::_profiling_get_frame_data(ScriptLanguageExtensionProf
 }
 void CPPScriptLanguage::_frame()
 {
-	// Process
+	// Persist Class Name Index After Changes [Batches Entries Updated During a Filesystem Scan]
+	if (!isClassNameIndexDirty) return;
+	std::unique_lock<std::mutex> indexLock(classNameIndexMutex, std::try_to_lock);
+	if (indexLock.owns_lock() && isClassNameIndexDirty) SaveClassNameIndex();
 }
 bool CPPScriptLanguage::_handles_global_class_type(const String& p_type) const
 {
@@ -323,31 +331,125 @@ Dictionary CPPScriptLanguage::_get_global_class_name(const String& p_path) const
 	// Remove
 	jenova::VerboseByID(__LINE__, "_get_global_class_name [%s]", AS_C_STRING(p_path));
 
-	// Return Global Class Name
+	// Get Source File State
 	Dictionary classInfo;
-	Ref<Resource> resource = ResourceLoader::get_singleton()->load(p_path);
-	Ref<CPPScript> cppScript = Object::cast_to<CPPScript>(resource.ptr());
-	if (cppScript.is_valid())
+	std::string sourcePath = AS_STD_STRING(ProjectSettings::get_singleton()->globalize_path(p_path));
+	std::error_code fileError;
+	uint64_t sourceFileSize = std::filesystem::file_size(sourcePath, fileError);
+	if (fileError) return classInfo;
+	uint64_t sourceModifiedTime = std::filesystem::last_write_time(sourcePath, fileError).time_since_epoch().count();
+	if (fileError) return classInfo;
+
+	// Answer From Index If Source Is Unchanged, Otherwise Parse Source Once And Update Index
+	jenova::ClassNameIndexEntry indexEntry;
 	{
-		// Check for User-Defined Class Name
-		if (cppScript->has_source_code())
+		std::lock_guard<std::mutex> indexLock(classNameIndexMutex);
+		if (!isClassNameIndexLoaded) LoadClassNameIndex();
+		auto indexIt = classNameIndex.find(sourcePath);
+		if (indexIt != classNameIndex.end() && indexIt->second.modifiedTime == sourceModifiedTime && indexIt->second.fileSize == sourceFileSize)
 		{
-			std::string className = jenova::ParseClassNameFromScriptSource(AS_STD_STRING(cppScript->get_source_code()));
-			if (!className.empty()) classInfo["name"] = AS_GD_STRING(className);
-			else classInfo["name"] = "NotFound";
+			indexEntry = indexIt->second;
 		}
+		else
+		{
+			jenova::VerboseByID(__LINE__, "Parsing Class Name From Changed Script [%s]", AS_C_STRING(p_path));
+			String sourceCode = FileAccess::get_file_as_string(p_path);
+			indexEntry.modifiedTime = sourceModifiedTime;
+			indexEntry.fileSize = sourceFileSize;
+			indexEntry.hasSourceCode = !sourceCode.is_empty();
+			if (indexEntry.hasSourceCode) indexEntry.className = jenova::ParseClassNameFromScriptSource(AS_STD_STRING(sourceCode));
+			indexEntry.baseType = jenova::GlobalSettings::JenovaScriptType;
+			classNameIndex[sourcePath] = indexEntry;
+			isClassNameIndexDirty = true;
+		}
+	}
 
-		// Create Class Info
-		if (classInfo["name"] == String("NotFound")) classInfo["name"] = " Jenova C++ Script";
-		classInfo["base_type"] = jenova::GlobalSettings::JenovaScriptType;
-		String iconPath = p_path.replace(p_path.get_extension(), "svg");
-		if (FileAccess::file_exists(iconPath)) classInfo["icon_path"] = iconPath;
-
-		// Create Global Class If Not Exists
-		ProjectSettings::get_singleton()->get_global_class_list();
+	// Check for User-Defined Class Name
+	if (indexEntry.hasSourceCode)
+	{
+		if (!indexEntry.className.empty() && !jenova::GlobalStorage::UseNativeClassBinding) classInfo["name"] = AS_GD_STRING(indexEntry.className);
+		else classInfo["name"] = " Jenova C++ Script";
 	}
+
+	// Create Class Info [Icon Is Checked Per Query, Adding or Removing It Does Not Touch Script Source]
+	classInfo["base_type"] = AS_GD_STRING(indexEntry.baseType);
+	String iconPath = p_path.replace(p_path.get_extension(), "svg");
+	if (FileAccess::file_exists(iconPath)) classInfo["icon_path"] = iconPath;
+
+	// Create Global Class If Not Exists
+	ProjectSettings::get_singleton()->get_global_class_list();
 	return classInfo;
 }
+void CPPScriptLanguage::LoadClassNameIndex() const
+{
+	// Start From Empty Index
+	isClassNameIndexLoaded = true;
+	classNameIndex.clear();
+
+	// Read Index From Cache Directory
+	String indexFile = jenova::GetJenovaCacheDirectory() + jenova::GlobalSettings::JenovaClassNameIndexFile;
+	if (!FileAccess::file_exists(indexFile)) return;
+	try
+	{
+		jenova::json_t serializer = jenova::json_t::parse(AS_STD_STRING(FileAccess::get_file_as_string(indexFile)));
+		for (const auto& indexItem : serializer["Entries"].items())
+		{
+			jenova::ClassNameIndexEntry indexEntry;
+			indexEntry.modifiedTime = indexItem.value()["ModifiedTime"].get<uint64_t>();
+			indexEntry.fileSize = indexItem.value()["FileSize"].get<uint64_t>();
+			indexEntry.hasSourceCode = indexItem.value()["HasSourceCode"].get<bool>();
+			indexEntry.className = indexItem.value()["ClassName"].get<std::string>();
+			indexEntry.baseType = indexItem.value()["BaseType"].get<std::string>();
+			classNameIndex.insert(std::make_pair(indexItem.key(), indexEntry));
+		}
+		jenova::VerboseByID(__LINE__, "Class Name Index Loaded With %lld Entries", int64_t(classNameIndex.size()));
+	}
+	catch (const std::exception&)
+	{
+		classNameIndex.clear();
+		jenova::Warning("Jenova Script Language", "Class Name Index Is Corrupted, Rebuilding.");
+	}
+}
+void CPPScriptLanguage::SaveClassNameIndex() const
+{
+	try
+	{
+		// Prune Entries of Deleted or Moved Scripts
+		for (auto indexIt = classNameIndex.begin(); indexIt != classNameIndex.end();)
+		{
+			std::error_code fileError;
+			if (!std::filesystem::exists(indexIt->first, fileError)) indexIt = classNameIndex.erase(indexIt);
+			else ++indexIt;
+		}
+
+		// Serialize Index Entries
+		jenova::json_t serializer;
+		serializer["Entries"] = jenova::json_t::object();
+		for (const auto& indexItem : classNameIndex)
+		{
+			jenova::json_t& serializedEntry = serializer["Entries"][indexItem.first];
+			serializedEntry["ModifiedTime"] = indexItem.second.modifiedTime;
+			serializedEntry["FileSize"] = indexItem.second.fileSize;
+			serializedEntry["HasSourceCode"] = indexItem.second.hasSourceCode;
+			serializedEntry["ClassName"] = indexItem.second.className;
+			serializedEntry["BaseType"] = indexItem.second.baseType;
+		}
+
+		// Write Index File On Disk
+		String indexFile = jenova::GetJenovaCacheDirectory() + jenova::GlobalSettings::JenovaClassNameIndexFile;
+		Ref<FileAccess> handle = FileAccess::open(indexFile, FileAccess::ModeFlags::WRITE);
+		if (handle.is_valid())
+		{
+			handle->store_string(AS_GD_STRING(serializer.dump(2)));
+			handle->close();
+		}
+		isClassNameIndexDirty = false;
+	}
+	catch (const std::exception&)
+	{
+		jenova::Warning("Jenova Script Language", "Failed to Save Class Name Index.");
+	}
+}
 
 // Jenova Script Language Implementation
 static CPPHeaderLanguage* header_language;
@@ -25,6 +25,17 @@ protected:
 	static void _bind_methods() {}
 	String file;
 
+private:
+	// Class Name Index
+	mutable jenova::ClassNameIndex classNameIndex;
+	mutable std::mutex classNameIndexMutex;
+	mutable bool isClassNameIndexLoaded = false;
+	mutable std::atomic<bool> isClassNameIndexDirty = false;
+
+private:
+	void LoadClassNameIndex() const;
+	void SaveClassNameIndex() const;
+
 public:
 	static void init();
 	static void deinit();
@@ -18,11 +18,57 @@
 // Singleton Instance
 JenovaScriptManager* scriptManager = nullptr;
 
+// Internal Structures
+struct BatchInvocation
+{
+	const jenova::ScriptMethodSlot* methodSlot = nullptr;
+	CPPScriptInstance* const* instances = nullptr;
+	size_t instanceCount = 0;
+	const Variant** args = nullptr;
+	int argCount = 0;
+	Variant* results = nullptr;
+	std::atomic<size_t> invokedCount = 0;
+};
+
+// Internal Helpers
+static void InvokeBatchChunk(void* batchPtr, uint32_t chunkIndex)
+{
+	// Get Chunk Range
+	BatchInvocation* batchInvocation = static_cast<BatchInvocation*>(batchPtr);
+	size_t chunkBegin = size_t(chunkIndex) * jenova::GlobalSettings::ScriptBatchParallelChunkSize;
+	size_t chunkEnd = std::min(chunkBegin + jenova::GlobalSettings::ScriptBatchParallelChunkSize, batchInvocation->instanceCount);
+
+	// Invoke Chunk Instances [Properties Are Not Bound In Parallel]
+	size_t invokedCount = 0;
+	for (size_t i = chunkBegin; i < chunkEnd; i++)
+	{
+		CPPScriptInstance* scriptInstance = batchInvocation->instances[i];
+		if (!scriptInstance || !scriptInstance->is_invokable()) continue;
+		Variant callResult = scriptInstance->invoke_method_slot(*batchInvocation->methodSlot, batchInvocation->args, batchInvocation->argCount, false);
+		if (batchInvocation->results) batchInvocation->results[i] = callResult;
+		invokedCount++;
+	}
+	batchInvocation->invokedCount += invokedCount;
+}
+static const jenova::ScriptMethodSlot* ResolveNativeUpdateSlot(const CPPScript* scriptObject, const StringName& methodName)
+{
+	// Only Plain void(double) Process Functions Can Be Called Natively
+	const jenova::ScriptMethodSlot* methodSlot = scriptObject->GetMethodSlot(methodName);
+	if (!methodSlot) return nullptr;
+	if (!JenovaScriptManager::is_native_update_method(*methodSlot))
+	{
+		jenova::Warning("Jenova Script Manager", "Native Update Function '%s' Must Be Declared as void(double), Skipping.", AS_C_STRING(methodName));
+		return nullptr;
+	}
+	return methodSlot;
+}
+
 // Jenova Script Manager Implementation
 JenovaScriptManager::JenovaScriptManager()
 {
 	scriptObjects.clear();
 	scriptInstances.clear();
+	scriptInstanceGroups.clear();
 }
 JenovaScriptManager::~JenovaScriptManager()
 {
@@ -49,19 +95,20 @@ JenovaScriptManager* JenovaScriptManager::get_singleton()
 bool JenovaScriptManager::add_script_object(CPPScript* scriptObject)
 {
 	jenova::VerboseByID(__LINE__, "New Script Object Added to Manager : %p", scriptObject);
-	scriptObjects.push_back(scriptObject);
+	scriptObject->managerHandle = scriptObjects.insert(scriptObject);
+
+	// Create Instance Group For Script Slot
+	if (scriptInstanceGroups.size() <= scriptObject->managerHandle.slotIndex) scriptInstanceGroups.resize(scriptObject->managerHandle.slotIndex + 1);
+	scriptInstanceGroups[scriptObject->managerHandle.slotIndex].clear();
 	return true;
 }
 bool JenovaScriptManager::remove_script_object(CPPScript* scriptObject)
 {
 	jenova::VerboseByID(__LINE__, "Script Object Removed from Manager : %p", scriptObject);
-	auto it = std::find(scriptObjects.begin(), scriptObjects.end(), scriptObject);
-	if (it != scriptObjects.end()) 
-	{
-		scriptObjects.erase(it);
-		return true;
-	}
-	return false;
+	if (!scriptObjects.remove(scriptObject->managerHandle)) return false;
+	scriptInstanceGroups[scriptObject->managerHandle.slotIndex].clear();
+	scriptObject->managerHandle = jenova::RegistryHandle();
+	return true;
 }
 size_t JenovaScriptManager::get_script_object_count()
 {
@@ -69,7 +116,7 @@ size_t JenovaScriptManager::get_script_object_count()
 }
 Ref<CPPScript> JenovaScriptManager::get_script_object(size_t index)
 {
-	return Ref<CPPScript>(scriptObjects[index]);
+	return Ref<CPPScript>(scriptObjects.at(index));
 }
 bool JenovaScriptManager::add_script_instance(CPPScriptInstance* scriptInstance)
 {
@@ -81,18 +128,39 @@ bool JenovaScriptManager::add_script_instance(CPPScriptInstance* scriptInstance)
 	}
 
 	// Add Script Instance
-	scriptInstances.push_back(scriptInstance);
+	scriptInstance->managerHandle = scriptInstances.insert(scriptInstance);
+	{
+		std::lock_guard<std::mutex> ownersLock(scriptInstanceOwnersMutex);
+		scriptInstanceOwners[scriptInstance->get_owner_object()] = scriptInstance;
+	}
+
+	// Add Script Instance to Script Group
+	const CPPScript* scriptObject = scriptInstance->get_script_object().ptr();
+	if (scriptObject && scriptObjects.contains(scriptObject->managerHandle))
+	{
+		scriptInstance->groupHandle = scriptInstanceGroups[scriptObject->managerHandle.slotIndex].insert(scriptInstance);
+	}
 	return true;
 }
 bool JenovaScriptManager::remove_script_instance(CPPScriptInstance* scriptInstance)
 {
-	auto it = std::find(scriptInstances.begin(), scriptInstances.end(), scriptInstance);
-	if (it != scriptInstances.end()) 
+	// Remove Script Instance
+	if (!scriptInstances.remove(scriptInstance->managerHandle)) return false;
+	scriptInstance->managerHandle = jenova::RegistryHandle();
 	{
-		scriptInstances.erase(it);
-		return true;
+		std::lock_guard<std::mutex> ownersLock(scriptInstanceOwnersMutex);
+		auto ownerIt = scriptInstanceOwners.find(scriptInstance->get_owner_object());
+		if (ownerIt != scriptInstanceOwners.end() && ownerIt->second == scriptInstance) scriptInstanceOwners.erase(ownerIt);
+	}
+
+	// Remove Script Instance From Script Group
+	const CPPScript* scriptObject = scriptInstance->get_script_object().ptr();
+	if (scriptObject && scriptObjects.contains(scriptObject->managerHandle))
+	{
+		scriptInstanceGroups[scriptObject->managerHandle.slotIndex].remove(scriptInstance->groupHandle);
 	}
-	return false;
+	scriptInstance->groupHandle = jenova::RegistryHandle();
+	return true;
 }
 size_t JenovaScriptManager::get_script_instance_count()
 {
@@ -100,10 +168,277 @@ size_t JenovaScriptManager::get_script_instance_count()
 }
 CPPScriptInstance* JenovaScriptManager::get_script_instance(size_t index)
 {
-	return scriptInstances[index];
+	return scriptInstances.at(index);
+}
+size_t JenovaScriptManager::get_script_instance_count(const CPPScript* scriptObject)
+{
+	if (!scriptObject || !scriptObjects.contains(scriptObject->managerHandle)) return 0;
+	return scriptInstanceGroups[scriptObject->managerHandle.slotIndex].size();
+}
+CPPScriptInstance* JenovaScriptManager::get_script_instance(const CPPScript* scriptObject, size_t index)
+{
+	return scriptInstanceGroups[scriptObject->managerHandle.slotIndex].at(index);
+}
+CPPScriptInstance* JenovaScriptManager::get_script_instance_from_owner(const Object* ownerObject)
+{
+	// Callables May Resolve Owners From Worker Threads While Instances Come And Go
+	std::lock_guard<std::mutex> ownersLock(scriptInstanceOwnersMutex);
+	auto ownerIt = scriptInstanceOwners.find(ownerObject);
+	if (ownerIt == scriptInstanceOwners.end()) return nullptr;
+	return ownerIt->second;
 }
 bool JenovaScriptManager::register_runtime_start_event(jenova::VoidFunc_t callbackPtr)
 {
 	runtimeStartEvents.push_back(callbackPtr);
 	return true;
+}
+uint32_t JenovaScriptManager::intern_script_identity(const std::string& scriptUID, const StringName& scriptUIDName)
+{
+	// Return Existing Index [Indices Stay Stable For Session So They Can Address Arrays]
+	std::lock_guard<std::mutex> identitiesLock(scriptIdentitiesMutex);
+	auto scriptIndex = scriptIndices.find(scriptUID);
+	if (scriptIndex != scriptIndices.end()) return scriptIndex->second;
+
+	// Assign Next Index
+	uint32_t newScriptIndex = uint32_t(scriptIdentities.size());
+	scriptIndices.insert(std::make_pair(scriptUID, newScriptIndex));
+	scriptIdentities.push_back(scriptUIDName);
+	jenova::VerboseByID(__LINE__, "Script Identity Interned : %s [%d]", scriptUID.c_str(), newScriptIndex);
+	return newScriptIndex;
+}
+StringName JenovaScriptManager::get_interned_script_identity(uint32_t scriptIndex)
+{
+	std::lock_guard<std::mutex> identitiesLock(scriptIdentitiesMutex);
+	if (scriptIndex >= scriptIdentities.size()) return StringName();
+	return scriptIdentities[scriptIndex];
+}
+size_t JenovaScriptManager::get_interned_script_count()
+{
+	std::lock_guard<std::mutex> identitiesLock(scriptIdentitiesMutex);
+	return scriptIdentities.size();
+}
+size_t JenovaScriptManager::invoke_method_batch(const StringName& methodName, CPPScriptInstance* const* instances, size_t instanceCount, const Variant** args, int argCount,
+	jenova::BatchExecution executionMode, Variant* results)
+{
+	// Validate Batch
+	if (!instances || instanceCount == 0) return 0;
+
+	// Execute Batch In Parallel If All Instances Share A Script Without Properties
+	if (executionMode == jenova::BatchExecution::Parallel && instanceCount > jenova::GlobalSettings::ScriptBatchParallelChunkSize && instances[0])
+	{
+		const CPPScript* batchScript = instances[0]->get_script_object().ptr();
+		bool homogeneousBatch = batchScript != nullptr;
+		for (size_t i = 1; i < instanceCount && homogeneousBatch; i++) homogeneousBatch = instances[i] && instances[i]->get_script_object().ptr() == batchScript;
+		const jenova::ScriptMethodSlot* methodSlot = homogeneousBatch ? batchScript->GetMethodSlot(methodName) : nullptr;
+		if (methodSlot && instances[0]->is_invokable())
+		{
+			// Property Globals Are Shared Per Module, Parallel Calls Can't Bind Them
+			auto propertyLayout = JenovaInterpreter::GetPropertyLayout(methodSlot->ownerScriptUID);
+			if (!propertyLayout || propertyLayout->propertySlots.empty())
+			{
+				// Invoke First Instance Serially to Warm Up Slot Caller Caches
+				Variant callResult = instances[0]->invoke_method_slot(*methodSlot, args, argCount);
+				if (results) results[0] = callResult;
+
+				// Dispatch Remaining Instances In Chunks to Worker Threads
+				BatchInvocation batchInvocation;
+				batchInvocation.methodSlot = methodSlot;
+				batchInvocation.instances = instances + 1;
+				batchInvocation.instanceCount = instanceCount - 1;
+				batchInvocation.args = args;
+				batchInvocation.argCount = argCount;
+				batchInvocation.results = results ? results + 1 : nullptr;
+				int chunkCount = int((batchInvocation.instanceCount + jenova::GlobalSettings::ScriptBatchParallelChunkSize - 1) / jenova::GlobalSettings::ScriptBatchParallelChunkSize);
+				WorkerThreadPool* workerThreadPool = WorkerThreadPool::get_singleton();
+				WorkerThreadPool::GroupID groupID = workerThreadPool->add_native_group_task(&InvokeBatchChunk, &batchInvocation, chunkCount, -1, true, "Jenova Script Batch");
+				workerThreadPool->wait_for_group_task_completion(groupID);
+				return batchInvocation.invokedCount.load() + 1;
+			}
+			jenova::VerboseByID(__LINE__, "Script Batch [%s] Has Properties, Executing Serially.", AS_C_STRING(methodName));
+		}
+	}
+
+	// Execute Batch Serially [Slot Is Resolved Once Per Script]
+	const CPPScript* resolvedScript = nullptr;
+	const jenova::ScriptMethodSlot* methodSlot = nullptr;
+	size_t invokedCount = 0;
+	for (size_t i = 0; i < instanceCount; i++)
+	{
+		CPPScriptInstance* scriptInstance = instances[i];
+		if (!scriptInstance || !scriptInstance->is_invokable()) continue;
+		const CPPScript* instanceScript = scriptInstance->get_script_object().ptr();
+		if (instanceScript != resolvedScript)
+		{
+			resolvedScript = instanceScript;
+			methodSlot = instanceScript->GetMethodSlot(methodName);
+		}
+		if (!methodSlot) continue;
+		Variant callResult = scriptInstance->invoke_method_slot(*methodSlot, args, argCount);
+		if (results) results[i] = callResult;
+		invokedCount++;
+	}
+	return invokedCount;
+}
+size_t JenovaScriptManager::invoke_script_method_batch(const Ref<CPPScript>& scriptObject, const StringName& methodName, const Variant** args, int argCount,
+	jenova::BatchExecution executionMode, Variant* results)
+{
+	// Validate Script
+	if (scriptObject.is_null()) return 0;
+
+	// Collect Script Instances From Script Group [Storage Is Reused Between Batches And Detached For Nested Batches]
+	if (!scriptObjects.contains(scriptObject->managerHandle)) return 0;
+	const jenova::SlotRegistry<CPPScriptInstance>& scriptInstanceGroup = scriptInstanceGroups[scriptObject->managerHandle.slotIndex];
+	std::vector<CPPScriptInstance*> instances = std::move(batchInstances);
+	instances.assign(scriptInstanceGroup.begin(), scriptInstanceGroup.end());
+
+	// Invoke Batch
+	size_t invokedCount = invoke_method_batch(methodName, instances.data(), instances.size(), args, argCount, executionMode, results);
+	batchInstances = std::move(instances);
+	return invokedCount;
+}
+bool JenovaScriptManager::register_native_update(CPPScriptInstance* scriptInstance)
+{
+	// Validate Instance Owner
+	Node* ownerNode = Object::cast_to<Node>(scriptInstance->get_owner_object());
+	if (!ownerNode || scriptInstance->get_script_object().is_null()) return false;
+
+	// Defer Registration While Lists Are Running
+	if (isRunningNativeUpdates)
+	{
+		pendingNativeUpdates.push_back(scriptInstance);
+		return true;
+	}
+
+	// Find or Create Script Update List [Lists Are Kept Sorted By Script]
+	const CPPScript* scriptObject = scriptInstance->get_script_object().ptr();
+	auto listIt = std::lower_bound(nativeUpdateLists.begin(), nativeUpdateLists.end(), scriptObject,
+		[](const jenova::NativeUpdateList& updateList, const CPPScript* script) { return updateList.scriptObject < script; });
+	if (listIt == nativeUpdateLists.end() || listIt->scriptObject != scriptObject)
+	{
+		jenova::NativeUpdateList updateList;
+		updateList.scriptObject = scriptObject;
+		listIt = nativeUpdateLists.insert(listIt, std::move(updateList));
+	}
+
+	// Add Instance to Update List
+	scriptInstance->nativeUpdateIndex = uint32_t(listIt->updateEntries.size());
+	listIt->updateEntries.push_back(jenova::NativeUpdateEntry{ scriptInstance, ownerNode });
+	return true;
+}
+bool JenovaScriptManager::unregister_native_update(CPPScriptInstance* scriptInstance)
+{
+	// Remove From Pending Registrations
+	auto pendingIt = std::find(pendingNativeUpdates.begin(), pendingNativeUpdates.end(), scriptInstance);
+	if (pendingIt != pendingNativeUpdates.end())
+	{
+		pendingNativeUpdates.erase(pendingIt);
+		return true;
+	}
+
+	// Find Script Update List
+	const CPPScript* scriptObject = scriptInstance->get_script_object().ptr();
+	auto listIt = std::lower_bound(nativeUpdateLists.begin(), nativeUpdateLists.end(), scriptObject,
+		[](const jenova::NativeUpdateList& updateList, const CPPScript* script) { return updateList.scriptObject < script; });
+	if (listIt == nativeUpdateLists.end() || listIt->scriptObject != scriptObject) return false;
+
+	// Validate Entry Index Stored In Instance
+	std::vector<jenova::NativeUpdateEntry>& updateEntries = listIt->updateEntries;
+	uint32_t entryIndex = scriptInstance->nativeUpdateIndex;
+	if (entryIndex >= updateEntries.size() || updateEntries[entryIndex].scriptInstance != scriptInstance) return false;
+	scriptInstance->nativeUpdateIndex = UINT32_MAX;
+
+	// Remove Instance From Update List [Entries Are Only Cleared While Lists Are Running]
+	if (isRunningNativeUpdates)
+	{
+		updateEntries[entryIndex].scriptInstance = nullptr;
+		hasRemovedNativeUpdates = true;
+		return true;
+	}
+	updateEntries[entryIndex] = updateEntries.back();
+	updateEntries.pop_back();
+	if (entryIndex < updateEntries.size()) updateEntries[entryIndex].scriptInstance->nativeUpdateIndex = entryIndex;
+	if (updateEntries.empty()) nativeUpdateLists.erase(listIt);
+	return true;
+}
+bool JenovaScriptManager::is_native_update_method(const jenova::ScriptMethodSlot& methodSlot)
+{
+	return methodSlot.returnTag == jenova::MarshalTypeTag::Void && methodSlot.parameterMarshals.size() == 1 && methodSlot.parameterMarshals[0].typeTag == jenova::MarshalTypeTag::Double;
+}
+void JenovaScriptManager::refresh_native_updates()
+{
+	// Re-Evaluate Native Update Opt-In After Module Commit [Instances Move Between Engine And Native Update Paths]
+	for (CPPScript* scriptObject : scriptObjects)
+	{
+		bool isNativeUpdate = scriptObject->RefreshNativeUpdate();
+		for (CPPScriptInstance* scriptInstance : scriptInstanceGroups[scriptObject->managerHandle.slotIndex])
+		{
+			bool isRegistered = scriptInstance->nativeUpdateIndex != UINT32_MAX || std::find(pendingNativeUpdates.begin(), pendingNativeUpdates.end(), scriptInstance) != pendingNativeUpdates.end();
+			if (isNativeUpdate && !isRegistered) register_native_update(scriptInstance);
+			else if (!isNativeUpdate && isRegistered) unregister_native_update(scriptInstance);
+		}
+	}
+}
+void JenovaScriptManager::run_native_updates(double deltaTime, bool physicsUpdate)
+{
+	// Validate Lists
+	if (nativeUpdateLists.empty()) return;
+
+	// Run Script Update Lists
+	typedef void(*NativeUpdateFunction)(double deltaTime);
+	typedef void(*NativeUpdateCallerFunction)(jenova::ScriptCaller* scriptCaller, double deltaTime);
+	uint64_t dispatchGeneration = JenovaInterpreter::GetDispatchGeneration();
+	isRunningNativeUpdates = true;
+	for (jenova::NativeUpdateList& updateList : nativeUpdateLists)
+	{
+		// Resolve Process Slots Once Per Module Generation
+		if (updateList.dispatchGeneration != dispatchGeneration)
+		{
+			updateList.processSlot = ResolveNativeUpdateSlot(updateList.scriptObject, StringName("_process"));
+			updateList.physicsProcessSlot = ResolveNativeUpdateSlot(updateList.scriptObject, StringName("_physics_process"));
+			updateList.dispatchGeneration = dispatchGeneration;
+		}
+
+		// Get Native Function
+		const jenova::ScriptMethodSlot* methodSlot = physicsUpdate ? updateList.physicsProcessSlot : updateList.processSlot;
+		if (!methodSlot) continue;
+		jenova::FunctionAddress functionAddress = JenovaInterpreter::GetMethodSlotAddress(*methodSlot);
+		if (!functionAddress) continue;
+
+		// Call Native Function On Each Instance [Properties Are Bound Per Instance, Binding Lock Is Not Held Across Calls]
+		for (const jenova::NativeUpdateEntry& updateEntry : updateList.updateEntries)
+		{
+			if (!updateEntry.scriptInstance || !updateEntry.scriptInstance->is_invokable()) continue;
+			if (!updateEntry.ownerNode->is_inside_tree() || !updateEntry.ownerNode->can_process()) continue;
+			if (physicsUpdate ? !updateEntry.ownerNode->is_physics_processing() : !updateEntry.ownerNode->is_processing()) continue;
+			if (!updateEntry.scriptInstance->bind_properties()) continue;
+			if (methodSlot->passesCaller)
+			{
+				jenova::ScriptCaller scriptCaller(updateEntry.ownerNode);
+				reinterpret_cast<NativeUpdateCallerFunction>(functionAddress)(&scriptCaller, deltaTime);
+			}
+			else reinterpret_cast<NativeUpdateFunction>(functionAddress)(deltaTime);
+		}
+	}
+	isRunningNativeUpdates = false;
+
+	// Compact Lists After Removals
+	if (hasRemovedNativeUpdates)
+	{
+		for (jenova::NativeUpdateList& updateList : nativeUpdateLists)
+		{
+			std::vector<jenova::NativeUpdateEntry>& updateEntries = updateList.updateEntries;
+			updateEntries.erase(std::remove_if(updateEntries.begin(), updateEntries.end(), [](const jenova::NativeUpdateEntry& updateEntry) { return updateEntry.scriptInstance == nullptr; }), updateEntries.end());
+			for (size_t i = 0; i < updateEntries.size(); i++) updateEntries[i].scriptInstance->nativeUpdateIndex = uint32_t(i);
+		}
+		nativeUpdateLists.erase(std::remove_if(nativeUpdateLists.begin(), nativeUpdateLists.end(), [](const jenova::NativeUpdateList& updateList) { return updateList.updateEntries.empty(); }), nativeUpdateLists.end());
+		hasRemovedNativeUpdates = false;
+	}
+
+	// Register Instances Created During Updates
+	if (!pendingNativeUpdates.empty())
+	{
+		std::vector<CPPScriptInstance*> pendingInstances = std::move(pendingNativeUpdates);
+		pendingNativeUpdates.clear();
+		for (CPPScriptInstance* scriptInstance : pendingInstances) register_native_update(scriptInstance);
+	}
 }
\ No newline at end of file
@@ -16,6 +16,104 @@
 // Jenova SDK
 #include "Jenova.hpp"
 
+// Jenova Script Manager Types
+namespace jenova
+{
+    struct NativeUpdateEntry
+    {
+        CPPScriptInstance* scriptInstance = nullptr;
+        Node* ownerNode = nullptr;
+    };
+    struct NativeUpdateList
+    {
+        const CPPScript* scriptObject = nullptr;
+        std::vector<NativeUpdateEntry> updateEntries;
+        const jenova::ScriptMethodSlot* processSlot = nullptr;
+        const jenova::ScriptMethodSlot* physicsProcessSlot = nullptr;
+        uint64_t dispatchGeneration = 0;
+    };
+    template <typename T> class SlotRegistry
+    {
+    private:
+        struct RegistrySlot
+        {
+            T* registryObject = nullptr;
+            uint32_t slotGeneration = 0;
+            uint32_t denseIndex = UINT32_MAX;
+        };
+        std::vector<RegistrySlot> registrySlots;
+        std::vector<uint32_t> freeSlots;
+        std::vector<T*> denseObjects;
+        std::vector<uint32_t> denseSlots;
+
+    public:
+        RegistryHandle insert(T* registryObject)
+        {
+            // Reuse Free Slot or Append New Slot
+            uint32_t slotIndex = 0;
+            if (!freeSlots.empty())
+            {
+                slotIndex = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            else
+            {
+                slotIndex = uint32_t(registrySlots.size());
+                registrySlots.emplace_back();
+            }
+
+            // Append Object to Dense Storage
+            RegistrySlot& registrySlot = registrySlots[slotIndex];
+            registrySlot.registryObject = registryObject;
+            registrySlot.denseIndex = uint32_t(denseObjects.size());
+            denseObjects.push_back(registryObject);
+            denseSlots.push_back(slotIndex);
+            return RegistryHandle{ slotIndex, registrySlot.slotGeneration };
+        }
+        bool remove(const RegistryHandle& registryHandle)
+        {
+            // Validate Handle
+            if (!contains(registryHandle)) return false;
+            RegistrySlot& registrySlot = registrySlots[registryHandle.slotIndex];
+
+            // Swap Remove From Dense Storage
+            uint32_t denseIndex = registrySlot.denseIndex;
+            uint32_t lastSlotIndex = denseSlots.back();
+            denseObjects[denseIndex] = denseObjects.back();
+            denseSlots[denseIndex] = lastSlotIndex;
+            registrySlots[lastSlotIndex].denseIndex = denseIndex;
+            denseObjects.pop_back();
+            denseSlots.pop_back();
+
+            // Retire Slot [Generation Bump Invalidates Outstanding Handles]
+            registrySlot.registryObject = nullptr;
+            registrySlot.denseIndex = UINT32_MAX;
+            registrySlot.slotGeneration++;
+            freeSlots.push_back(registryHandle.slotIndex);
+            return true;
+        }
+        void clear()
+        {
+            while (!denseSlots.empty()) remove(RegistryHandle{ denseSlots.back(), registrySlots[denseSlots.back()].slotGeneration });
+        }
+        bool contains(const RegistryHandle& registryHandle) const
+        {
+            if (registryHandle.slotIndex >= registrySlots.size()) return false;
+            const RegistrySlot& registrySlot = registrySlots[registryHandle.slotIndex];
+            return registrySlot.registryObject && registrySlot.slotGeneration == registryHandle.slotGeneration;
+        }
+        T* get(const RegistryHandle& registryHandle) const
+        {
+            return contains(registryHandle) ? registrySlots[registryHandle.slotIndex].registryObject : nullptr;
+        }
+        size_t size() const { return denseObjects.size(); }
+        bool empty() const { return denseObjects.empty(); }
+        T* at(size_t index) const { return denseObjects[index]; }
+        typename std::vector<T*>::const_iterator begin() const { return denseObjects.begin(); }
+        typename std::vector<T*>::const_iterator end() const { return denseObjects.end(); }
+    };
+}
+
 // Jenova Script Manager Definition
 class JenovaScriptManager : public RefCounted
 {
@@ -23,9 +121,20 @@ class JenovaScriptManager : public RefCounted
 
 protected:
     static void _bind_methods();
-    std::vector<CPPScript*> scriptObjects;
-    std::vector<CPPScriptInstance*> scriptInstances;
+    jenova::SlotRegistry<CPPScript> scriptObjects;
+    jenova::SlotRegistry<CPPScriptInstance> scriptInstances;
+    std::vector<jenova::SlotRegistry<CPPScriptInstance>> scriptInstanceGroups;
+    std::unordered_map<const Object*, CPPScriptInstance*> scriptInstanceOwners;
+    std::mutex scriptInstanceOwnersMutex;
+    std::vector<CPPScriptInstance*> batchInstances;
     std::vector<jenova::VoidFunc_t> runtimeStartEvents;
+    std::vector<jenova::NativeUpdateList> nativeUpdateLists;
+    std::vector<CPPScriptInstance*> pendingNativeUpdates;
+    bool isRunningNativeUpdates = false;
+    bool hasRemovedNativeUpdates = false;
+    std::unordered_map<std::string, uint32_t> scriptIndices;
+    std::vector<StringName> scriptIdentities;
+    std::mutex scriptIdentitiesMutex;
 
 public:
     JenovaScriptManager();
@@ -40,7 +149,26 @@ public:
     bool remove_script_instance(CPPScriptInstance* scriptInstance);
     size_t get_script_instance_count();
     CPPScriptInstance* get_script_instance(size_t index);
+    CPPScriptInstance* get_script_instance_from_owner(const Object* ownerObject);
+    size_t get_script_instance_count(const CPPScript* scriptObject);
+    CPPScriptInstance* get_script_instance(const CPPScript* scriptObject, size_t index);
     bool register_runtime_start_event(jenova::VoidFunc_t callbackPtr);
+    uint32_t intern_script_identity(const std::string& scriptUID, const StringName& scriptUIDName);
+    StringName get_interned_script_identity(uint32_t scriptIndex);
+    size_t get_interned_script_count();
+
+public:
+    size_t invoke_method_batch(const StringName& methodName, CPPScriptInstance* const* instances, size_t instanceCount, const Variant** args, int argCount,
+        jenova::BatchExecution executionMode = jenova::BatchExecution::Serial, Variant* results = nullptr);
+    size_t invoke_script_method_batch(const Ref<CPPScript>& scriptObject, const StringName& methodName, const Variant** args, int argCount,
+        jenova::BatchExecution executionMode = jenova::BatchExecution::Serial, Variant* results = nullptr);
+
+public:
+    bool register_native_update(CPPScriptInstance* scriptInstance);
+    bool unregister_native_update(CPPScriptInstance* scriptInstance);
+    void run_native_updates(double deltaTime, bool physicsUpdate);
+    void refresh_native_updates();
+    static bool is_native_update_method(const jenova::ScriptMethodSlot& methodSlot);
 
 public:
     static void init();
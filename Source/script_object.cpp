@@ -59,7 +59,8 @@ void* CPPScript::_instance_create(Object* p_for_object) const
 {
 	godot::Node* parentNode = godot::Object::cast_to<godot::Node>(p_for_object);
 	jenova::VerboseByID(__LINE__, "Adding C++ Script (%s) Instance to (%s)", AS_C_STRING(this->get_path()), AS_C_STRING(parentNode->get_name()));
-	CPPScriptInstance* instance = memnew(CPPScriptInstance(p_for_object, Ref<CPPScript>(this)));
+	CPPScriptInstance* instance = CPPScriptInstance::create_pooled_instance(p_for_object, Ref<CPPScript>(this), instancePool);
+	if (IsNativeUpdate) JenovaScriptManager::get_singleton()->register_native_update(instance);
 	return CPPScriptInstance::create_native_instance(instance);
 }
 void* CPPScript::_placeholder_instance_create(Object* p_for_object) const
@@ -83,10 +84,14 @@ void CPPScript::_set_source_code(const String& p_code)
 {
 	if (!this->get_path().is_empty()) jenova::VerboseByID(__LINE__, "Set C++ Script Source (%s) [%p]", AS_C_STRING(this->get_path()), this);
 	source_code = p_code;
+	methodSlotMapGeneration = 0;
 
 	// Detect Tool Macro
 	String cleanedSource = jenova::RemoveCommentsFromSource(p_code);
 	this->IsTool = jenova::ContainsExactString(cleanedSource, jenova::GlobalSettings::ScriptToolIdentifier);
+
+	// Detect Native Update Macro
+	this->IsNativeUpdate = jenova::ContainsExactString(cleanedSource, jenova::GlobalSettings::ScriptNativeUpdateIdentifier);
 }
 Error CPPScript::_reload(bool p_keep_state)
 {
@@ -127,13 +132,7 @@ String CPPScript::_get_class_icon_path() const
 }
 bool CPPScript::_has_method(const StringName& p_method) const
 {
-	std::string scriptUID = AS_STD_STRING(GetScriptIdentity());
-	jenova::FunctionList jenovaMethods = JenovaInterpreter::GetFunctionsList(scriptUID);
-	for (const auto& method : jenovaMethods)
-	{
-		if (p_method == StringName(method.c_str())) return true;
-	}
-	return false;
+	return GetMethodSlot(p_method) != nullptr;
 }
 bool CPPScript::_has_static_method(const StringName& p_method) const
 {
@@ -143,8 +142,7 @@ bool CPPScript::_has_static_method(const StringName& p_method) const
 Dictionary CPPScript::_get_method_info(const StringName& p_method) const
 {
 	TypedArray<Dictionary> methodsList;
-	std::string scriptUID = AS_STD_STRING(GetScriptIdentity());
-	auto functionContainer = JenovaInterpreter::GetFunctionContainer(scriptUID);
+	auto functionContainer = JenovaInterpreter::GetFunctionContainer(GetInternedIdentity()->scriptUIDString);
 	for (const auto& function : functionContainer.scriptFunctions)
 	{
 		if (function.functionName == p_method) return function.methodInfo;
@@ -155,6 +153,23 @@ bool CPPScript::_is_tool() const
 {
 	return IsTool;
 }
+bool CPPScript::IsNativeUpdateEnabled() const
+{
+	return IsNativeUpdate;
+}
+bool CPPScript::RefreshNativeUpdate()
+{
+	// Re-Evaluate Native Update Macro From Current Source [Hot Reload May Add or Remove It]
+	String cleanedSource = jenova::RemoveCommentsFromSource(source_code);
+	this->IsNativeUpdate = jenova::ContainsExactString(cleanedSource, jenova::GlobalSettings::ScriptNativeUpdateIdentifier);
+	return this->IsNativeUpdate;
+}
+jenova::InstancePoolStatistics CPPScript::GetInstancePoolStatistics() const
+{
+	if (!instancePool) return jenova::InstancePoolStatistics();
+	std::lock_guard<std::mutex> poolLock(instancePool->poolMutex);
+	return instancePool->poolStatistics;
+}
 bool CPPScript::_is_valid() const
 {
 	// Ask From Interpreter
@@ -196,17 +211,16 @@ void CPPScript::_update_exports()
 TypedArray<Dictionary> CPPScript::_get_script_method_list() const
 {
 	TypedArray<Dictionary> methodsList;
-	std::string scriptUID = AS_STD_STRING(GetScriptIdentity());
-	auto functionContainer = JenovaInterpreter::GetFunctionContainer(scriptUID);
+	auto functionContainer = JenovaInterpreter::GetFunctionContainer(GetInternedIdentity()->scriptUIDString);
 	for (const auto& function : functionContainer.scriptFunctions) methodsList.push_back(Dictionary(function.methodInfo));
 	return methodsList;
 }
 TypedArray<Dictionary> CPPScript::_get_script_property_list() const
 {
 	TypedArray<Dictionary> propertyList;
-	std::string scriptUID = AS_STD_STRING(GetScriptIdentity());
-	auto propertyContainer = JenovaInterpreter::GetPropertyContainer(scriptUID);
-	for (const auto& property : propertyContainer.scriptProperties) propertyList.push_back(Dictionary(property.propertyInfo));
+	std::shared_ptr<const jenova::ScriptPropertyContainer> propertyContainer = JenovaInterpreter::GetPropertyContainer(GetInternedIdentity()->scriptUIDString);
+	if (!propertyContainer) return propertyList;
+	for (const auto& property : propertyContainer->scriptProperties) propertyList.push_back(Dictionary(property.propertyInfo));
 	return propertyList;
 }
 int32_t CPPScript::_get_member_line(const StringName& p_member) const
@@ -242,18 +256,70 @@ void CPPScript::SetDefaultSourceCode()
 }
 jenova::ScriptIdentifier CPPScript::GetScriptIdentity() const
 {
-	return jenova::GenerateStandardUIDFromPath(this);
+	return GetInternedIdentity()->scriptUID;
+}
+std::shared_ptr<const jenova::ScriptIdentity> CPPScript::GetInternedIdentity() const
+{
+	// Use Interned Identity While Resource Path Is Unchanged
+	std::shared_ptr<const jenova::ScriptIdentity> currentIdentity = std::atomic_load(&scriptIdentity);
+	String resourcePath = this->get_path();
+	if (currentIdentity && currentIdentity->resourcePath == resourcePath) return currentIdentity;
+
+	// Hash Resource Path Once Per Path Change
+	std::shared_ptr<jenova::ScriptIdentity> newIdentity = std::make_shared<jenova::ScriptIdentity>();
+	newIdentity->resourcePath = resourcePath;
+	newIdentity->scriptUID = jenova::GenerateStandardUIDFromPath(resourcePath);
+	newIdentity->scriptUIDString = AS_STD_STRING(newIdentity->scriptUID);
+	newIdentity->scriptUIDName = StringName(newIdentity->scriptUID);
+	newIdentity->scriptIndex = JenovaScriptManager::get_singleton()->intern_script_identity(newIdentity->scriptUIDString, newIdentity->scriptUIDName);
+
+	// Swap Identity
+	std::atomic_store(&scriptIdentity, std::shared_ptr<const jenova::ScriptIdentity>(newIdentity));
+	return newIdentity;
+}
+uint32_t CPPScript::GetScriptIndex() const
+{
+	return GetInternedIdentity()->scriptIndex;
 }
 void CPPScript::ReloadScriptSourceCode()
 {
 	source_code = FileAccess::get_file_as_string(this->get_path());
 }
+void CPPScript::UpdateMethodSlotMap() const
+{
+	// Build Method Map From Interpreter Dispatch Snapshot [Map Keeps Its Snapshot Alive]
+	std::shared_ptr<jenova::MethodSlotMapHolder> slotMapHolder = std::make_shared<jenova::MethodSlotMapHolder>();
+	slotMapHolder->dispatchSnapshot = JenovaInterpreter::GetDispatchSnapshot();
+	const jenova::ScriptDispatchEntry* dispatchEntry = JenovaInterpreter::GetScriptDispatchEntry(*slotMapHolder->dispatchSnapshot, GetInternedIdentity()->scriptUIDString);
+	if (dispatchEntry)
+	{
+		for (const jenova::ScriptMethodSlot& methodSlot : dispatchEntry->methodSlots) slotMapHolder->methodSlots.insert(methodSlot.methodName, &methodSlot);
+	}
+
+	// Swap Method Map [Tagged With Snapshot Generation So a Concurrent Reload Forces Another Rebuild]
+	std::atomic_store(&methodSlotMap, std::shared_ptr<const jenova::MethodSlotMap>(slotMapHolder, &slotMapHolder->methodSlots));
+	methodSlotMapGeneration.store(slotMapHolder->dispatchSnapshot->generation, std::memory_order_release);
+}
+std::shared_ptr<const jenova::MethodSlotMap> CPPScript::GetMethodSlotMap() const
+{
+	// Rebuild Method Map If Module Was Loaded or Reloaded
+	if (methodSlotMapGeneration.load(std::memory_order_acquire) != JenovaInterpreter::GetDispatchGeneration()) UpdateMethodSlotMap();
+	return std::atomic_load(&methodSlotMap);
+}
+const jenova::ScriptMethodSlot* CPPScript::GetMethodSlot(const StringName& p_method) const
+{
+	std::shared_ptr<const jenova::MethodSlotMap> currentMethodSlotMap = GetMethodSlotMap();
+	if (!currentMethodSlotMap) return nullptr;
+	const jenova::ScriptMethodSlot* const* methodSlot = currentMethodSlotMap->getptr(p_method);
+	return methodSlot ? *methodSlot : nullptr;
+}
 
 // CPPScript Initializer/Destructor
 CPPScript::CPPScript()
 {
 	// Initialize Objects
 	scriptMutex.instantiate();
+	instancePool = std::make_shared<jenova::ScriptInstancePool>();
 
 	// Register Script Object to Manager
 	JenovaScriptManager::get_singleton()->add_script_object(this);
@@ -263,8 +329,14 @@ CPPScript::CPPScript()
 }
 CPPScript::~CPPScript()
 {
+	// Verbose Instance Pool Usage
+	jenova::InstancePoolStatistics poolStatistics = GetInstancePoolStatistics();
+	jenova::VerboseByID(__LINE__, "Script Instance Pool Released [Allocations : %lld, Pooled : %lld, Slabs : %lld, Peak : %lld]",
+		int64_t(poolStatistics.instanceAllocations), int64_t(poolStatistics.pooledAllocations), int64_t(poolStatistics.slabAllocations), int64_t(poolStatistics.peakInstances));
+
 	// Release Objects
 	scriptMutex.unref();
+	instancePool.reset();
 
 	// Unregister Script Object to Manager
 	JenovaScriptManager::get_singleton()->remove_script_object(this);
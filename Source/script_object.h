@@ -36,6 +36,17 @@ private:
 	StringName globalName = jenova::GlobalSettings::JenovaScriptType;
 	Ref<Mutex> scriptMutex;
 	bool IsTool = false;
+	bool IsNativeUpdate = false;
+
+	// Method Resolution
+	mutable std::shared_ptr<const jenova::MethodSlotMap> methodSlotMap;
+	mutable std::atomic<uint64_t> methodSlotMapGeneration = 0;
+
+	// Instance Allocation
+	std::shared_ptr<jenova::ScriptInstancePool> instancePool;
+
+	// Interned Identity
+	mutable std::shared_ptr<const jenova::ScriptIdentity> scriptIdentity;
 
 public:
 	// Script Class Information
@@ -43,6 +54,9 @@ public:
 	StringName scriptClassType;
 	String scriptClassPath;
 
+	// Script Manager Registration
+	jenova::RegistryHandle managerHandle;
+
 public:
 	// Base Methods
 	virtual bool _editor_can_reload_from_file() override;
@@ -85,7 +99,15 @@ public:
 	// Methods
 	void SetDefaultSourceCode();
 	jenova::ScriptIdentifier GetScriptIdentity() const;
+	std::shared_ptr<const jenova::ScriptIdentity> GetInternedIdentity() const;
+	uint32_t GetScriptIndex() const;
 	void ReloadScriptSourceCode();
+	void UpdateMethodSlotMap() const;
+	std::shared_ptr<const jenova::MethodSlotMap> GetMethodSlotMap() const;
+	const jenova::ScriptMethodSlot* GetMethodSlot(const StringName& p_method) const;
+	bool IsNativeUpdateEnabled() const;
+	bool RefreshNativeUpdate();
+	jenova::InstancePoolStatistics GetInstancePoolStatistics() const;
 
 	// Extra
 	bool is_built_in() const
@@ -33,6 +33,11 @@ struct Task
     TaskFunction function;
     std::atomic<bool> isDone;
 };
+struct TaskBatch
+{
+    const std::vector<TaskFunction>* taskFunctions = nullptr;
+    std::atomic<size_t> nextTaskIndex = 0;
+};
 
 // Internal Storage
 static std::unordered_map<TaskID, Task> tasks;
@@ -71,4 +76,75 @@ void* JenovaTaskSystem::TaskRunner(void* taskPtr)
     task->function();
     task->isDone.store(true);
     return nullptr;
+}
+bool JenovaTaskSystem::ExecuteTaskBatch(const std::vector<TaskFunction>& taskFunctions, size_t workerCount)
+{
+    // Validate Batch
+    if (taskFunctions.empty()) return true;
+    workerCount = std::clamp<size_t>(workerCount, 1, taskFunctions.size());
+
+    // Start Workers [Each Worker Pulls Next Task Until Batch Is Drained]
+    TaskBatch taskBatch;
+    taskBatch.taskFunctions = &taskFunctions;
+    std::vector<pthread_t> workers;
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; i++)
+    {
+        pthread_t workerThread;
+        if (pthread_create(&workerThread, nullptr, &JenovaTaskSystem::BatchWorker, &taskBatch) != 0) break;
+        workers.push_back(workerThread);
+    }
+
+    // Run Batch On Calling Thread If No Worker Could Be Started [Tasks Still Complete, Failures Are Reported By Tasks]
+    if (workers.empty())
+    {
+        jenova::Warning("Jenova Task System", "Failed to Start Batch Workers, Running Tasks Serially.");
+        BatchWorker(&taskBatch);
+        return true;
+    }
+
+    // Block Until Workers Drain Batch
+    for (pthread_t& workerThread : workers) pthread_join(workerThread, nullptr);
+    return true;
+}
+size_t JenovaTaskSystem::GetRecommendedWorkerCount(size_t memoryPerWorker)
+{
+    // Start From Hardware Concurrency
+    size_t workerCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+    // Get Available Physical Memory
+    uint64_t availableMemory = 0;
+    #ifdef TARGET_PLATFORM_WINDOWS
+        MEMORYSTATUSEX memoryStatus;
+        memoryStatus.dwLength = sizeof(memoryStatus);
+        if (GlobalMemoryStatusEx(&memoryStatus)) availableMemory = memoryStatus.ullAvailPhys;
+    #endif
+    #ifdef TARGET_PLATFORM_LINUX
+        std::ifstream memoryInfo("/proc/meminfo");
+        std::string memoryField;
+        uint64_t memoryValue = 0;
+        while (memoryInfo >> memoryField >> memoryValue)
+        {
+            if (memoryField == "MemAvailable:")
+            {
+                availableMemory = memoryValue * 1024;
+                break;
+            }
+            memoryInfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+    #endif
+
+    // Limit Workers So Each One Fits In Available Memory
+    if (availableMemory != 0 && memoryPerWorker != 0) workerCount = std::min<size_t>(workerCount, std::max<uint64_t>(1, availableMemory / memoryPerWorker));
+    return workerCount;
+}
+void* JenovaTaskSystem::BatchWorker(void* batchPtr)
+{
+    TaskBatch* taskBatch = static_cast<TaskBatch*>(batchPtr);
+    const std::vector<TaskFunction>& taskFunctions = *taskBatch->taskFunctions;
+    for (size_t taskIndex = taskBatch->nextTaskIndex++; taskIndex < taskFunctions.size(); taskIndex = taskBatch->nextTaskIndex++)
+    {
+        taskFunctions[taskIndex]();
+    }
+    return nullptr;
 }
\ No newline at end of file
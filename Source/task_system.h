@@ -23,7 +23,10 @@ public:
     static jenova::TaskID InitiateTask(jenova::TaskFunction function);
     static bool IsTaskComplete(jenova::TaskID taskID);
     static void ClearTask(jenova::TaskID taskID);
+    static bool ExecuteTaskBatch(const std::vector<jenova::TaskFunction>& taskFunctions, size_t workerCount);
+    static size_t GetRecommendedWorkerCount(size_t memoryPerWorker);
 
 private:
     static void* TaskRunner(void* taskPtr);
+    static void* BatchWorker(void* batchPtr);
 };
\ No newline at end of file
@@ -0,0 +1,68 @@
+/* Jenova C++ Test : Backend Caller Cost */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+#include <Godot/classes/time.hpp>
+#include <Godot/variant/utility_functions.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Test Settings
+constexpr int64_t BenchmarkCallCount = 100000;
+
+// Functions Called Through Backend Callers [Macro Definitions Are Skipped By Invoker Scanner]
+#define DECLARE_THUNK_FUNCTION(returnType, functionName, ...) returnType functionName(Caller* instance, __VA_ARGS__)
+DECLARE_THUNK_FUNCTION(int64_t, ThunkAddInteger, int64_t a, int64_t b) { return a + b; }
+DECLARE_THUNK_FUNCTION(double, ThunkScaleFloat, double value, double scale) { return value * scale; }
+DECLARE_THUNK_FUNCTION(Vector3, ThunkOffsetVector, Vector3 value, double offset) { return value + Vector3(offset, offset, offset); }
+DECLARE_THUNK_FUNCTION(String, ThunkJoinString, String a, String b) { return a + b; }
+
+// Functions Called Through Native Invokers
+int64_t InvokerAddInteger(Caller* instance, int64_t a, int64_t b) { return a + b; }
+double InvokerScaleFloat(Caller* instance, double value, double scale) { return value * scale; }
+Vector3 InvokerOffsetVector(Caller* instance, Vector3 value, double offset) { return value + Vector3(offset, offset, offset); }
+String InvokerJoinString(Caller* instance, String a, String b) { return a + b; }
+
+// Helpers
+static double MeasureCallCost(Node* self, const StringName& functionName, const Variant& a, const Variant& b, const Variant& expectedResult, bool& callFailed)
+{
+	uint64_t startTime = Time::get_singleton()->get_ticks_usec();
+	for (int64_t i = 0; i < BenchmarkCallCount; i++) if (self->call(functionName, a, b) != expectedResult) callFailed = true;
+	return (Time::get_singleton()->get_ticks_usec() - startTime) * 1000.0 / BenchmarkCallCount;
+}
+
+// Test Entry
+String RunTest(Caller* instance, int64_t frame)
+{
+	// Call Each Signature Through Both Paths
+	Node* self = GetSelf<Node>(instance);
+	struct CallCase { const char* signature; const char* thunkFunction; const char* invokerFunction; Variant a; Variant b; Variant expectedResult; };
+	const CallCase callCases[] =
+	{
+		{ "int64(int64, int64)", "ThunkAddInteger", "InvokerAddInteger", int64_t(40), int64_t(2), int64_t(42) },
+		{ "double(double, double)", "ThunkScaleFloat", "InvokerScaleFloat", 1.5, 4.0, 6.0 },
+		{ "Vector3(Vector3, double)", "ThunkOffsetVector", "InvokerOffsetVector", Vector3(1, 2, 3), 1.0, Vector3(2, 3, 4) },
+		{ "String(String, String)", "ThunkJoinString", "InvokerJoinString", String("Jenova"), String("Runtime"), String("JenovaRuntime") },
+	};
+	for (const CallCase& callCase : callCases)
+	{
+		bool thunkFailed = false, invokerFailed = false;
+		double thunkCost = MeasureCallCost(self, callCase.thunkFunction, callCase.a, callCase.b, callCase.expectedResult, thunkFailed);
+		double invokerCost = MeasureCallCost(self, callCase.invokerFunction, callCase.a, callCase.b, callCase.expectedResult, invokerFailed);
+		UtilityFunctions::print("[BENCH] CallerThunk : ", callCase.signature, ", Backend Caller ", thunkCost, " ns/call, Native Invoker ", invokerCost, " ns/call");
+		if (thunkFailed) return String(callCase.thunkFunction) + " Returned Wrong Value Through Backend Caller";
+		if (invokerFailed) return String(callCase.invokerFunction) + " Returned Wrong Value Through Native Invoker";
+	}
+	return "PASS";
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
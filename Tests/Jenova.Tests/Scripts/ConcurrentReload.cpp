@@ -0,0 +1,108 @@
+/* Jenova C++ Test : Concurrent Calls During Module Reload */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+#include <Godot/classes/time.hpp>
+#include <Godot/classes/resource_loader.hpp>
+#include <Godot/classes/worker_thread_pool.hpp>
+#include <Godot/variant/utility_functions.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Test Settings [Test State Is Kept On Node, Module Statics Are Reset By Each Reload]
+constexpr int64_t WorkerCount = 8;
+constexpr int64_t WorkerDuration = 2500;
+constexpr int64_t ReloadCount = 8;
+constexpr int64_t ReloadInterval = 250;
+
+// Workers [Each Worker Owns One Target So Instance Blocks Are Never Shared Between Threads]
+void RunWorker(Caller* instance, int64_t workerIndex)
+{
+	Node* self = GetSelf<Node>(instance);
+	Array targetNodes = self->get_meta("Targets");
+	Node* targetNode = Object::cast_to<Node>(targetNodes[workerIndex].operator Object*());
+	uint64_t workerEnd = Time::get_singleton()->get_ticks_msec() + WorkerDuration;
+	int64_t workerCalls = 0, failedCalls = 0;
+	while (Time::get_singleton()->get_ticks_msec() < workerEnd)
+	{
+		Variant callResult = targetNode->call("Work", workerCalls);
+		if (callResult.get_type() != Variant::INT || int64_t(callResult) != workerCalls + 1) failedCalls++;
+		workerCalls++;
+	}
+	targetNode->set_meta("WorkerCalls", workerCalls);
+	targetNode->set_meta("FailedCalls", failedCalls);
+}
+
+// Test Entry
+String RunTest(Caller* instance, int64_t frame)
+{
+	Node* self = GetSelf<Node>(instance);
+	uint64_t currentTime = Time::get_singleton()->get_ticks_msec();
+
+	// Start After Other Tests Finish [They Keep Their State In Module Statics, Later Reload Tests Wait For This One]
+	if (!self->has_meta("GroupTask"))
+	{
+		self->set_meta("ReloadsRuntime", true);
+		for (int64_t i = 0; i < self->get_parent()->get_child_count(); i++)
+		{
+			Node* testNode = self->get_parent()->get_child(i);
+			if (testNode == self || testNode->has_meta("TestResult")) continue;
+			if (testNode->has_meta("ReloadsRuntime") && testNode->get_index() > self->get_index()) continue;
+			return "WAIT";
+		}
+
+		// Create One Target Per Worker And Start Workers
+		Array targetNodes;
+		for (int64_t i = 0; i < WorkerCount; i++)
+		{
+			Node* targetNode = memnew(Node);
+			targetNode->set_script(ResourceLoader::get_singleton()->load("res://Scripts/ConcurrentTarget.cpp"));
+			targetNodes.push_back(targetNode);
+		}
+		self->set_meta("Targets", targetNodes);
+		self->set_meta("Reloads", 0);
+		self->set_meta("NextReload", currentTime + ReloadInterval);
+		self->set_meta("GroupTask", WorkerThreadPool::get_singleton()->add_group_task(Callable(self, "RunWorker"), WorkerCount, WorkerCount, true));
+		return "WAIT";
+	}
+
+	// Reload Runtime While Workers Are Calling Into It
+	int64_t reloadsCount = self->get_meta("Reloads");
+	if (reloadsCount < ReloadCount && currentTime >= uint64_t(self->get_meta("NextReload")))
+	{
+		if (ReloadJenovaRuntime(RuntimeReloadMode::HotReload)) self->set_meta("Reloads", ++reloadsCount);
+		self->set_meta("NextReload", currentTime + ReloadInterval);
+	}
+
+	// Wait For Workers
+	int64_t groupTask = self->get_meta("GroupTask");
+	if (!WorkerThreadPool::get_singleton()->is_group_task_completed(groupTask)) return "WAIT";
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(groupTask);
+
+	// Validate Calls And Release Targets
+	Array targetNodes = self->get_meta("Targets");
+	int64_t totalCalls = 0, failedCalls = 0;
+	for (int64_t i = 0; i < targetNodes.size(); i++)
+	{
+		Node* targetNode = Object::cast_to<Node>(targetNodes[i].operator Object*());
+		totalCalls += int64_t(targetNode->get_meta("WorkerCalls", 0));
+		failedCalls += int64_t(targetNode->get_meta("FailedCalls", 0));
+		if (targetNode->get("CallCount").get_type() != Variant::INT) failedCalls++;
+		memdelete(targetNode);
+	}
+	UtilityFunctions::print("[BENCH] ConcurrentReload : ", WorkerCount, " Workers, ", totalCalls, " Calls, ", reloadsCount, " Reloads In ", WorkerDuration, " ms");
+	if (reloadsCount == 0) return "Runtime Reload Could Not Be Staged";
+	if (failedCalls != 0) return String::num_int64(failedCalls) + " Calls Failed During Reload";
+	return "PASS";
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
@@ -0,0 +1,27 @@
+/* Jenova C++ Test Target : Concurrent Call Counter */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Properties
+JENOVA_PROPERTY(int64_t, CallCount, 0)
+
+// Functions
+int64_t Work(Caller* instance, int64_t value)
+{
+	CallCount++;
+	return value + 1;
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
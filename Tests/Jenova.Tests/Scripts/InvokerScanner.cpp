@@ -0,0 +1,81 @@
+/* Jenova C++ Test : Native Invoker Generation */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+#include <Godot/classes/os.hpp>
+#include <Godot/classes/dir_access.hpp>
+#include <Godot/classes/file_access.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Literals The Scanner Must Skip [A Misparse Emits Invokers For Functions That Don't Exist]
+static const char* rawShaderSource = R"GLSL(void fragment() { COLOR = vec4(1.0); } // ")GLSL";
+static const wchar_t* rawPrefixedSource = LR"(int NotAFunction() { return "}"; })";
+static const char* quotedSource = "int NotAFunctionEither() { return '\"'; }";
+static constexpr int64_t SeparatedCount = 1'000'000;
+static constexpr uint32_t SeparatedMask = 0xFF'FF'FF'FFu;
+static constexpr char QuoteCharacter = '\'';
+
+// Functions That Must Receive Native Invokers
+[[nodiscard]] int64_t AttributedFunction(Caller* instance, int64_t value)
+{
+	return value + SeparatedCount;
+}
+[[nodiscard("Attribute With Arguments")]] int64_t AttributeArgumentsFunction(Caller* instance, int64_t value)
+{
+	return int64_t(value & SeparatedMask);
+}
+int64_t LiteralsFunction(Caller* instance)
+{
+	return int64_t(strlen(rawShaderSource) + wcslen(rawPrefixedSource) + strlen(quotedSource)) + QuoteCharacter;
+}
+double PlainFunction(Caller* instance, double value)
+{
+	return value * 0.5;
+}
+
+// Macro Invocations Are Not Function Definitions [Comment Before Invocation Must Not Read As Return Type]
+#define DECLARE_MACRO_FUNCTION(functionName) int64_t functionName(Caller* instance)
+DECLARE_MACRO_FUNCTION(MacroFunction) { return 7; }
+
+// Test Entry
+String RunTest(Caller* instance, int64_t frame)
+{
+	// Check Results Through Script Calls
+	Node* self = GetSelf<Node>(instance);
+	if (int64_t(self->call("AttributedFunction", 1)) != 1000001) return "AttributedFunction Returned Wrong Value";
+	if (int64_t(self->call("AttributeArgumentsFunction", int64_t(0x1FFFFFFFF))) != 0xFFFFFFFF) return "AttributeArgumentsFunction Returned Wrong Value";
+	if (int64_t(self->call("LiteralsFunction")) != LiteralsFunction(instance)) return "LiteralsFunction Returned Wrong Value";
+	if (double(self->call("PlainFunction", 3.0)) != 1.5) return "PlainFunction Returned Wrong Value";
+
+	// Find Preprocessed Source In Jenova Cache
+	String cacheDirectory = OS::get_singleton()->get_cache_dir() + "/Jenova_Cache/";
+	String preprocessedSource;
+	for (const String& cacheFile : DirAccess::get_files_at(cacheDirectory))
+	{
+		if (cacheFile.begins_with("InvokerScanner_") && cacheFile.ends_with(".cpp")) preprocessedSource = FileAccess::get_file_as_string(cacheDirectory + cacheFile);
+	}
+	if (preprocessedSource.is_empty()) return "Preprocessed Source Not Found In " + cacheDirectory;
+
+	// Check Generated Invoker Table
+	for (const char* functionName : { "AttributedFunction", "AttributeArgumentsFunction", "LiteralsFunction", "PlainFunction", "RunTest" })
+	{
+		if (preprocessedSource.find(String("{ \"") + functionName + "\",") == -1) return String("Missing Native Invoker For ") + functionName;
+	}
+	for (const char* functionName : { "fragment", "NotAFunction", "NotAFunctionEither", "DECLARE_MACRO_FUNCTION" })
+	{
+		if (preprocessedSource.find(String("{ \"") + functionName + "\",") != -1) return String("Native Invoker Generated From Literal For ") + functionName;
+	}
+	return "PASS";
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
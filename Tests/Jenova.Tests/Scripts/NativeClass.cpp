@@ -0,0 +1,88 @@
+/* Jenova C++ Test : Native Class Binding */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+#include <Godot/classes/node2d.hpp>
+#include <Godot/classes/time.hpp>
+#include <Godot/classes/class_db_singleton.hpp>
+#include <Godot/classes/resource_loader.hpp>
+#include <Godot/variant/utility_functions.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Test Settings
+constexpr const char* NativeClassName = "JenovaTestNativeClass";
+constexpr const char* NativeClassScriptPath = "res://Scripts/NativeClassTarget.cpp";
+constexpr int64_t BenchmarkInstanceCount = 10000;
+constexpr int64_t BenchmarkCallCount = 100000;
+
+// Helpers
+static double MeasureInstantiation(bool useNativeClass)
+{
+	Ref<Resource> scriptResource = ResourceLoader::get_singleton()->load(NativeClassScriptPath);
+	uint64_t startTime = Time::get_singleton()->get_ticks_usec();
+	for (int64_t i = 0; i < BenchmarkInstanceCount; i++)
+	{
+		Object* instanceObject = nullptr;
+		if (useNativeClass) instanceObject = ClassDBSingleton::get_singleton()->instantiate(NativeClassName);
+		else
+		{
+			instanceObject = memnew(Node2D);
+			instanceObject->set_script(scriptResource);
+		}
+		memdelete(instanceObject);
+	}
+	return double(Time::get_singleton()->get_ticks_usec() - startTime) / 1000.0;
+}
+static double MeasureCalls(Object* instanceObject)
+{
+	uint64_t startTime = Time::get_singleton()->get_ticks_usec();
+	for (int64_t i = 0; i < BenchmarkCallCount; i++) instanceObject->call("Add", i);
+	return double(Time::get_singleton()->get_ticks_usec() - startTime) * 1000.0 / BenchmarkCallCount;
+}
+
+// Test Entry
+String RunTest(Caller* instance, int64_t frame)
+{
+	// Class Is Only Registered When Module Was Built With Native Class Binding
+	ClassDBSingleton* classDB = ClassDBSingleton::get_singleton();
+	if (!classDB->class_exists(NativeClassName))
+	{
+		UtilityFunctions::print("[BENCH] NativeClass : Skipped, Build With jenova/native_class_binding Enabled");
+		return "PASS";
+	}
+
+	// Parent Class Must Come From Script Base Type
+	if (classDB->get_parent_class(NativeClassName) != StringName("Node2D")) return "Native Class Parent Is " + String(classDB->get_parent_class(NativeClassName)) + ", Expected Node2D";
+
+	// Instances Must Be Base Type With Script Attached
+	Object* nativeObject = classDB->instantiate(NativeClassName);
+	if (!Object::cast_to<Node2D>(nativeObject)) return "Native Class Instance Is Not A Node2D";
+	Ref<Resource> attachedScript = nativeObject->get_script();
+	if (attachedScript.is_null() || attachedScript->get_path() != NativeClassScriptPath) return "Native Class Instance Has No Script Attached";
+	if (int64_t(nativeObject->call("Add", 41)) != 42) return "Native Class Method Returned Wrong Value";
+
+	// Benchmark Instantiation And Calls Against Script Attached To Base Type
+	Node2D* scriptedObject = memnew(Node2D);
+	scriptedObject->set_script(ResourceLoader::get_singleton()->load(NativeClassScriptPath));
+	double nativeCallTime = MeasureCalls(nativeObject);
+	double scriptCallTime = MeasureCalls(scriptedObject);
+	memdelete(nativeObject);
+	memdelete(scriptedObject);
+	double nativeInstantiationTime = MeasureInstantiation(true);
+	double scriptInstantiationTime = MeasureInstantiation(false);
+	UtilityFunctions::print("[BENCH] NativeClass : ", BenchmarkInstanceCount, " Instances, Native Class ", nativeInstantiationTime, " ms, Script Attach ", scriptInstantiationTime, " ms");
+	UtilityFunctions::print("[BENCH] NativeClass : ", BenchmarkCallCount, " Calls, Native Bind ", nativeCallTime, " ns/call, Script Instance ", scriptCallTime, " ns/call");
+	return "PASS";
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
@@ -0,0 +1,29 @@
+/* Jenova C++ Test Target : Native Class */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Configuration
+JENOVA_CLASS_NAME("JenovaTestNativeClass", "Node2D")
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Properties
+JENOVA_PROPERTY(int64_t, Offset, 1)
+
+// Functions
+int64_t Add(Caller* instance, int64_t value)
+{
+	return value + Offset;
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
@@ -0,0 +1,106 @@
+/* Jenova C++ Test : Native Update Lists */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+#include <Godot/classes/performance.hpp>
+#include <Godot/classes/resource_loader.hpp>
+#include <Godot/variant/utility_functions.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Test Settings
+constexpr int64_t BenchmarkNodeCount = 10000;
+constexpr int64_t BenchmarkFrameCount = 120;
+
+// Test State
+static Node* activeNode = nullptr;
+static Node* pausedNode = nullptr;
+static Node* benchmarkRoot = nullptr;
+static double benchmarkProcessTime = 0.0;
+static double nativeUpdateProcessTime = 0.0;
+
+// Helpers
+static Node* CreateTarget(Node* parent, const char* scriptPath, const String& nodeName)
+{
+	Node* targetNode = memnew(Node);
+	targetNode->set_name(nodeName);
+	targetNode->set_script(ResourceLoader::get_singleton()->load(scriptPath));
+	parent->add_child(targetNode);
+	return targetNode;
+}
+static Node* CreateBenchmarkTargets(Node* parent, const char* scriptPath)
+{
+	Node* targetsRoot = memnew(Node);
+	parent->add_child(targetsRoot);
+	for (int64_t i = 0; i < BenchmarkNodeCount; i++) CreateTarget(targetsRoot, scriptPath, "Target" + String::num_int64(i));
+	return targetsRoot;
+}
+
+// Test Entry
+String RunTest(Caller* instance, int64_t frame)
+{
+	Node* self = GetSelf<Node>(instance);
+	constexpr const char* nativeTargetPath = "res://Scripts/NativeUpdateTarget.cpp";
+	constexpr const char* processTargetPath = "res://Scripts/ProcessTarget.cpp";
+
+	// Create One Processing And One Non-Processing Target
+	if (frame == 1)
+	{
+		activeNode = CreateTarget(self, nativeTargetPath, "Active");
+		pausedNode = CreateTarget(self, nativeTargetPath, "Paused");
+		pausedNode->set_process(false);
+		return "WAIT";
+	}
+
+	// set_process(false) Must Stop Native Updates
+	if (frame == 31)
+	{
+		if (int64_t(activeNode->get("UpdateCount")) < 20) return "Native Update Did Not Run For Processing Node";
+		if (int64_t(pausedNode->get("UpdateCount")) != 0) return "Native Update Ran For Node With set_process(false)";
+		pausedNode->set_process(true);
+		return "WAIT";
+	}
+
+	// set_process(true) Must Resume Native Updates
+	if (frame == 61)
+	{
+		if (int64_t(pausedNode->get("UpdateCount")) == 0) return "Native Update Did Not Resume After set_process(true)";
+		activeNode->queue_free();
+		pausedNode->queue_free();
+		benchmarkRoot = CreateBenchmarkTargets(self, processTargetPath);
+		return "WAIT";
+	}
+
+	// Benchmark Engine Process Callbacks
+	if (frame > 62 && frame <= 62 + BenchmarkFrameCount) benchmarkProcessTime += Performance::get_singleton()->get_monitor(Performance::TIME_PROCESS);
+	if (frame == 62 + BenchmarkFrameCount)
+	{
+		benchmarkRoot->queue_free();
+		benchmarkRoot = CreateBenchmarkTargets(self, nativeTargetPath);
+		return "WAIT";
+	}
+
+	// Benchmark Native Update Lists
+	int64_t nativeBenchmarkStart = 62 + BenchmarkFrameCount + 2;
+	if (frame > nativeBenchmarkStart && frame <= nativeBenchmarkStart + BenchmarkFrameCount) nativeUpdateProcessTime += Performance::get_singleton()->get_monitor(Performance::TIME_PROCESS);
+	if (frame == nativeBenchmarkStart + BenchmarkFrameCount)
+	{
+		benchmarkRoot->queue_free();
+		double engineFrameTime = benchmarkProcessTime * 1000.0 / BenchmarkFrameCount;
+		double nativeFrameTime = nativeUpdateProcessTime * 1000.0 / BenchmarkFrameCount;
+		UtilityFunctions::print("[BENCH] NativeUpdate : ", BenchmarkNodeCount, " Nodes, Engine _process ", engineFrameTime, " ms/frame, Native Update ", nativeFrameTime, " ms/frame");
+		return "PASS";
+	}
+	return "WAIT";
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
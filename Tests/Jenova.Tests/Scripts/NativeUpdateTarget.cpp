@@ -0,0 +1,29 @@
+/* Jenova C++ Test Target : Native Update Counter */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Configuration
+JENOVA_NATIVE_UPDATE
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Properties
+JENOVA_PROPERTY(int64_t, UpdateCount, 0)
+
+// Events
+void OnProcess(Caller* instance, double delta)
+{
+	UpdateCount++;
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
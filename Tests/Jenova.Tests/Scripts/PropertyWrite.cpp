@@ -0,0 +1,96 @@
+/* Jenova C++ Test : Property Write Conversions */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Properties
+JENOVA_PROPERTY(bool, FlagValue, false)
+JENOVA_PROPERTY(int64_t, IntegerValue, 1)
+JENOVA_PROPERTY(double, FloatValue, 1.0)
+JENOVA_PROPERTY(String, TextValue, "Jenova")
+JENOVA_PROPERTY(Vector3, VectorValue, Vector3(1, 2, 3))
+JENOVA_PROPERTY(StringName, TagValue, "JenovaTag")
+JENOVA_PROPERTY(NodePath, PathValue, "../Target")
+JENOVA_PROPERTY(Node*, ObjectValue, nullptr)
+
+// Helpers
+static String CheckWrite(Node* self, const StringName& propertyName, const Variant& writtenValue, const Variant& expectedValue)
+{
+	// Write, Read Back And Restore Original Value
+	Variant originalValue = self->get(propertyName);
+	self->set(propertyName, writtenValue);
+	Variant storedValue = self->get(propertyName);
+	self->set(propertyName, originalValue);
+
+	// Stored Value Must Match Expected Value And Keep Declared Type
+	if (storedValue.get_type() != expectedValue.get_type() || storedValue != expectedValue)
+	{
+		return String(propertyName) + " Stored " + Variant::get_type_name(storedValue.get_type()) + " [" + storedValue.stringify() + "] After Writing " + Variant::get_type_name(writtenValue.get_type()) + " [" + writtenValue.stringify() + "]";
+	}
+	return "PASS";
+}
+
+// Test Entry
+String RunTest(Caller* instance, int64_t frame)
+{
+	Node* self = GetSelf<Node>(instance);
+
+	// Defaults Parsed As String Are Converted To Declared Type Once
+	if (self->get("TagValue").get_type() != Variant::STRING_NAME) return "StringName Default Was Not Converted To StringName";
+	if (self->get("PathValue").get_type() != Variant::NODE_PATH) return "NodePath Default Was Not Converted To NodePath";
+
+	// Writes Of Declared Type, Numeric Promotion, Objects And Null Are Accepted
+	struct WriteCase { const char* propertyName; Variant writtenValue; Variant expectedValue; };
+	const WriteCase acceptedWrites[] =
+	{
+		{ "FlagValue", true, true },
+		{ "IntegerValue", int64_t(42), int64_t(42) },
+		{ "IntegerValue", 42.9, int64_t(42) },
+		{ "FloatValue", 2.5, 2.5 },
+		{ "FloatValue", int64_t(3), 3.0 },
+		{ "TextValue", String("Runtime"), String("Runtime") },
+		{ "VectorValue", Vector3(4, 5, 6), Vector3(4, 5, 6) },
+		{ "TagValue", StringName("OtherTag"), StringName("OtherTag") },
+		{ "PathValue", NodePath("../Other"), NodePath("../Other") },
+		{ "ObjectValue", Variant(self), Variant(self) },
+		{ "ObjectValue", Variant(), Variant() },
+	};
+	for (const WriteCase& writeCase : acceptedWrites)
+	{
+		String writeResult = CheckWrite(self, writeCase.propertyName, writeCase.writtenValue, writeCase.expectedValue);
+		if (writeResult != "PASS") return "Accepted Write Failed : " + writeResult;
+	}
+
+	// Writes Of Any Other Type Are Rejected And Leave Property Unchanged
+	const WriteCase rejectedWrites[] =
+	{
+		{ "FlagValue", int64_t(1), false },
+		{ "IntegerValue", String("12"), int64_t(1) },
+		{ "FloatValue", String("2.5"), 1.0 },
+		{ "TextValue", int64_t(7), String("Jenova") },
+		{ "TextValue", StringName("Runtime"), String("Jenova") },
+		{ "VectorValue", Vector2(4, 5), Vector3(1, 2, 3) },
+		{ "TagValue", String("OtherTag"), StringName("JenovaTag") },
+		{ "PathValue", String("../Other"), NodePath("../Target") },
+		{ "ObjectValue", int64_t(1), Variant() },
+	};
+	for (const WriteCase& writeCase : rejectedWrites)
+	{
+		String writeResult = CheckWrite(self, writeCase.propertyName, writeCase.writtenValue, writeCase.expectedValue);
+		if (writeResult != "PASS") return "Rejected Write Was Stored : " + writeResult;
+	}
+	return "PASS";
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
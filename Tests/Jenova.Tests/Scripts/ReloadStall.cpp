@@ -0,0 +1,80 @@
+/* Jenova C++ Test : Frame Stall During Module Reload */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+#include <Godot/classes/time.hpp>
+#include <Godot/variant/utility_functions.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Test Settings [Test State Is Kept On Node, Module Statics Are Reset By Each Reload]
+constexpr int64_t BaselineFrames = 60;
+constexpr int64_t ReloadCount = 5;
+constexpr int64_t ReloadFrames = 30;
+
+// Test Entry
+String RunTest(Caller* instance, int64_t frame)
+{
+	Node* self = GetSelf<Node>(instance);
+	int64_t currentTime = Time::get_singleton()->get_ticks_usec();
+
+	// Start After Other Tests Finish [Earlier Reload Tests Included]
+	if (!self->has_meta("StallFrame"))
+	{
+		self->set_meta("ReloadsRuntime", true);
+		for (int64_t i = 0; i < self->get_parent()->get_child_count(); i++)
+		{
+			Node* testNode = self->get_parent()->get_child(i);
+			if (testNode == self || testNode->has_meta("TestResult")) continue;
+			if (testNode->has_meta("ReloadsRuntime") && testNode->get_index() > self->get_index()) continue;
+			return "WAIT";
+		}
+		self->set_meta("StallFrame", 0);
+		self->set_meta("LastFrameTime", currentTime);
+		self->set_meta("BaselineWorst", 0);
+		self->set_meta("ReloadWorst", 0);
+		self->set_meta("Reloads", 0);
+		return "WAIT";
+	}
+
+	// Measure Frame Time Since Previous Call
+	int64_t stallFrame = int64_t(self->get_meta("StallFrame")) + 1;
+	int64_t frameTime = currentTime - int64_t(self->get_meta("LastFrameTime"));
+	self->set_meta("StallFrame", stallFrame);
+	self->set_meta("LastFrameTime", currentTime);
+
+	// Record Worst Frame Without Reloads First
+	if (stallFrame <= BaselineFrames)
+	{
+		if (frameTime > int64_t(self->get_meta("BaselineWorst"))) self->set_meta("BaselineWorst", frameTime);
+		return "WAIT";
+	}
+
+	// Record Worst Frame While Reloads Are Staged And Swapped
+	if (frameTime > int64_t(self->get_meta("ReloadWorst"))) self->set_meta("ReloadWorst", frameTime);
+	int64_t reloadFrame = stallFrame - BaselineFrames - 1;
+	int64_t reloadsCount = self->get_meta("Reloads");
+	if (reloadFrame < ReloadCount * ReloadFrames)
+	{
+		if (reloadFrame % ReloadFrames == 0 && ReloadJenovaRuntime(RuntimeReloadMode::HotReload)) self->set_meta("Reloads", ++reloadsCount);
+		return "WAIT";
+	}
+
+	// Report Worst Case Stall
+	int64_t baselineWorst = self->get_meta("BaselineWorst");
+	int64_t reloadWorst = self->get_meta("ReloadWorst");
+	UtilityFunctions::print("[BENCH] ReloadStall : ", reloadsCount, " Reloads, Worst Frame ", reloadWorst / 1000.0, " ms, Baseline Worst Frame ", baselineWorst / 1000.0, " ms, Stall ", MAX(reloadWorst - baselineWorst, int64_t(0)) / 1000.0, " ms");
+	if (reloadsCount == 0) return "Runtime Reload Could Not Be Staged";
+	return "PASS";
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
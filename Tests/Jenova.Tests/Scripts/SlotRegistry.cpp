@@ -0,0 +1,76 @@
+/* Jenova C++ Test : Script Instance Registration */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+#include <Godot/classes/time.hpp>
+#include <Godot/classes/resource_loader.hpp>
+#include <Godot/variant/utility_functions.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Test Settings
+constexpr int64_t BenchmarkNodeCount = 100000;
+
+// Helpers
+static double ElapsedMilliseconds(uint64_t startTime)
+{
+	return (Time::get_singleton()->get_ticks_usec() - startTime) / 1000.0;
+}
+static String RunRegistryPass(const Ref<Resource>& targetScript, bool freeInReverse, double& createTime, double& callTime, double& freeTime)
+{
+	// Create Scripted Nodes [Each One Registers A Script Instance]
+	std::vector<Node*> targetNodes(BenchmarkNodeCount);
+	uint64_t startTime = Time::get_singleton()->get_ticks_usec();
+	for (int64_t i = 0; i < BenchmarkNodeCount; i++)
+	{
+		targetNodes[i] = memnew(Node);
+		targetNodes[i]->set_script(targetScript);
+	}
+	createTime = ElapsedMilliseconds(startTime);
+
+	// Call Into Every Instance
+	int64_t failedCalls = 0;
+	startTime = Time::get_singleton()->get_ticks_usec();
+	for (int64_t i = 0; i < BenchmarkNodeCount; i++) if (int64_t(targetNodes[i]->call("Work", i)) != i + 1) failedCalls++;
+	callTime = ElapsedMilliseconds(startTime);
+
+	// Free Scripted Nodes [Forward Order Was Quadratic With Vector Erase]
+	startTime = Time::get_singleton()->get_ticks_usec();
+	if (freeInReverse) for (int64_t i = BenchmarkNodeCount - 1; i >= 0; i--) memdelete(targetNodes[i]);
+	else for (int64_t i = 0; i < BenchmarkNodeCount; i++) memdelete(targetNodes[i]);
+	freeTime = ElapsedMilliseconds(startTime);
+
+	// Validate Calls
+	if (failedCalls != 0) return String::num_int64(failedCalls) + " Calls Failed On Registered Instances";
+	return "PASS";
+}
+
+// Test Entry
+String RunTest(Caller* instance, int64_t frame)
+{
+	// Load Target Script
+	Ref<Resource> targetScript = ResourceLoader::get_singleton()->load("res://Scripts/ConcurrentTarget.cpp");
+	if (targetScript.is_null()) return "Unable to Load Target Script";
+
+	// Create, Call And Free Twice [Second Pass Reuses Freed Slots]
+	double createTime = 0.0, callTime = 0.0, freeTime = 0.0;
+	const char* passNames[] = { "Forward Free", "Reverse Free" };
+	for (int64_t pass = 0; pass < 2; pass++)
+	{
+		String passResult = RunRegistryPass(targetScript, pass == 1, createTime, callTime, freeTime);
+		UtilityFunctions::print("[BENCH] SlotRegistry : ", BenchmarkNodeCount, " Nodes (", passNames[pass], "), Create ", createTime, " ms, Call ", callTime, " ms, Free ", freeTime, " ms");
+		if (passResult != "PASS") return passResult;
+	}
+	return "PASS";
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
@@ -0,0 +1,61 @@
+/* Jenova C++ Test Runner */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+#include <Godot/variant/utility_functions.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Runner Settings
+constexpr int64_t TestFrameLimit = 3600;
+
+// Events
+void OnProcess(Caller* instance, double delta)
+{
+	// Get Runner State [Kept On Node So It Survives Module Reloads Issued By Tests]
+	Node* self = GetSelf<Node>(instance);
+	int64_t testFrame = int64_t(self->get_meta("TestFrame", 0)) + 1;
+	int64_t failedTests = self->get_meta("FailedTests", 0);
+	self->set_meta("TestFrame", testFrame);
+
+	// Run Each Unfinished Test Once Per Frame
+	int64_t pendingTests = 0;
+	for (int64_t testIndex = 0; testIndex < self->get_child_count(); testIndex++)
+	{
+		Node* testNode = self->get_child(testIndex);
+		if (testNode->has_meta("TestResult")) continue;
+		String testResult = testNode->call("RunTest", testFrame);
+		if (testResult == "WAIT" && testFrame < TestFrameLimit)
+		{
+			pendingTests++;
+			continue;
+		}
+		if (testResult == "WAIT") testResult = "Timed Out";
+		testNode->set_meta("TestResult", testResult);
+
+		// Report Test Result
+		if (testResult == "PASS") UtilityFunctions::print("[PASS] ", testNode->get_name());
+		else
+		{
+			UtilityFunctions::print("[FAIL] ", testNode->get_name(), " : ", testResult);
+			self->set_meta("FailedTests", ++failedTests);
+		}
+	}
+
+	// Exit With Number of Failed Tests
+	if (pendingTests != 0) return;
+	UtilityFunctions::print("[DONE] ", self->get_child_count() - failedTests, " Passed, ", failedTests, " Failed");
+	self->set_process(false);
+	self->get_tree()->quit(int(failedTests));
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
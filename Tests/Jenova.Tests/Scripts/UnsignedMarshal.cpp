@@ -0,0 +1,64 @@
+/* Jenova C++ Test : Unsigned Argument And Return Marshalling */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Functions Declared Through a Macro Get No Native Invoker And Run Through The Caller Thunk
+#define THUNK_FUNCTION(returnType, functionName, parameterType) returnType functionName(Caller* instance, parameterType value)
+
+// Caller Thunk Path
+THUNK_FUNCTION(uint64_t, ThunkEchoUInt64, uint64_t) { return value; }
+THUNK_FUNCTION(uint32_t, ThunkEchoUInt32, uint32_t) { return value; }
+THUNK_FUNCTION(uint64_t, ThunkHighBit, uint64_t) { return value | (1ull << 63); }
+THUNK_FUNCTION(uint32_t, ThunkMaxUInt32, int32_t) { return uint32_t(value) | 0xFFFFFFFFu; }
+
+// Native Invoker Path
+uint64_t NativeEchoUInt64(Caller* instance, uint64_t value) { return value; }
+uint32_t NativeEchoUInt32(Caller* instance, uint32_t value) { return value; }
+
+// Helpers
+static String CheckInteger(Node* self, const char* functionName, const Variant& argument, int64_t expectedValue)
+{
+	Variant result = self->call(functionName, argument);
+	if (result.get_type() != Variant::INT) return String(functionName) + " Returned " + Variant::get_type_name(result.get_type());
+	if (int64_t(result) != expectedValue) return String(functionName) + " Returned " + String::num_int64(int64_t(result)) + ", Expected " + String::num_int64(expectedValue);
+	return "";
+}
+
+// Test Entry
+String RunTest(Caller* instance, int64_t frame)
+{
+	Node* self = GetSelf<Node>(instance);
+	const String checks[] =
+	{
+		// Unsigned 64-Bit Values Keep Their Bit Pattern In Variant Integers
+		CheckInteger(self, "ThunkEchoUInt64", int64_t(-1), int64_t(-1)),
+		CheckInteger(self, "ThunkEchoUInt64", int64_t(0x7FFFFFFFFFFFFFFF), int64_t(0x7FFFFFFFFFFFFFFF)),
+		CheckInteger(self, "ThunkHighBit", int64_t(1), int64_t(0x8000000000000001ull)),
+		CheckInteger(self, "NativeEchoUInt64", int64_t(-1), int64_t(-1)),
+
+		// Floats Above INT64_MAX Convert To The Nearest Unsigned Value
+		CheckInteger(self, "ThunkEchoUInt64", 9223372036854775808.0, int64_t(0x8000000000000000ull)),
+
+		// Unsigned 32-Bit Results Are Zero Extended
+		CheckInteger(self, "ThunkEchoUInt32", int64_t(0xFFFFFFFF), int64_t(0xFFFFFFFF)),
+		CheckInteger(self, "ThunkEchoUInt32", int64_t(0x1FFFFFFFF), int64_t(0xFFFFFFFF)),
+		CheckInteger(self, "ThunkMaxUInt32", int64_t(0), int64_t(0xFFFFFFFF)),
+		CheckInteger(self, "NativeEchoUInt32", int64_t(0xFFFFFFFF), int64_t(0xFFFFFFFF)),
+	};
+	for (const String& checkResult : checks) if (!checkResult.is_empty()) return checkResult;
+	return "PASS";
+}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END